@@ -0,0 +1,48 @@
+/**
+ * @file nf_map.c
+ * @brief Read-only memory mapping of NMEA capture files, see nf_map.h.
+ */
+
+#define _DEFAULT_SOURCE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "nf_map.h"
+
+int nf_map_open(const char* name, nf_map_t* map){
+	struct stat st;
+	void* data;
+	int fd = open(name, O_RDONLY);
+
+	map->data = 0;
+	map->length = 0;
+	if (fd < 0){
+		return -1;
+	}
+	if (fstat(fd, &st) < 0){
+		close(fd);
+		return -1;
+	}
+	if (st.st_size == 0){ //mmap() rejects empty mappings
+		close(fd);
+		return 0;
+	}
+	data = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); //the mapping keeps the file open
+	if (data == MAP_FAILED){
+		return -1;
+	}
+	madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL); //read ahead aggressively, drop pages behind
+	map->data = (const uint8_t*)data;
+	map->length = (size_t)st.st_size;
+	return 0;
+}
+
+void nf_map_close(nf_map_t* map){
+	if (map->data){
+		munmap((void*)map->data, map->length);
+	}
+	map->data = 0;
+	map->length = 0;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file nf_map.h
+ * @brief Read-only memory mapping of NMEA capture files for host tools.
+ *
+ * A mapped capture is scanned in place: nf_scan_block() offsets and nf_view.h field views point
+ * straight into the page cache, so no byte is copied between the kernel and the parser.
+ */
+
+#ifndef NF_MAP_H_
+#define NF_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A mapped file.
+ */
+typedef struct {
+	const uint8_t* data; /**< First byte, 0 for an empty file */
+	size_t length;       /**< Bytes mapped */
+} nf_map_t;
+
+/**
+ * @brief Map a whole file read-only and advise the kernel it will be read front to back.
+ * @param name File name.
+ * @param map Filled in on success.
+ * @return 0 on success, -1 with errno set on failure.
+ */
+int nf_map_open(const char* name, nf_map_t* map);
+
+/**
+ * @brief Unmap a file mapped by nf_map_open(); views into it become invalid.
+ */
+void nf_map_close(nf_map_t* map);
+
+#endif /* NF_MAP_H_ */
@@ -0,0 +1,356 @@
+/**
+ * @file nf_scan.c
+ * @brief Block scanner for host-side NMEA ingestion, see nf_scan.h.
+ *
+ * Each 64 byte chunk is reduced to one bit mask of structural characters; the set bits are then
+ * walked in order by a small framing state machine. Only the mask computation and the checksum
+ * XOR differ between implementations. The SSE2 and AVX2 versions are compiled with function
+ * target attributes, so one -O2 build runs on any x86-64 and picks the best version at run time.
+ */
+
+#include <string.h>
+#include "nf_scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define NF_SCAN_X86 1
+#include <immintrin.h>
+#else
+#define NF_SCAN_X86 0
+#endif
+
+//defines
+#define CHUNK_SIZE 64 /**< Bytes per structural mask */
+#define NO_POS 0xFFFFFFFFUL
+#define NMEA_MSG_ID_SIZE 5 /**< Talker and sentence ID characters, e.g. "GPGGA" */
+
+//local static
+static uint64_t (*classify)(const uint8_t* chunk); /**< Mask of structural characters in 64 bytes */
+static uint8_t (*checksum)(const uint8_t* data, size_t length);
+static nf_scan_impl_t selected = NF_SCAN_AUTO;
+
+/**
+ * @brief Structural characters: '$', ',', '*', '\r' and '\n'.
+ */
+static const uint8_t structural[256] = {
+	['$'] = 1, [','] = 1, ['*'] = 1, ['\r'] = 1, ['\n'] = 1
+};
+
+static uint64_t classify_scalar(const uint8_t* chunk){
+	uint64_t mask = 0;
+
+	for (int i = 0; i < CHUNK_SIZE; i++){
+		mask |= (uint64_t)structural[chunk[i]] << i;
+	}
+	return mask;
+}
+
+static uint8_t checksum_scalar(const uint8_t* data, size_t length){
+	uint64_t acc = 0;
+	uint64_t word;
+	uint8_t sum;
+
+	while (length >= sizeof(word)){
+		memcpy(&word, data, sizeof(word));
+		acc ^= word;
+		data += sizeof(word);
+		length -= sizeof(word);
+	}
+	acc ^= acc >> 32;
+	acc ^= acc >> 16;
+	acc ^= acc >> 8;
+	sum = (uint8_t)acc;
+	while (length--){
+		sum ^= *data++;
+	}
+	return sum;
+}
+
+#if NF_SCAN_X86
+__attribute__((target("sse2")))
+static uint64_t classify_sse2(const uint8_t* chunk){
+	const __m128i dollar = _mm_set1_epi8('$');
+	const __m128i comma = _mm_set1_epi8(',');
+	const __m128i star = _mm_set1_epi8('*');
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i lf = _mm_set1_epi8('\n');
+	uint64_t mask = 0;
+
+	for (int i = 0; i < CHUNK_SIZE; i += 16){
+		__m128i v = _mm_loadu_si128((const __m128i*)(chunk + i));
+		__m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, dollar), _mm_cmpeq_epi8(v, comma)),
+			_mm_or_si128(_mm_cmpeq_epi8(v, star), _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf))));
+		mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(hit) << i;
+	}
+	return mask;
+}
+
+__attribute__((target("sse2")))
+static uint8_t checksum_sse2(const uint8_t* data, size_t length){
+	__m128i acc = _mm_setzero_si128();
+	uint8_t sum;
+
+	while (length >= 16){
+		acc = _mm_xor_si128(acc, _mm_loadu_si128((const __m128i*)data));
+		data += 16;
+		length -= 16;
+	}
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 8));
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 4));
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 2));
+	acc = _mm_xor_si128(acc, _mm_srli_si128(acc, 1));
+	sum = (uint8_t)_mm_cvtsi128_si32(acc);
+	while (length--){
+		sum ^= *data++;
+	}
+	return sum;
+}
+
+__attribute__((target("avx2")))
+static uint64_t classify_avx2(const uint8_t* chunk){
+	const __m256i dollar = _mm256_set1_epi8('$');
+	const __m256i comma = _mm256_set1_epi8(',');
+	const __m256i star = _mm256_set1_epi8('*');
+	const __m256i cr = _mm256_set1_epi8('\r');
+	const __m256i lf = _mm256_set1_epi8('\n');
+	uint64_t mask = 0;
+
+	for (int i = 0; i < CHUNK_SIZE; i += 32){
+		__m256i v = _mm256_loadu_si256((const __m256i*)(chunk + i));
+		__m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, dollar), _mm256_cmpeq_epi8(v, comma)),
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, star), _mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, lf))));
+		mask |= (uint64_t)(uint32_t)_mm256_movemask_epi8(hit) << i;
+	}
+	return mask;
+}
+
+__attribute__((target("avx2")))
+static uint8_t checksum_avx2(const uint8_t* data, size_t length){
+	__m256i acc = _mm256_setzero_si256();
+	__m128i half;
+	uint8_t sum;
+
+	while (length >= 32){
+		acc = _mm256_xor_si256(acc, _mm256_loadu_si256((const __m256i*)data));
+		data += 32;
+		length -= 32;
+	}
+	half = _mm_xor_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	if (length >= 16){
+		half = _mm_xor_si128(half, _mm_loadu_si128((const __m128i*)data));
+		data += 16;
+		length -= 16;
+	}
+	half = _mm_xor_si128(half, _mm_srli_si128(half, 8));
+	half = _mm_xor_si128(half, _mm_srli_si128(half, 4));
+	half = _mm_xor_si128(half, _mm_srli_si128(half, 2));
+	half = _mm_xor_si128(half, _mm_srli_si128(half, 1));
+	sum = (uint8_t)_mm_cvtsi128_si32(half);
+	while (length--){
+		sum ^= *data++;
+	}
+	return sum;
+}
+#endif
+
+nf_scan_impl_t nf_scan_select(nf_scan_impl_t impl){
+#if NF_SCAN_X86
+	__builtin_cpu_init();
+	if ((impl == NF_SCAN_AUTO) || (impl == NF_SCAN_AVX2)){
+		if (__builtin_cpu_supports("avx2")){
+			classify = classify_avx2;
+			checksum = checksum_avx2;
+			return selected = NF_SCAN_AVX2;
+		}
+		impl = NF_SCAN_SSE2;
+	}
+	if ((impl == NF_SCAN_SSE2) && __builtin_cpu_supports("sse2")){
+		classify = classify_sse2;
+		checksum = checksum_sse2;
+		return selected = NF_SCAN_SSE2;
+	}
+#else
+	(void)impl;
+#endif
+	classify = classify_scalar;
+	checksum = checksum_scalar;
+	return selected = NF_SCAN_SCALAR;
+}
+
+const char* nf_scan_impl_name(nf_scan_impl_t impl){
+	switch (impl){
+		case NF_SCAN_SCALAR: return "scalar";
+		case NF_SCAN_SSE2: return "sse2";
+		case NF_SCAN_AVX2: return "avx2";
+		default: return "auto";
+	}
+}
+
+uint8_t nf_scan_checksum(const uint8_t* data, size_t length){
+	if (selected == NF_SCAN_AUTO){
+		nf_scan_select(NF_SCAN_AUTO);
+	}
+	return checksum(data, length);
+}
+
+/**
+ * @brief Value of an ASCII hex digit, or -1.
+ */
+static int hex_value(uint8_t c){
+	if ((c >= '0') && (c <= '9')){
+		return c - '0';
+	}
+	if ((c >= 'A') && (c <= 'F')){
+		return c - 'A' + 10;
+	}
+	if ((c >= 'a') && (c <= 'f')){
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+/**
+ * @brief Check the "*hh[<CR>...]" tail and the checksum of a sentence ending at lf.
+ */
+static int sentence_valid(const uint8_t* data, uint32_t start, uint32_t star, uint32_t lf){
+	int high;
+	int low;
+
+	if ((lf < star + 3) || (lf + 1 - start > NF_SCAN_MAX_SENTENCE)){
+		return 0;
+	}
+	high = hex_value(data[star + 1]);
+	low = hex_value(data[star + 2]);
+	if ((high < 0) || (low < 0)){
+		return 0;
+	}
+	for (uint32_t i = star + 3; i < lf; i++){
+		if (data[i] != '\r'){
+			return 0;
+		}
+	}
+	return checksum(data + start + 1, star - start - 1) == (uint8_t)((high << 4) | low);
+}
+
+/**
+ * @brief Abandon the open sentence. Like nf_parse_char(), only sentences that got past their
+ * ID field are counted as rejected.
+ */
+static void drop(nf_scan_result_t* result, size_t field_mark){
+	if (result->field_count - field_mark > 1){
+		result->rejected++;
+	}
+	result->field_count = field_mark;
+}
+
+size_t nf_scan_block(const uint8_t* data, size_t length, nf_scan_result_t* result){
+	uint8_t tail[CHUNK_SIZE];
+	uint32_t start = NO_POS;   //'$' of the open sentence
+	uint32_t star = NO_POS;    //'*' of the open sentence
+	size_t field_mark = 0;     //result->field_count when the open sentence started
+
+	if (selected == NF_SCAN_AUTO){
+		nf_scan_select(NF_SCAN_AUTO);
+	}
+	result->sentence_count = 0;
+	result->field_count = 0;
+	result->consumed = length;
+
+	for (size_t chunk = 0; chunk < length; chunk += CHUNK_SIZE){
+		uint64_t mask;
+
+		if (length - chunk >= CHUNK_SIZE){
+			mask = classify(data + chunk);
+		} else { //zero padding is not structural
+			memset(tail, 0, sizeof(tail));
+			memcpy(tail, data + chunk, length - chunk);
+			mask = classify(tail);
+		}
+
+		while (mask){
+			uint32_t pos = (uint32_t)(chunk + __builtin_ctzll(mask));
+			uint8_t c = data[pos];
+			mask &= mask - 1;
+
+			if (c == '$'){
+				if (start != NO_POS){
+					drop(result, field_mark); //interrupted, as in nf_parse_char()
+				}
+				if ((result->sentence_count == result->sentence_capacity)
+					|| (result->field_capacity - result->field_count < NF_SCAN_MAX_SENTENCE)){
+					result->consumed = pos; //out of room; continue from this '$' next call
+					return result->sentence_count;
+				}
+				start = pos;
+				star = NO_POS;
+				field_mark = result->field_count;
+				result->fields[result->field_count++] = pos + 1;
+				continue;
+			}
+			if (start == NO_POS){
+				continue; //between sentences
+			}
+			if (result->field_count - field_mark == 1){ //still in the talker and sentence ID
+				if (pos - start > NMEA_MSG_ID_SIZE + 1){
+					drop(result, field_mark);
+					start = NO_POS;
+				} else if (c == ','){
+					result->fields[result->field_count++] = pos + 1;
+				} //other structural characters are taken as ID characters, as the parser does
+				continue;
+			}
+			if ((pos - start >= NF_SCAN_MAX_SENTENCE) && (c != '\n')){
+				drop(result, field_mark);
+				start = NO_POS;
+				continue;
+			}
+
+			switch (c){
+				case ',':
+					if (star == NO_POS){
+						result->fields[result->field_count++] = pos + 1;
+					} else { //no comma inside "*hh"
+						drop(result, field_mark);
+						start = NO_POS;
+					}
+					break;
+				case '*':
+					if (star == NO_POS){
+						star = pos;
+					} else {
+						drop(result, field_mark);
+						start = NO_POS;
+					}
+					break;
+				case '\r':
+					if ((star == NO_POS) || (pos < star + 3)){ //checksum is mandatory
+						drop(result, field_mark);
+						start = NO_POS;
+					}
+					break;
+				default: //'\n'
+					if ((star != NO_POS) && sentence_valid(data, start, star, pos)){
+						nf_scan_sentence_t* sentence = &result->sentences[result->sentence_count++];
+						sentence->start = start;
+						sentence->checksum_pos = star;
+						sentence->end = pos + 1;
+						sentence->first_field = (uint32_t)field_mark;
+						sentence->field_count = (uint16_t)(result->field_count - field_mark);
+					} else {
+						drop(result, field_mark);
+					}
+					start = NO_POS;
+					break;
+			}
+		}
+	}
+
+	if (start != NO_POS){
+		if (length - start < NF_SCAN_MAX_SENTENCE){
+			result->field_count = field_mark;
+			result->consumed = start; //unterminated; rescan it with the next block
+		} else {
+			drop(result, field_mark);
+		}
+	}
+	return result->sentence_count;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file nf_scan.h
+ * @brief Block scanner for host-side NMEA ingestion.
+ *
+ * nf_scan_block() finds every sentence in a buffer, checks its "*hh" checksum and records the
+ * offset of each of its fields, so tools can pick the sentences they need without running the
+ * character parser over the rest. The structural characters ('$', ',', '*', '\n') are located
+ * 64 bytes at a time with SSE2 or AVX2 where the CPU has them, with a portable scalar fallback
+ * that produces the same result.
+ *
+ * Validation follows nf_parse.c: a sentence starts at '$', needs "*hh" followed by <LF> or
+ * <CR><LF>, is at most NF_SCAN_MAX_SENTENCE bytes long and is dropped if a '$' interrupts it.
+ */
+
+#ifndef NF_SCAN_H_
+#define NF_SCAN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define NF_SCAN_MAX_SENTENCE 82 /**< Longest legal sentence including '$' and <CR><LF> */
+
+/**
+ * @brief Structural character search implementations.
+ */
+typedef enum {
+	NF_SCAN_AUTO,   /**< Best one the CPU supports */
+	NF_SCAN_SCALAR, /**< Portable byte loop */
+	NF_SCAN_SSE2,   /**< 16 byte compares */
+	NF_SCAN_AVX2    /**< 32 byte compares */
+} nf_scan_impl_t;
+
+/**
+ * @brief One checksum-valid sentence found by nf_scan_block().
+ * Field i of the sentence starts at nf_scan_result_t.fields[first_field + i]; field 0 is the
+ * talker and sentence ID. A field ends one byte before the start of the next one, the last
+ * field ends at checksum_pos.
+ */
+typedef struct {
+	uint32_t start;        /**< Offset of the '$' */
+	uint32_t checksum_pos; /**< Offset of the '*' */
+	uint32_t end;          /**< Offset just past the <LF> */
+	uint32_t first_field;  /**< Index of the first field offset in nf_scan_result_t.fields */
+	uint16_t field_count;  /**< Number of fields including the ID */
+} nf_scan_sentence_t;
+
+/**
+ * @brief Output of nf_scan_block(); the arrays are owned by the caller and reused between calls.
+ */
+typedef struct {
+	nf_scan_sentence_t* sentences; /**< Valid sentences in buffer order */
+	size_t sentence_capacity;      /**< Room in sentences */
+	size_t sentence_count;         /**< Sentences found */
+	uint32_t* fields;              /**< Field start offsets of all sentences */
+	size_t field_capacity;         /**< Room in fields */
+	size_t field_count;            /**< Field offsets written */
+	size_t consumed;               /**< Bytes fully scanned; an unterminated sentence at the end is left for the next call */
+	unsigned long rejected;        /**< Running total of sentences dropped for a bad checksum, framing or length; not reset */
+} nf_scan_result_t;
+
+/**
+ * @brief Select the structural character search used by nf_scan_block().
+ * @param impl Implementation wanted; falls back to the best supported one below it.
+ * @return The implementation now in use.
+ */
+nf_scan_impl_t nf_scan_select(nf_scan_impl_t impl);
+
+/**
+ * @brief Name of an implementation for reports.
+ */
+const char* nf_scan_impl_name(nf_scan_impl_t impl);
+
+/**
+ * @brief XOR of all bytes in a range, the NMEA checksum of the text between '$' and '*'.
+ * Uses the implementation chosen by nf_scan_select().
+ */
+uint8_t nf_scan_checksum(const uint8_t* data, size_t length);
+
+/**
+ * @brief Find and validate every sentence in a buffer.
+ * Stops early when the result arrays are full; result->consumed tells where to continue.
+ * @param data Buffer start; offsets in the result are relative to it.
+ * @param length Bytes in the buffer, at most 4 GB.
+ * @param result Caller allocated arrays; sentence and field counts are reset by this call.
+ * @return Number of sentences found.
+ */
+size_t nf_scan_block(const uint8_t* data, size_t length, nf_scan_result_t* result);
+
+#endif /* NF_SCAN_H_ */
@@ -0,0 +1,95 @@
+/**
+ * @file nf_view.c
+ * @brief Field views into scanned NMEA sentences, see nf_view.h.
+ *
+ * The conversions follow nf_accumulate_digit() and nf_end_field() in nf_parse.c: digits before
+ * the '.' build the whole part, at most frac_digits digits after it the fraction, a '-'
+ * anywhere makes the number negative and other characters are ignored.
+ */
+
+#include <string.h>
+#include "nf_view.h"
+
+//defines
+#define NMEA_MSG_ID_SIZE 5 /**< Talker and sentence ID characters, e.g. "GPGGA" */
+#define NMEA_PROPRIETARY_CHAR 'P'
+#define NMEA_MINUTE_FRAC_DIGITS 5 /**< Fractional minute digits kept, as on the device */
+#define UDEG_PER_DEG 1000000UL
+
+/**
+ * @brief Whole and fractional parts of a decimal field.
+ */
+typedef struct {
+	uint32_t whole;       /**< Digits before the '.' */
+	uint32_t frac;        /**< Kept digits after the '.', scaled to frac_digits */
+	uint8_t negative;     /**< A '-' was seen */
+} nf_view_number_t;
+
+static nf_view_number_t nf_view_number(nf_field_view_t field, uint8_t frac_digits){
+	nf_view_number_t number = {0, 0, 0};
+	uint8_t digits = 0;
+	uint8_t in_frac = 0;
+
+	for (uint16_t i = 0; i < field.length; i++){
+		char c = field.ptr[i];
+
+		if ((c >= '0') && (c <= '9')){
+			if (!in_frac){
+				number.whole = (number.whole * 10) + (c - '0');
+			} else if (digits < frac_digits){
+				number.frac = (number.frac * 10) + (c - '0');
+				digits++;
+			}
+		} else if (c == '.'){
+			in_frac = 1;
+		} else if (c == '-'){
+			number.negative = 1;
+		}
+	}
+	for (; digits < frac_digits; digits++){ //"12.3" with 5 kept digits is 12.30000
+		number.frac *= 10;
+	}
+	return number;
+}
+
+nf_field_view_t nf_view_field(const uint8_t* data, const nf_scan_result_t* result, const nf_scan_sentence_t* sentence, uint16_t index){
+	nf_field_view_t view = {(const char*)data + sentence->checksum_pos, 0};
+	uint32_t start;
+	uint32_t end;
+
+	if (index >= sentence->field_count){
+		return view;
+	}
+	start = result->fields[sentence->first_field + index];
+	end = (index + 1 < sentence->field_count) ? result->fields[sentence->first_field + index + 1] - 1 : sentence->checksum_pos;
+	view.ptr = (const char*)data + start;
+	view.length = (uint16_t)(end - start);
+	return view;
+}
+
+int nf_view_is_type(nf_field_view_t id, const char* type){
+	return (id.length == NMEA_MSG_ID_SIZE) && (id.ptr[0] != NMEA_PROPRIETARY_CHAR) && !memcmp(id.ptr + 2, type, 3);
+}
+
+int32_t nf_view_udeg(nf_field_view_t field, nf_field_view_t hemisphere){
+	nf_view_number_t number = nf_view_number(field, NMEA_MINUTE_FRAC_DIGITS);
+	uint32_t degrees = number.whole / 100;
+	uint32_t minutes_e5 = ((number.whole - (degrees * 100)) * 100000UL) + number.frac;
+	int32_t udeg = (int32_t)((degrees * UDEG_PER_DEG) + ((minutes_e5 + 3) / 6));
+
+	if (hemisphere.length && ((hemisphere.ptr[0] == 'S') || (hemisphere.ptr[0] == 'W'))){
+		udeg = -udeg;
+	}
+	return udeg;
+}
+
+int32_t nf_view_fixed(nf_field_view_t field, uint8_t frac_digits){
+	nf_view_number_t number = nf_view_number(field, frac_digits);
+	uint32_t value = number.whole;
+
+	for (uint8_t i = 0; i < frac_digits; i++){
+		value *= 10;
+	}
+	value += number.frac;
+	return number.negative ? -(int32_t)value : (int32_t)value;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file nf_view.h
+ * @brief Field views into scanned NMEA sentences.
+ *
+ * A view is a pointer and length into the scanned buffer, usually an nf_map.h mapping; nothing
+ * is copied into per-field arrays the way nf_parse.c fills hdop[] or utc_time[] of its
+ * nav_solution_t. The number conversions give the same results as the device parser, so
+ * records built from views match the ones built from nf_nav_solution().
+ */
+
+#ifndef NF_VIEW_H_
+#define NF_VIEW_H_
+
+#include <stdint.h>
+#include "nf_scan.h"
+
+/**
+ * @brief Characters of one field, not terminated.
+ */
+typedef struct {
+	const char* ptr; /**< First character */
+	uint16_t length; /**< Characters in the field, 0 if empty or missing */
+} nf_field_view_t;
+
+/**
+ * @brief View of one field of a scanned sentence.
+ * @param data Buffer the sentence was scanned from.
+ * @param result Result of the nf_scan_block() call that found the sentence.
+ * @param sentence The sentence.
+ * @param index Field number, 0 for the talker and sentence ID.
+ * @return The field; missing fields read as empty.
+ */
+nf_field_view_t nf_view_field(const uint8_t* data, const nf_scan_result_t* result, const nf_scan_sentence_t* sentence, uint16_t index);
+
+/**
+ * @brief Check the ID field of a standard sentence, ignoring the talker.
+ * @param id Field 0 of the sentence.
+ * @param type Three character sentence type, e.g. "GGA".
+ * @return Non-zero for a five character, non-proprietary ID of that type.
+ */
+int nf_view_is_type(nf_field_view_t id, const char* type);
+
+/**
+ * @brief Convert a ddmm.mmmmm or dddmm.mmmmm field to microdegrees.
+ * @param field The latitude or longitude field.
+ * @param hemisphere The N/S or E/W field; 'S' and 'W' make the result negative.
+ */
+int32_t nf_view_udeg(nf_field_view_t field, nf_field_view_t hemisphere);
+
+/**
+ * @brief Convert a signed decimal field to an integer with frac_digits decimals, e.g. altitude in decimetres.
+ * Further fractional digits are ignored, missing ones read as zero.
+ */
+int32_t nf_view_fixed(nf_field_view_t field, uint8_t frac_digits);
+
+#endif /* NF_VIEW_H_ */
@@ -0,0 +1,266 @@
+/**
+ * @file nf_bench.c
+ * @brief Throughput benchmark of the device NMEA parser over the checked-in corpus.
+ *
+ * Every capture is replayed through nf_parse_char(), which also formats the LLA strings of
+ * every GGA as the display shows them and fills the satellite table from GSV and GSA, and the
+ * best of the repetitions is reported as bytes/s, sentences/s and ns per sentence together with
+ * the accept and reject counts. Heap calls made during the replay are counted through the
+ * linker's --wrap; the parser must not make any.
+ *
+ * corpus/ holds one capture per situation the parser has to handle:
+ *   clean_1hz.nmea      receiver default output at 1 Hz: RMC, VTG, GGA, GSA, GSV, GLL
+ *   clean_10hz.nmea     GGA and VTG at 10 Hz, the output nf_ubx_configure_output() asks for
+ *   noisy.nmea          1 Hz with flipped and dropped bytes, cut sentences and line noise
+ *   nofix_startup.nmea  cold start: TXT banner, empty fields, then time, then a fix
+ *   multi_gnss.nmea     GN talker, GSV for GPS, GLONASS, Galileo and BeiDou, $PUBX
+ * Every capture but noisy.nmea has a known reject count: none for the clean ones, and one for
+ * the u-blox 6 banner line of nofix_startup.nmea with a '*' in its text. A capture that rejects
+ * a different number is reported and nf_bench exits with 1, so a parser that starts dropping
+ * good sentences does not pass as noise.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc -o nf_bench nf_bench.c ../../wfx_sw/wfx_sw/nf/nf_parse.c
+ *
+ * Usage:
+ *   nf_bench [-r repetitions] [capture ...]   default: the whole corpus
+ *   nf_bench -a capture ...                   write nf_bench_corpus.h for nf_bench_avr.c
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../wfx_sw/wfx_sw/nf/nf_parse.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_types.h"
+
+//defines
+#define MIN_REPLAY_BYTES (64UL << 20) /**< Default repetitions replay at least this much per capture */
+#define AVR_EXCERPT_SIZE 2048         /**< Flash bytes per capture in nf_bench_corpus.h */
+#define AVR_LINE_BYTES 64             /**< Characters per string literal line in nf_bench_corpus.h */
+
+#define ANY_REJECTS -1L                /**< The reject count of a capture is not checked */
+
+/**
+ * @brief A capture of the corpus and the rejects it must give.
+ */
+typedef struct {
+	const char* name;  /**< Path from this directory */
+	long rejects;      /**< Sentences the parser must reject, or ANY_REJECTS */
+} corpus_entry_t;
+
+static const corpus_entry_t default_corpus[] = {
+	{"corpus/clean_1hz.nmea", 0},
+	{"corpus/clean_10hz.nmea", 0},
+	{"corpus/noisy.nmea", ANY_REJECTS},
+	{"corpus/nofix_startup.nmea", 1},
+	{"corpus/multi_gnss.nmea", 0}
+};
+
+//local static
+static unsigned long alloc_count;  /**< Heap calls since the last reset */
+static unsigned long gga_count;    /**< GGA sentences published in the current replay */
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size){
+	alloc_count++;
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size){
+	alloc_count++;
+	return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size){
+	alloc_count++;
+	return __real_realloc(ptr, size);
+}
+
+static double now(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Read a whole file into a malloc'd buffer.
+ */
+static char* load(const char* name, size_t* length){
+	FILE* in = fopen(name, "rb");
+	char* data;
+
+	if (!in){
+		perror(name);
+		exit(1);
+	}
+	fseek(in, 0, SEEK_END);
+	*length = (size_t)ftell(in);
+	fseek(in, 0, SEEK_SET);
+	data = malloc(*length ? *length : 1);
+	if (!data || (fread(data, 1, *length, in) != *length)){
+		fprintf(stderr, "%s: read failed\n", name);
+		exit(1);
+	}
+	fclose(in);
+	return data;
+}
+
+/**
+ * @brief Publish callback: count the GGA sentences.
+ */
+static void on_publish(nf_msg_type_t type){
+	if (type == NF_MSG_GGA){
+		gga_count++;
+	}
+}
+
+/**
+ * @brief Replay one capture through the parser.
+ * @param accepted Set to the sentences accepted.
+ * @param rejected Set to the sentences rejected.
+ */
+static void replay(const char* data, size_t length, unsigned long* accepted, unsigned long* rejected){
+	nf_parse_reset();
+	nf_set_publish_callback(on_publish);
+	gga_count = 0;
+	for (size_t i = 0; i < length; i++){
+		nf_parse_char(data[i]);
+	}
+	nf_parse_char('$'); //count a sentence cut off at the end
+	*accepted = 0;
+	*rejected = 0;
+	for (int i = 0; i < NF_NUM_MSG_TYPES; i++){
+		*accepted += nf_accept_count[i];
+		*rejected += nf_reject_count[i];
+	}
+}
+
+/**
+ * @brief Replay a capture and report its throughput.
+ * @return 0, or 1 if it is in the corpus and rejected a different number of sentences than expected.
+ */
+static int bench_capture(const char* name, int repetitions){
+	size_t length;
+	char* data = load(name, &length);
+	unsigned long starts = 0;
+	unsigned long accepted = 0;
+	unsigned long rejected = 0;
+	unsigned long allocs;
+	double best = 1e30;
+	const char* base = strrchr(name, '/');
+	int failed = 0;
+
+	for (size_t i = 0; i < length; i++){
+		starts += (data[i] == '$');
+	}
+	if (repetitions < 1){
+		repetitions = (int)(MIN_REPLAY_BYTES / (length ? length : 1)) + 1;
+	}
+	alloc_count = 0;
+	for (int r = 0; r < repetitions; r++){
+		double start = now();
+		replay(data, length, &accepted, &rejected);
+		double elapsed = now() - start;
+		best = elapsed < best ? elapsed : best;
+	}
+	allocs = alloc_count;
+	printf("%-20s %8zu %7lu %7lu %6lu %6lu %9.1f %10.0f %7.1f %6lu\n", base ? base + 1 : name, length, starts,
+		accepted, rejected, gga_count, length / best / 1e6, accepted / best, best * 1e9 / (starts ? starts : 1), allocs);
+	for (size_t k = 0; k < sizeof(default_corpus) / sizeof(default_corpus[0]); k++){
+		const char* corpus_base = strrchr(default_corpus[k].name, '/') + 1;
+
+		if (!strcmp(base ? base + 1 : name, corpus_base) && (default_corpus[k].rejects != ANY_REJECTS)
+				&& ((long)rejected != default_corpus[k].rejects)){
+			printf("  FAIL: %s rejected %lu sentences, expected %ld\n", corpus_base, rejected, default_corpus[k].rejects);
+			failed = 1;
+		}
+	}
+	free(data);
+	return failed;
+}
+
+/**
+ * @brief Write the start of each capture as PROGMEM strings for nf_bench_avr.c.
+ * Each excerpt is cut after the last complete sentence that fits in AVR_EXCERPT_SIZE bytes.
+ */
+static void write_avr_corpus(int count, char** names){
+	printf("/**\n * @file nf_bench_corpus.h\n * @brief Corpus excerpts for nf_bench_avr.c, written by \"nf_bench -a\"; do not edit.\n */\n\n");
+	printf("#ifndef NF_BENCH_CORPUS_H_\n#define NF_BENCH_CORPUS_H_\n\n#include <avr/pgmspace.h>\n\n");
+	for (int n = 0; n < count; n++){
+		size_t length;
+		char* data = load(names[n], &length);
+		size_t cut = length < AVR_EXCERPT_SIZE ? length : AVR_EXCERPT_SIZE;
+
+		while ((cut > 0) && (cut < length) && (data[cut - 1] != '\n')){
+			cut--;
+		}
+		printf("static const char corpus_%d[] PROGMEM =", n);
+		for (size_t i = 0; i < cut; i++){
+			if (!(i % AVR_LINE_BYTES)){
+				printf("\n\t\"");
+			}
+			if (data[i] == '\r'){
+				printf("\\r");
+			} else if (data[i] == '\n'){
+				printf("\\n");
+			} else if ((data[i] == '"') || (data[i] == '\\')){
+				printf("\\%c", data[i]);
+			} else if ((data[i] < ' ') || (data[i] > '~')){
+				printf("\\%03o", (unsigned char)data[i]);
+			} else {
+				putchar(data[i]);
+			}
+			if ((i % AVR_LINE_BYTES == AVR_LINE_BYTES - 1) || (i + 1 == cut)){
+				putchar('"');
+			}
+		}
+		printf(";\n\n");
+		free(data);
+	}
+	for (int n = 0; n < count; n++){
+		const char* base = strrchr(names[n], '/');
+		printf("static const char corpus_name_%d[] PROGMEM = \"%s\";\n", n, base ? base + 1 : names[n]);
+	}
+	printf("\n/**\n * @brief One corpus excerpt.\n */\ntypedef struct {\n\tconst char* name; /**< File name, in flash */\n");
+	printf("\tconst char* data; /**< Sentences, in flash */\n\tuint16_t length;  /**< Bytes in data */\n} nf_bench_corpus_t;\n\n");
+	printf("static const nf_bench_corpus_t corpus[] PROGMEM = {\n");
+	for (int n = 0; n < count; n++){
+		printf("\t{corpus_name_%d, corpus_%d, sizeof(corpus_%d) - 1}%s\n", n, n, n, n + 1 < count ? "," : "");
+	}
+	printf("};\n\n#endif /* NF_BENCH_CORPUS_H_ */\n");
+}
+
+int main(int argc, char** argv){
+	int repetitions = 0;
+	int i = 1;
+	int failed = 0;
+
+	if ((argc > 2) && !strcmp(argv[1], "-a")){
+		write_avr_corpus(argc - 2, argv + 2);
+		return 0;
+	}
+	if ((argc > 2) && !strcmp(argv[1], "-r")){
+		repetitions = atoi(argv[2]);
+		i = 3;
+		if (repetitions < 1){
+			fprintf(stderr, "usage: nf_bench [-r repetitions] [capture ...]\n       nf_bench -a capture ...\n");
+			return 2;
+		}
+	}
+	printf("%-20s %8s %7s %7s %6s %6s %9s %10s %7s %6s\n", "capture", "bytes", "'$'", "accept", "reject", "GGA",
+		"MB/s", "sentence/s", "ns/sent", "allocs");
+	if (i == argc){
+		for (size_t k = 0; k < sizeof(default_corpus) / sizeof(default_corpus[0]); k++){
+			failed |= bench_capture(default_corpus[k].name, repetitions);
+		}
+	}
+	for (; i < argc; i++){
+		failed |= bench_capture(argv[i], repetitions);
+	}
+	return failed;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file nf_bench_avr.c
+ * @brief Cycle count of the device NMEA parser on the ATmega328p, run under a simulator.
+ *
+ * The corpus excerpts in nf_bench_corpus.h are fed from flash through nf_parse_char(), which
+ * formats the LLA strings of every GGA as on the device. Timer1 runs at the CPU clock and counts
+ * overflows, so the cycle count is exact apart from the overflow interrupt itself. The cost of
+ * reading the excerpt from flash is measured in a separate loop and subtracted. Results go out
+ * on USART0 at 38400 baud and the program ends by sleeping with interrupts off, which stops
+ * simavr. It has not been run yet, so the per-byte parser cost in nf/nf.h is still an estimate.
+ *
+ * Build and run from this directory:
+ *   avr-gcc -mmcu=atmega328p -DF_CPU=4000000UL -Os -fshort-enums -o nf_bench_avr.elf nf_bench_avr.c ../../wfx_sw/wfx_sw/nf/nf_parse.c
+ *   simavr -m atmega328p -f 4000000 nf_bench_avr.elf
+ *
+ * Regenerate the excerpts after changing the corpus with
+ *   ./nf_bench -a corpus/clean_1hz.nmea corpus/clean_10hz.nmea corpus/noisy.nmea corpus/nofix_startup.nmea corpus/multi_gnss.nmea > nf_bench_corpus.h
+ */
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#include "../../wfx_sw/wfx_sw/nf/nf_parse.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_types.h"
+#include "nf_bench_corpus.h"
+
+//defines
+#define BENCH_BAUD 38400UL
+#define BENCH_UBRR ((F_CPU / (8 * BENCH_BAUD)) - 1) /**< Double speed, as the GPS link */
+#define CYCLES_PER_BYTE_AT_BAUD (F_CPU * 10 / BENCH_BAUD) /**< Cycles between two received bytes at full line load */
+
+//local static
+static volatile uint16_t timer_overflows; /**< Upper 16 bits of the cycle counter */
+static volatile char sink;                /**< Keeps the baseline loop from being optimised away */
+
+ISR(TIMER1_OVF_vect){
+	timer_overflows++;
+}
+
+/**
+ * @brief Read the 32 bit cycle counter.
+ */
+static uint32_t cycles(){
+	uint16_t high;
+	uint16_t low;
+
+	cli();
+	low = TCNT1;
+	high = timer_overflows;
+	if ((TIFR1 & _BV(TOV1)) && (low < 0x8000)){ //overflowed after the read, before the interrupt ran
+		high++;
+	}
+	sei();
+	return ((uint32_t)high << 16) | low;
+}
+
+static void put_char(char c){
+	while (!(UCSR0A & _BV(UDRE0))){
+	}
+	UCSR0A = _BV(U2X0) | _BV(TXC0); //clear TXC0, set again once this character has left
+	UDR0 = c;
+}
+
+static void put_string_P(const char* str){
+	char c;
+
+	while ((c = pgm_read_byte(str++))){
+		put_char(c);
+	}
+}
+
+static void put_uint(uint32_t value){
+	char digits[10];
+	uint8_t count = 0;
+
+	do {
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+	while (count){
+		put_char(digits[--count]);
+	}
+}
+
+static void bench_corpus(const nf_bench_corpus_t* entry){
+	const char* data = (const char*)pgm_read_ptr(&entry->data);
+	uint16_t length = pgm_read_word(&entry->length);
+	uint16_t starts = 0;
+	uint32_t baseline;
+	uint32_t parse;
+	uint32_t start;
+
+	start = cycles();
+	for (uint16_t i = 0; i < length; i++){
+		sink = pgm_read_byte(data + i);
+	}
+	baseline = cycles() - start;
+
+	nf_parse_reset();
+	start = cycles();
+	for (uint16_t i = 0; i < length; i++){
+		nf_parse_char(pgm_read_byte(data + i));
+	}
+	parse = cycles() - start - baseline;
+
+	for (uint16_t i = 0; i < length; i++){
+		starts += (pgm_read_byte(data + i) == '$');
+	}
+	put_string_P((const char*)pgm_read_ptr(&entry->name));
+	put_string_P(PSTR(": bytes "));
+	put_uint(length);
+	put_string_P(PSTR(" sentences "));
+	put_uint(starts);
+	put_string_P(PSTR(" cycles "));
+	put_uint(parse);
+	put_string_P(PSTR(" cycles/sentence "));
+	put_uint(parse / (starts ? starts : 1));
+	put_string_P(PSTR(" cycles/byte "));
+	put_uint(parse / (length ? length : 1));
+	put_string_P(PSTR(" line load "));
+	put_uint((parse * 100) / ((uint32_t)length * CYCLES_PER_BYTE_AT_BAUD));
+	put_string_P(PSTR("%\r\n"));
+}
+
+int main(){
+	UBRR0H = (uint8_t)(BENCH_UBRR >> 8);
+	UBRR0L = (uint8_t)BENCH_UBRR;
+	UCSR0A = _BV(U2X0);
+	UCSR0B = _BV(TXEN0);
+	UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);
+
+	TCCR1A = 0;
+	TCCR1B = _BV(CS10); //clk/1
+	TIMSK1 = _BV(TOIE1);
+	sei();
+
+	for (uint8_t i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++){
+		bench_corpus(&corpus[i]);
+	}
+
+	while (!(UCSR0A & _BV(TXC0))){ //let the last character leave
+	}
+	cli();
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+	return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file nf_bench_corpus.h
+ * @brief Corpus excerpts for nf_bench_avr.c, written by "nf_bench -a"; do not edit.
+ */
+
+#ifndef NF_BENCH_CORPUS_H_
+#define NF_BENCH_CORPUS_H_
+
+#include <avr/pgmspace.h>
+
+static const char corpus_0[] PROGMEM =
+	"$GPRMC,092640.00,A,4717.11306,N,00833.91685,E,7.611,77.52,171026"
+	",,,A*59\r\n$GPVTG,77.52,T,,M,7.611,N,14.095,K,A*32\r\n$GPGGA,092640."
+	"00,4717.11306,N,00833.91685,E,1,08,1.01,548.9,M,48.0,M,,*5A\r\n$GP"
+	"GSA,A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.03,1.38*0A\r\n$GPGSV,3,"
+	"1,11,16,52,215,45,18,08,099,41,07,62,263,35,03,53,105,25*7C\r\n$GP"
+	"GSV,3,2,11,29,23,139,23,06,62,144,25,22,13,207,18,17,65,256,25*7"
+	"1\r\n$GPGSV,3,3,11,21,76,286,17,27,38,075,19,01,54,004,38*4A\r\n$GPG"
+	"LL,4717.11306,N,00833.91685,E,092640.00,A,A*6B\r\n$GPRMC,092641.00"
+	",A,4717.11345,N,00833.91787,E,13.553,77.52,171026,,,A*6C\r\n$GPVTG"
+	",77.52,T,,M,13.553,N,25.100,K,A*0D\r\n$GPGGA,092641.00,4717.11345,"
+	"N,00833.91787,E,1,08,1.01,585.1,M,48.0,M,,*56\r\n$GPGSA,A,3,10,07,"
+	"05,02,29,04,08,13,,,,,1.72,1.03,1.38*0A\r\n$GPGSV,3,1,11,16,52,215"
+	",45,18,08,099,41,07,62,263,35,03,53,105,25*7C\r\n$GPGSV,3,2,11,29,"
+	"23,139,23,06,62,144,25,22,13,207,18,17,65,256,25*71\r\n$GPGSV,3,3,"
+	"11,21,76,286,17,27,38,075,19,01,54,004,38*4A\r\n$GPGLL,4717.11345,"
+	"N,00833.91787,E,092641.00,A,A*6E\r\n$GPRMC,092642.00,A,4717.11370,"
+	"N,00833.91759,E,7.212,77.52,171026,,,A*5D\r\n$GPVTG,77.52,T,,M,7.2"
+	"12,N,13.356,K,A*3E\r\n$GPGGA,092642.00,4717.11370,N,00833.91759,E,"
+	"1,08,1.01,509.5,M,48.0,M,,*50\r\n$GPGSA,A,3,10,07,05,02,29,04,08,1"
+	"3,,,,,1.72,1.03,1.38*0A\r\n$GPGSV,3,1,11,16,52,215,45,18,08,099,41"
+	",07,62,263,35,03,53,105,25*7C\r\n$GPGSV,3,2,11,29,23,139,23,06,62,"
+	"144,25,22,13,207,18,17,65,256,25*71\r\n$GPGSV,3,3,11,21,76,286,17,"
+	"27,38,075,19,01,54,004,38*4A\r\n$GPGLL,4717.11370,N,00833.91759,E,"
+	"092642.00,A,A*68\r\n$GPRMC,092643.00,A,4717.11482,N,00833.91764,E,"
+	"10.202,77.52,171026,,,A*6F\r\n$GPVTG,77.52,T,,M,10.202,N,18.895,K,"
+	"A*06\r\n$GPGGA,092643.00,4717.11482,N,00833.91764,E,1,08,1.01,524."
+	"7,M,48.0,M,,*58\r\n$GPGSA,A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.0"
+	"3,1.38*0A\r\n$GPGSV,3,1,11,16,52,215,45,18,08,099,41,07,62,263,35,"
+	"03,53,105,25*7C\r\n$GPGSV,3,2,11,29,23,139,23,06,62,144,25,22,13,2"
+	"07,18,17,65,256,25*71\r\n$GPGSV,3,3,11,21,76,286,17,27,38,075,19,0"
+	"1,54,004,38*4A\r\n$GPGLL,4717.11482,N,00833.91764,E,092643.00,A,A*"
+	"6D\r\n";
+
+static const char corpus_1[] PROGMEM =
+	"$GPGGA,010000.00,3352.12893,S,15112.55748,E,2,10,0.82,54.7,M,21."
+	"3,M,1.2,0000*58\r\n$GPVTG,146.11,T,,M,54.834,N,101.552,K,D*07\r\n$GP"
+	"GGA,010000.10,3352.12961,S,15112.55691,E,2,10,0.82,45.0,M,21.3,M"
+	",1.2,0000*57\r\n$GPVTG,237.32,T,,M,63.730,N,118.029,K,D*0D\r\n$GPGGA"
+	",010000.20,3352.12927,S,15112.55630,E,2,10,0.82,48.0,M,21.3,M,1."
+	"2,0000*50\r\n$GPVTG,208.07,T,,M,48.975,N,90.701,K,D*3D\r\n$GPGGA,010"
+	"000.30,3352.12993,S,15112.55676,E,2,10,0.82,25.1,M,21.3,M,1.2,00"
+	"00*56\r\n$GPVTG,329.42,T,,M,48.270,N,89.395,K,D*31\r\n$GPGGA,010000."
+	"40,3352.12974,S,15112.55645,E,2,10,0.82,49.2,M,21.3,M,1.2,0000*5"
+	"1\r\n$GPVTG,22.89,T,,M,55.098,N,102.041,K,D*3E\r\n$GPGGA,010000.50,3"
+	"352.13059,S,15112.55693,E,2,10,0.82,27.7,M,21.3,M,1.2,0000*51\r\n$"
+	"GPVTG,289.47,T,,M,46.622,N,86.344,K,D*31\r\n$GPGGA,010000.60,3352."
+	"13154,S,15112.55807,E,2,10,0.82,54.3,M,21.3,M,1.2,0000*5D\r\n$GPVT"
+	"G,34.32,T,,M,64.067,N,118.651,K,D*37\r\n$GPGGA,010000.70,3352.1309"
+	"4,S,15112.55691,E,2,10,0.82,45.3,M,21.3,M,1.2,0000*50\r\n$GPVTG,11"
+	"9.39,T,,M,64.792,N,119.995,K,D*09\r\n$GPGGA,010000.80,3352.13055,S"
+	",15112.55684,E,2,10,0.82,56.6,M,21.3,M,1.2,0000*51\r\n$GPVTG,256.0"
+	"3,T,,M,57.323,N,106.162,K,D*08\r\n$GPGGA,010000.90,3352.13139,S,15"
+	"112.55649,E,2,10,0.82,35.1,M,21.3,M,1.2,0000*58\r\n$GPVTG,25.36,T,"
+	",M,62.030,N,114.879,K,D*3F\r\n$GPGGA,010001.00,3352.13122,S,15112."
+	"55651,E,2,10,0.82,54.3,M,21.3,M,1.2,0000*56\r\n$GPVTG,40.24,T,,M,4"
+	"7.182,N,87.382,K,D*04\r\n$GPGGA,010001.10,3352.13167,S,15112.55731"
+	",E,2,10,0.82,21.2,M,21.3,M,1.2,0000*52\r\n$GPVTG,80.26,T,,M,57.043"
+	",N,105.643,K,D*34\r\n$GPGGA,010001.20,3352.13057,S,15112.55792,E,2"
+	",10,0.82,24.2,M,21.3,M,1.2,0000*5F\r\n$GPVTG,128.90,T,,M,57.249,N,"
+	"106.025,K,D*07\r\n$GPGGA,010001.30,3352.13138,S,15112.55713,E,2,10"
+	",0.82,51.1,M,21.3,M,1.2,0000*5E\r\n$GPVTG,142.03,T,,M,51.233,N,94."
+	"883,K,D*34\r\n$GPGGA,010001.40,3352.13256,S,15112.55800,E,2,10,0.8"
+	"2,45.6,M,21.3,M,1.2,0000*5D\r\n$GPVTG,290.59,T,,M,50.206,N,92.982,"
+	"K,D*36\r\n$GPGGA,010001.50,3352.13371,S,15112.55735,E,2,10,0.82,30"
+	".4,M,21.3,M,1.2,0000*51\r\n$GPVTG,168.14,T,,M,57.947,N,107.317,K,D"
+	"*09\r\n";
+
+static const char corpus_2[] PROGMEM =
+	"$GPRMC,092640.00,A,4717.11412,N,00833.91608,E,30.384,77.52,17102"
+	"6,,,A*63\r\n$GPVTG,77.52,T,,M,30.384,N,56.271,K,A*01\r\n$G92640.00,4"
+	"717.11412,N,00833.91608,E,1,08,1.01,474.5,M,48.0,M,,*5F\r\n$GPGSA,"
+	"A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.03,1.38*0A\r\n$GPGSV,3,1,11"
+	",29,35,333,41,12,56,315,28,08,18,002,21,21,52,225,47*7F\r\n$GPGSV,"
+	"3,2,11,15,67,303,12,11,79,294,43,02,30,075,37,07,43,335,15*7E\r\n$"
+	"GPGSV,3,3,11,04,21,184,25,17,67,064,32,06,52,060,13*45\r\n$GPGLL,4"
+	"717.11412,N,00833.91608,E,092640.00,A,A*6C\r\n$GPRMC,092641.00,A,4"
+	"717.11400,N,00833.91593,E,18.895,77.52,171026,,,A*61\r\n$GPVTG,77."
+	"52,T,,M,18.895,N,34.993,K,A*03\r\n$GPGGA,092641.00,4717.11400,N,00"
+	"833.91593,E,1,08,1.01,420.0,M,48.0,M,,*58\r\n$GPGSA,A,3,10,07,05,0"
+	"2,29,04,08,13,,,,,1.2,1.03,1.38*0A\r\n$GPGSV,3,1,11,29,35,333,41,1"
+	"2,56,315,28,08,18,002,21,21,52,225,47*7F\r\n$GPGSV,3,2,11,15,67,30"
+	"3,12,11,79,294,43,02,30,075,37,07,43,335,15*7E\r\n$GPGSV,3,3,11,04"
+	",21,184,25,17,67,064,32,06,52,060,13*45\r\n$GPGLL,4717.11400,N,008"
+	"33.91593,E,092641.00,A,A*6F\r\n$GPRMC,092642.00,A,4717.11398,N,008"
+	"33.91671,E,10.384,77.52,171026,,,A*68\r\n$GPVTG,77.52,T,,M,10.384,"
+	"N,19.231,K,A*0C\r\n$GPGGA,092642.00,4717.11398,N,00833.91671,E,1,0"
+	"8,1.01,570.3,M,48.0,M,,*55\r\n$GPGSA,A,3,10,07,05,02,29,04,08,13,,"
+	",,,1.72,1.03,1.38*0A\r\n$GPGSV,3,1,11,29,35,333,41,12,56,315,28,08"
+	",18,002,21,21,52,225,47*7F\r\n$GPGSV,3,2,11,15,67,303,12,11,79,294"
+	",43,02,30,075,37,07,43,335,15*7E\r\n$GPGSV,3,3,11,04,21,184,25,17,"
+	"67,064,32,06,52,060,13*45\r\n$GPGLL,4717.11398,N,00833.91671,E,092"
+	"642.00,A,A*65\r\n$GPRMC,092643.00,A,4717.11343,N,00833.91657,E,7.3"
+	"36,77.52,171026,,,A*54\r\n$GPVTG,77.52,T,,M,7.336,N,13.585,K,A*31\r"
+	"\n$GPGGA,092643.00,4717.11343,N,00833.91657,E,1,08,1.01,530.7,M,4"
+	"8.0,M,,*56\r\n$GPGSA,A,3,10,07,05,02,29,04,08,13,,,,,1.72,1.03,1.3"
+	"8*0A\r\n$GPGSV,3,1,11,29,35,333,41,12,56,315,28,08,18,002,21,21,52"
+	",225,47*7F\r\n$GPGSV,3,2,11,15,67,303,12,11,79,294,43,02,30,075,37"
+	",07,43,335,15*7E\r\n$GPGSV,3,3,11,04,21,184,25,17,67,064,32,06,52,"
+	"060,13*45\r\n$GPGLL,4717$GPRMC,0926440,A,4717.11431,N,00833.91738,"
+	"E,30.468,77.52,171026,,,A*61\r\n";
+
+static const char corpus_3[] PROGMEM =
+	"$GPTXT,01,01,02,u-blox ag - www.u-blox.com*50\r\n$GPTXT,01,01,02,H"
+	"W  UBX-G60xx  00040007 *FF7FFFFFp*79\r\n$GPTXT,01,01,02,ROM CORE 7"
+	".03 (45969) Mar 17 2011 16:18:34*59\r\n$GPTXT,01,01,02,ANTSUPERV=A"
+	"C SD PDoS SR*20\r\n$GPTXT,01,01,02,ANTSTATUS=OK*3B\r\n$GPRMC,,V,,,,,"
+	",,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.99,,,,,,*48\r"
+	"\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n$GPGSV,1,1,01,03,2"
+	"0,042,*4F\r\n$GPGLL,,,,,,V,N*64\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,"
+	",,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,"
+	",,,,,99.99,99.99,99.99*30\r\n$GPGSV,1,1,01,03,20,042,*4F\r\n$GPGLL,,"
+	",,,,V,N*64\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA"
+	",,,,,,0,00,99.99,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99"
+	".99*30\r\n$GPGSV,1,1,01,03,20,042,*4F\r\n$GPGLL,,,,,,V,N*64\r\n$GPRMC,"
+	",V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.99,,,"
+	",,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n$GPGSV,1,1,"
+	"01,03,20,042,*4F\r\n$GPGLL,,,,,,V,N*64\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$"
+	"GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n$GPGSA,A,1,"
+	",,,,,,,,,,,,99.99,99.99,99.99*30\r\n$GPGSV,1,1,01,03,20,042,*4F\r\n$"
+	"GPGLL,,,,,,V,N*64\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r"
+	"\n$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,9"
+	"9.99,99.99*30\r\n$GPGSV,1,1,02,03,20,042,,10,23,073,*78\r\n$GPGLL,,,"
+	",,,V,N*64\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,"
+	",,,,,0,00,99.99,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99."
+	"99*30\r\n$GPGSV,1,1,02,03,20,042,,10,23,073,*78\r\n$GPGLL,,,,,,V,N*6"
+	"4\r\n$GPRMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,0"
+	"0,99.99,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n$"
+	"GPGSV,1,1,02,03,20,042,37,10,23,073,*7C\r\n$GPGLL,,,,,,V,N*64\r\n$GP"
+	"RMC,,V,,,,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.9"
+	"9,,,,,,*48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n$GPGSV,"
+	"1,1,02,03,20,042,,10,23,073,*78\r\n$GPGLL,,,,,,V,N*64\r\n$GPRMC,,V,,"
+	",,,,,,,,N*53\r\n$GPVTG,,,,,,,,,N*30\r\n$GPGGA,,,,,,0,00,99.99,,,,,,*"
+	"48\r\n$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n$GPGSV,1,1,02,0"
+	"3,20,042,,10,23,073,*78\r\n$GPGLL,,,,,,V,N*64\r\n";
+
+static const char corpus_4[] PROGMEM =
+	"$GNRMC,120000.00,A,5128.67558,N,00000.09361,W,0.913,,171026,,,A,"
+	"V*07\r\n$GNVTG,,T,,M,0.913,N,1.692,K,A*3A\r\n$GNGGA,120000.00,5128.6"
+	"7558,N,00000.09361,W,1,24,0.61,14.6,M,45.4,M,,*6E\r\n$GNGSA,A,3,20"
+	",13,01,06,12,11,31,15,30,,,,1.02,0.61,0.82,1*0E\r\n$GNGSA,A,3,66,8"
+	"2,88,79,65,75,74,,,,,,1.02,0.61,0.82,2*0A\r\n$GNGSA,A,3,32,03,24,3"
+	"5,19,02,,,,,,,1.02,0.61,0.82,3*05\r\n$GNGSA,A,3,15,02,14,27,18,,,,"
+	",,,,1.02,0.61,0.82,4*05\r\n$GPGSV,3,1,09,20,11,241,16,13,50,074,36"
+	",01,32,285,24,06,66,082,18*7D\r\n$GPGSV,3,2,09,12,22,139,16,11,12,"
+	"169,13,31,54,083,23,15,33,092,42*71\r\n$GPGSV,3,3,09,30,35,305,43*"
+	"44\r\n$GLGSV,2,1,07,66,26,063,40,82,66,304,17,88,62,316,43,79,39,2"
+	"31,39*66\r\n$GLGSV,2,2,07,65,80,105,21,75,37,218,24,74,79,072,23*5"
+	"C\r\n$GAGSV,2,1,06,32,28,125,22,03,19,029,23,24,48,307,34,35,82,30"
+	"7,41*65\r\n$GAGSV,2,2,06,19,32,289,33,02,14,275,34*64\r\n$GBGSV,2,1,"
+	"05,15,09,015,41,02,66,331,30,14,61,292,22,27,54,214,31*6B\r\n$GBGS"
+	"V,2,2,05,18,43,189,47*53\r\n$GNGLL,5128.67558,N,00000.09361,W,1200"
+	"00.00,A,A*6C\r\n$PUBX,00,120000.00,5128.67558,N,00000.09361,W,10.4"
+	"10,G3,2.1,3.0,1.692,77.52,0.000,,0.61,0.82,0.45,24,0,0*4E\r\n$GNRM"
+	"C,120001.00,A,5128.67612,N,00000.09402,W,3.471,,171026,,,A,V*03\r"
+	"\n$GNVTG,,T,,M,3.471,N,6.429,K,A*35\r\n$GNGGA,120001.00,5128.67612,"
+	"N,00000.09402,W,1,24,0.61,21.5,M,45.4,M,,*65\r\n$GNGSA,A,3,20,13,0"
+	"1,06,12,11,31,15,30,,,,1.02,0.61,0.82,1*0E\r\n$GNGSA,A,3,66,82,88,"
+	"79,65,75,74,,,,,,1.02,0.61,0.82,2*0A\r\n$GNGSA,A,3,32,03,24,35,19,"
+	"02,,,,,,,1.02,0.61,0.82,3*05\r\n$GNGSA,A,3,15,02,14,27,18,,,,,,,,1"
+	".02,0.61,0.82,4*05\r\n$GPGSV,3,1,09,20,11,241,16,13,50,074,36,01,3"
+	"2,285,24,06,66,082,18*7D\r\n$GPGSV,3,2,09,12,22,139,16,11,12,169,1"
+	"3,31,54,083,23,15,33,092,42*71\r\n$GPGSV,3,3,09,30,35,305,43*44\r\n$"
+	"GLGSV,2,1,07,66,26,063,40,82,66,304,17,88,62,316,43,79,39,231,39"
+	"*66\r\n$GLGSV,2,2,07,65,80,105,21,75,37,218,24,74,79,072,23*5C\r\n$G"
+	"AGSV,2,1,06,32,28,125,22,03,19,029,23,24,48,307,34,35,82,307,41*"
+	"65\r\n$GAGSV,2,2,06,19,32,289,33,02,14,275,34*64\r\n$GBGSV,2,1,05,15"
+	",09,015,41,02,66,331,30,14,61,292,22,27,54,214,31*6B\r\n$GBGSV,2,2"
+	",05,18,43,189,47*53\r\n";
+
+static const char corpus_name_0[] PROGMEM = "clean_1hz.nmea";
+static const char corpus_name_1[] PROGMEM = "clean_10hz.nmea";
+static const char corpus_name_2[] PROGMEM = "noisy.nmea";
+static const char corpus_name_3[] PROGMEM = "nofix_startup.nmea";
+static const char corpus_name_4[] PROGMEM = "multi_gnss.nmea";
+
+/**
+ * @brief One corpus excerpt.
+ */
+typedef struct {
+	const char* name; /**< File name, in flash */
+	const char* data; /**< Sentences, in flash */
+	uint16_t length;  /**< Bytes in data */
+} nf_bench_corpus_t;
+
+static const nf_bench_corpus_t corpus[] PROGMEM = {
+	{corpus_name_0, corpus_0, sizeof(corpus_0) - 1},
+	{corpus_name_1, corpus_1, sizeof(corpus_1) - 1},
+	{corpus_name_2, corpus_2, sizeof(corpus_2) - 1},
+	{corpus_name_3, corpus_3, sizeof(corpus_3) - 1},
+	{corpus_name_4, corpus_4, sizeof(corpus_4) - 1}
+};
+
+#endif /* NF_BENCH_CORPUS_H_ */
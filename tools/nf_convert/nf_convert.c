@@ -0,0 +1,678 @@
+/**
+ * @file nf_convert.c
+ * @brief Host tool converting recorded NMEA logs to CSV or binary fix records.
+ *
+ * The logs are parsed by the same nf_parse.c that runs on the device, fed through a file
+ * nf_byte_source_t. One record is written per checksum-valid GGA sentence, carrying the speed
+ * of the last VTG sentence before it.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -pthread -o nf_convert nf_convert.c ../libnf/nf_map.c ../libnf/nf_scan.c ../libnf/nf_view.c ../../wfx_sw/wfx_sw/nf/nf_parse.c
+ *
+ * With -s the nf_scan block scanner runs first: it validates every sentence with SIMD
+ * compares and only GGA and VTG, the sentences that make up a record, reach the parser.
+ *
+ * With -j the input is split into byte ranges parsed on that many threads, each with its own
+ * parser state (NF_THREAD_LOCAL), and the records are merged back in input order. The output
+ * and the counts are the same as with one thread.
+ *
+ * With -m each file is mapped with nf_map_open() and scanned in place. Records are built from
+ * nf_view.h field views into the mapping, so no byte is copied before a record is written.
+ *
+ * Usage:
+ *   nf_convert [-b] [-s | -m | -j threads] [-o output] [input ...]
+ *   -b         write nf_fix_record_t records instead of CSV
+ *   -s         use the nf_scan front end
+ *   -m         map the input files instead of reading them
+ *   -j threads parse on worker threads
+ *   -o output  output file, default stdout
+ *   input      NMEA log files, default stdin
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "../libnf/nf_map.h"
+#include "../libnf/nf_scan.h"
+#include "../libnf/nf_view.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_parse.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_types.h"
+
+//defines
+#define INPUT_BUFFER_SIZE (1 << 20)  /**< stdio buffer per input file */
+#define OUTPUT_BUFFER_SIZE (1 << 20) /**< Records are collected here before each fwrite */
+#define CSV_MAX_RECORD 96            /**< Longest CSV line written */
+#define SCAN_BLOCK_SIZE (1 << 20)   /**< Bytes read per nf_scan_block() call */
+#define SCAN_SENTENCES (SCAN_BLOCK_SIZE / 16)
+#define SCAN_FIELDS (SCAN_SENTENCES * 8)
+#define RANGE_SIZE (16 << 20)       /**< Bytes per worker thread and round with -j */
+#define CARRY_LIMIT 4096             /**< Longest unterminated tail moved to the next round */
+#define MAX_THREADS 64
+#define MAP_WINDOW (1UL << 30)       /**< Bytes of a mapping per nf_scan_block() call, offsets are 32 bit */
+#define CSV_HEADER "utc_ms,lat_deg,lon_deg,alt_m,fix,sats,hdop,speed_kmh\n"
+
+/**
+ * @brief Binary fix record, little-endian on the usual hosts, 24 bytes.
+ */
+typedef struct {
+	uint32_t utc_ms;        /**< Milliseconds since midnight UTC */
+	int32_t lat_udeg;       /**< Latitude in microdegrees, negative south */
+	int32_t lon_udeg;       /**< Longitude in microdegrees, negative west */
+	int32_t alt_dm;         /**< Altitude above sea level in decimetres */
+	uint16_t hdop_x10;      /**< HDOP times ten */
+	uint16_t speed_kmh_x10; /**< Speed over ground in tenths of km/hr */
+	uint8_t fix;            /**< GGA fix quality, 0 for none */
+	uint8_t sats;           /**< Satellites used */
+	uint8_t reserved[2];    /**< Zero */
+} nf_fix_record_t;
+
+/**
+ * @brief One byte range of the input, parsed by a worker thread with -j.
+ */
+typedef struct {
+	const uint8_t* data;           /**< First byte, a '$' unless the range starts the input */
+	size_t length;                 /**< Bytes in the range */
+	int cut;                       /**< The range ends at the '$' of a following range, not at the end of input */
+	nf_fix_record_t* records;      /**< Records published in the range, in order */
+	size_t record_count;           /**< Records kept */
+	size_t record_capacity;        /**< Room in records */
+	size_t leading;                /**< Records before the first VTG of the range, their speed comes from the range before */
+	int have_speed;                /**< A VTG was published in the range */
+	uint16_t speed_kmh_x10;        /**< Speed of the last VTG in the range */
+	unsigned long accepted;        /**< Sentences accepted */
+	unsigned long rejected;        /**< Sentences rejected */
+	nf_scan_sentence_t* sentences; /**< Scanner arrays of the worker with -s */
+	uint32_t* fields;
+} range_job_t;
+
+//local static
+static char out_buffer[OUTPUT_BUFFER_SIZE];
+static size_t out_length;
+static FILE* out_file;
+static int binary_output;
+static unsigned long long record_count;
+static unsigned long long byte_count;
+static int scan_front_end;
+static unsigned long scan_sentences;  /**< Valid sentences found by the scanner */
+static nf_scan_result_t scan_result;
+static int thread_count;                    /**< Worker threads, 0 to parse on the main thread */
+static unsigned long thread_accepted;       /**< Sentences accepted by the workers */
+static unsigned long thread_rejected;       /**< Sentences rejected by the workers */
+static uint16_t carried_speed;              /**< Speed of the last VTG merged so far */
+static int map_input;                       /**< Scan mapped files in place with -m */
+static nf_field_view_t speed_view;          /**< Speed field of the last VTG in the current mapping, ptr 0 if none */
+static _Thread_local range_job_t* current_job; /**< Range of the calling worker thread, 0 on the main thread */
+
+/**
+ * @brief Byte source reading a stdio stream.
+ */
+static uint16_t file_read(void* ctx, uint8_t* buf, uint16_t size){
+	uint16_t count = (uint16_t)fread(buf, 1, size, (FILE*)ctx);
+	byte_count += count;
+	return count;
+}
+
+/**
+ * @brief Write the collected records out.
+ */
+static void flush_output(){
+	if (out_length && (fwrite(out_buffer, 1, out_length, out_file) != out_length)){
+		perror("nf_convert: write");
+		exit(1);
+	}
+	out_length = 0;
+}
+
+/**
+ * @brief Parse a fixed point field such as "1.01" or "0.008  " as an integer in tenths.
+ * @param str Field characters, blank padded, not terminated.
+ * @param size Number of characters.
+ */
+static uint16_t parse_tenths(const char* str, uint8_t size){
+	uint32_t value = 0;
+	uint8_t i = 0;
+
+	while ((i < size) && (str[i] >= '0') && (str[i] <= '9')){
+		value = (value * 10) + (str[i++] - '0');
+	}
+	value *= 10;
+	if ((i + 1 < size) && (str[i] == '.') && (str[i + 1] >= '0') && (str[i + 1] <= '9')){
+		value += str[i + 1] - '0';
+	}
+	return (value > 0xFFFF) ? 0xFFFF : (uint16_t)value;
+}
+
+/**
+ * @brief Convert the "hhmmss.ss" UTC field to milliseconds since midnight.
+ */
+static uint32_t parse_utc_ms(const char* str, uint8_t size){
+	uint32_t ms = 0;
+
+	for (uint8_t i = 0; i < 6; i++){
+		if ((i >= size) || (str[i] < '0') || (str[i] > '9')){
+			return 0;
+		}
+	}
+	ms = ((str[0] - '0') * 10 + (str[1] - '0')) * 3600000UL;
+	ms += ((str[2] - '0') * 10 + (str[3] - '0')) * 60000UL;
+	ms += ((str[4] - '0') * 10 + (str[5] - '0')) * 1000UL;
+	if ((size > 7) && (str[6] == '.') && (str[7] >= '0') && (str[7] <= '9')){
+		ms += (str[7] - '0') * 100;
+		if ((size > 8) && (str[8] >= '0') && (str[8] <= '9')){
+			ms += (str[8] - '0') * 10;
+		}
+	}
+	return ms;
+}
+
+/**
+ * @brief Append an unsigned decimal number.
+ * @return Characters written.
+ */
+static int put_uint(char* str, uint32_t value){
+	char digits[10];
+	int count = 0;
+	int i;
+
+	do {
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+	for (i = 0; i < count; i++){
+		str[i] = digits[count - 1 - i];
+	}
+	return count;
+}
+
+/**
+ * @brief Append a signed fixed point number with frac_digits decimals.
+ * @return Characters written.
+ */
+static int put_fixed(char* str, int32_t value, uint32_t scale, int frac_digits){
+	uint32_t magnitude;
+	uint32_t frac;
+	int pos = 0;
+
+	if (value < 0){
+		str[pos++] = '-';
+		magnitude = (uint32_t)(-(int64_t)value);
+	} else {
+		magnitude = (uint32_t)value;
+	}
+	pos += put_uint(str + pos, magnitude / scale);
+	str[pos++] = '.';
+	frac = magnitude % scale;
+	for (int i = frac_digits - 1; i >= 0; i--){
+		str[pos + i] = '0' + (frac % 10);
+		frac /= 10;
+	}
+	return pos + frac_digits;
+}
+
+/**
+ * @brief Append one record to the output buffer as CSV or binary.
+ */
+static void write_record(const nf_fix_record_t* record){
+	if (binary_output){
+		if (out_length + sizeof(*record) > OUTPUT_BUFFER_SIZE){
+			flush_output();
+		}
+		memcpy(out_buffer + out_length, record, sizeof(*record));
+		out_length += sizeof(*record);
+		return;
+	}
+
+	if (out_length + CSV_MAX_RECORD > OUTPUT_BUFFER_SIZE){
+		flush_output();
+	}
+	char* line = out_buffer + out_length;
+	int pos = put_uint(line, record->utc_ms);
+	line[pos++] = ',';
+	pos += put_fixed(line + pos, record->lat_udeg, 1000000, 6);
+	line[pos++] = ',';
+	pos += put_fixed(line + pos, record->lon_udeg, 1000000, 6);
+	line[pos++] = ',';
+	pos += put_fixed(line + pos, record->alt_dm, 10, 1);
+	line[pos++] = ',';
+	pos += put_uint(line + pos, record->fix);
+	line[pos++] = ',';
+	pos += put_uint(line + pos, record->sats);
+	line[pos++] = ',';
+	pos += put_fixed(line + pos, record->hdop_x10, 10, 1);
+	line[pos++] = ',';
+	pos += put_fixed(line + pos, record->speed_kmh_x10, 10, 1);
+	line[pos++] = '\n';
+	out_length += pos;
+}
+
+/**
+ * @brief Keep the records of a worker's range until the main thread merges them.
+ */
+static void job_append(range_job_t* job, const nf_fix_record_t* record){
+	if (job->record_count == job->record_capacity){
+		job->record_capacity = job->record_capacity ? job->record_capacity * 2 : 4096;
+		job->records = realloc(job->records, job->record_capacity * sizeof(nf_fix_record_t));
+		if (!job->records){
+			perror("nf_convert");
+			exit(1);
+		}
+	}
+	job->records[job->record_count++] = *record;
+}
+
+/**
+ * @brief Publish callback: turn every GGA into one output record.
+ * Records go straight to the output, or to the range job of the calling worker thread.
+ */
+static void on_publish(nf_msg_type_t type){
+	const nav_solution_t* nav = nf_nav_solution();
+	nf_fix_record_t record;
+
+	if (type == NF_MSG_VTG){
+		if (current_job){ //remembered for the records of the next range
+			current_job->have_speed = 1;
+			current_job->speed_kmh_x10 = parse_tenths(nav->speed, VTG_SPEED_BUFER_SIZE);
+		}
+		return; //VTG only updates the speed carried by the next record
+	}
+	if (type != NF_MSG_GGA){
+		return;
+	}
+	memset(&record, 0, sizeof(record));
+	record.utc_ms = parse_utc_ms(nav->utc_time, GGA_UTC_BUFFER_SIZE);
+	record.lat_udeg = nav->latitude_udeg;
+	record.lon_udeg = nav->longitude_udeg;
+	record.alt_dm = nav->msl_altitude_dm;
+	record.hdop_x10 = parse_tenths(nav->hdop, GGA_HDOP_BUFFER_SIZE);
+	record.speed_kmh_x10 = parse_tenths(nav->speed, VTG_SPEED_BUFER_SIZE);
+	record.fix = (nav->position_fix_indicator[0] >= '0') && (nav->position_fix_indicator[0] <= '9') ? nav->position_fix_indicator[0] - '0' : 0;
+	record.sats = (uint8_t)(parse_tenths(nav->satellites_used, GGA_SV_USD_BUFFER_SIZE) / 10);
+
+	if (current_job){
+		if (!current_job->have_speed){
+			current_job->leading++; //speed belongs to a VTG in an earlier range
+		}
+		job_append(current_job, &record);
+		return;
+	}
+	record_count++;
+	write_record(&record);
+}
+
+/**
+ * @brief Scan a block and pass its GGA and VTG sentences to the parser.
+ * @return Bytes consumed; an unterminated sentence at the end is left over.
+ */
+static size_t feed_scanned(const uint8_t* block, size_t length, nf_scan_result_t* result){
+	nf_scan_block(block, length, result);
+	for (size_t i = 0; i < result->sentence_count; i++){
+		const nf_scan_sentence_t* sentence = &result->sentences[i];
+		const uint8_t* id = block + result->fields[sentence->first_field];
+
+		if ((sentence->checksum_pos - sentence->start > 6) && (id[5] == ',')
+			&& ((!memcmp(id + 2, "GGA", 3)) || (!memcmp(id + 2, "VTG", 3)))){
+			for (uint32_t k = sentence->start; k < sentence->end; k++){
+				nf_parse_char((char)block[k]);
+			}
+		}
+	}
+	return result->consumed;
+}
+
+/**
+ * @brief Parse one open stream to the end.
+ */
+static void convert_stream(FILE* in){
+	nf_byte_source_t source = {file_read, in};
+
+	setvbuf(in, 0, _IOFBF, INPUT_BUFFER_SIZE);
+	nf_parse_source(&source);
+	if (ferror(in)){
+		perror("nf_convert: read");
+		exit(1);
+	}
+}
+
+/**
+ * @brief Parse one open stream to the end through the nf_scan front end.
+ * Blocks are scanned whole; an unterminated sentence at the end of a block is moved to the
+ * front of the buffer and completed by the next read.
+ */
+static void convert_stream_scanned(FILE* in){
+	static uint8_t block[SCAN_BLOCK_SIZE];
+	size_t length = 0;
+	size_t consumed;
+	size_t count;
+
+	while ((count = fread(block + length, 1, SCAN_BLOCK_SIZE - length, in)) > 0){
+		byte_count += count;
+		length += count;
+		consumed = feed_scanned(block, length, &scan_result);
+		scan_sentences += scan_result.sentence_count;
+		memmove(block, block + consumed, length - consumed);
+		length -= consumed;
+	}
+	if (ferror(in)){
+		perror("nf_convert: read");
+		exit(1);
+	}
+}
+
+/**
+ * @brief Build a record from the field views of a GGA sentence.
+ * Only called for records that are written; the views are decoded here and nowhere else.
+ */
+static void materialise_record(const uint8_t* data, const nf_scan_sentence_t* gga, nf_fix_record_t* record){
+	nf_field_view_t utc = nf_view_field(data, &scan_result, gga, 1);
+	nf_field_view_t fix = nf_view_field(data, &scan_result, gga, 6);
+	nf_field_view_t sats = nf_view_field(data, &scan_result, gga, 7);
+	nf_field_view_t hdop_view = nf_view_field(data, &scan_result, gga, 8);
+
+	memset(record, 0, sizeof(*record));
+	record->utc_ms = parse_utc_ms(utc.ptr, utc.length < GGA_UTC_BUFFER_SIZE ? utc.length : GGA_UTC_BUFFER_SIZE);
+	record->lat_udeg = nf_view_udeg(nf_view_field(data, &scan_result, gga, 2), nf_view_field(data, &scan_result, gga, 3));
+	record->lon_udeg = nf_view_udeg(nf_view_field(data, &scan_result, gga, 4), nf_view_field(data, &scan_result, gga, 5));
+	record->alt_dm = nf_view_fixed(nf_view_field(data, &scan_result, gga, 9), 1);
+	record->hdop_x10 = parse_tenths(hdop_view.ptr, hdop_view.length < GGA_HDOP_BUFFER_SIZE ? hdop_view.length : GGA_HDOP_BUFFER_SIZE);
+	if (speed_view.ptr){
+		record->speed_kmh_x10 = parse_tenths(speed_view.ptr, speed_view.length < VTG_SPEED_BUFER_SIZE ? speed_view.length : VTG_SPEED_BUFER_SIZE);
+	} else {
+		record->speed_kmh_x10 = carried_speed;
+	}
+	record->fix = (fix.length && (fix.ptr[0] >= '0') && (fix.ptr[0] <= '9')) ? fix.ptr[0] - '0' : 0;
+	record->sats = (uint8_t)(parse_tenths(sats.ptr, sats.length < GGA_SV_USD_BUFFER_SIZE ? sats.length : GGA_SV_USD_BUFFER_SIZE) / 10);
+}
+
+/**
+ * @brief Convert one file by scanning its mapping in place.
+ * Nothing is read into a buffer and the character parser does not run: sentences are found and
+ * checked by nf_scan_block() and records are built straight from the GGA and VTG field views.
+ */
+static void convert_mapped(const char* name){
+	nf_map_t map;
+	size_t offset = 0;
+
+	if (nf_map_open(name, &map)){
+		perror(name);
+		exit(1);
+	}
+	byte_count += map.length;
+	while (offset < map.length){
+		size_t window = (map.length - offset > MAP_WINDOW) ? MAP_WINDOW : map.length - offset;
+		const uint8_t* data = map.data + offset;
+
+		nf_scan_block(data, window, &scan_result);
+		scan_sentences += scan_result.sentence_count;
+		for (size_t i = 0; i < scan_result.sentence_count; i++){
+			const nf_scan_sentence_t* sentence = &scan_result.sentences[i];
+			nf_field_view_t id = nf_view_field(data, &scan_result, sentence, 0);
+			nf_fix_record_t record;
+
+			if (nf_view_is_type(id, "VTG")){
+				speed_view = nf_view_field(data, &scan_result, sentence, 7);
+			} else if (nf_view_is_type(id, "GGA")){
+				materialise_record(data, sentence, &record);
+				record_count++;
+				write_record(&record);
+			}
+		}
+		if (!scan_result.consumed){
+			break; //only an unterminated sentence is left
+		}
+		offset += scan_result.consumed;
+	}
+	if (speed_view.ptr){ //the view dies with the mapping, the next file starts from its value
+		carried_speed = parse_tenths(speed_view.ptr, speed_view.length < VTG_SPEED_BUFER_SIZE ? speed_view.length : VTG_SPEED_BUFER_SIZE);
+		speed_view.ptr = 0;
+	}
+	nf_map_close(&map);
+}
+
+/**
+ * @brief Worker thread: parse one range with a parser of its own.
+ * The parser state is thread local, so every worker starts from nf_parse_reset() and skips
+ * to the '$' its range starts with, the same state the main parser is in at that byte.
+ */
+static void* convert_range(void* arg){
+	range_job_t* job = (range_job_t*)arg;
+
+	current_job = job;
+	nf_parse_reset();
+	nf_set_publish_callback(on_publish);
+	if (scan_front_end){
+		nf_scan_result_t result = {job->sentences, SCAN_SENTENCES, 0, job->fields, SCAN_FIELDS, 0, 0, 0};
+		size_t length = job->length + (job->cut ? 1 : 0); //the next '$' drops a sentence cut at the range end
+		size_t offset = 0;
+		size_t consumed;
+
+		while (offset < length){
+			consumed = feed_scanned(job->data + offset, length - offset, &result);
+			job->accepted += result.sentence_count;
+			if (!consumed){
+				break;
+			}
+			offset += consumed;
+		}
+		job->rejected = result.rejected;
+		return 0;
+	}
+	for (size_t i = 0; i < job->length; i++){
+		nf_parse_char((char)job->data[i]);
+	}
+	nf_parse_char('$'); //the '$' of the next range, or the end of the file
+	for (int i = 0; i < NF_NUM_MSG_TYPES; i++){
+		job->accepted += nf_accept_count[i];
+		job->rejected += nf_reject_count[i];
+	}
+	return 0;
+}
+
+/**
+ * @brief Parse one open stream on thread_count worker threads.
+ * The input is read in rounds of thread_count ranges. Every range after the first is moved
+ * forward to the next '$', so a sentence straddling a split belongs to one range only; the
+ * sentence cut off at the end of a round is carried to the start of the next one. The records
+ * are merged in range order, which gives exactly the output of the single parser.
+ */
+static void convert_stream_threaded(FILE* in){
+	static range_job_t jobs[MAX_THREADS];
+	pthread_t threads[MAX_THREADS];
+	size_t size = (size_t)thread_count * RANGE_SIZE + CARRY_LIMIT;
+	uint8_t* buffer = malloc(size);
+	size_t length = 0;
+	int eof = 0;
+
+	if (!buffer){
+		perror("nf_convert");
+		exit(1);
+	}
+	while (!eof){
+		size_t count = fread(buffer + length, 1, size - length, in);
+		size_t end;
+		size_t start = 0;
+
+		byte_count += count;
+		length += count;
+		eof = (length < size);
+		end = length;
+		if (!eof){ //keep the last sentence for the next round unless it is too long to be one
+			for (size_t i = length; (i > 0) && (length - i < CARRY_LIMIT); i--){
+				if (buffer[i - 1] == '$'){
+					end = i - 1;
+					break;
+				}
+			}
+		}
+
+		for (int t = 0; t < thread_count; t++){
+			range_job_t* job = &jobs[t];
+			size_t split = (t + 1 == thread_count) ? end : (end / thread_count) * (t + 1);
+
+			if (split < start){
+				split = start;
+			}
+			if (split < end){
+				const uint8_t* next = memchr(buffer + split, '$', end - split);
+				split = next ? (size_t)(next - buffer) : end;
+			}
+			job->data = buffer + start;
+			job->length = split - start;
+			job->cut = (split < length);
+			job->record_count = 0;
+			job->leading = 0;
+			job->have_speed = 0;
+			job->accepted = 0;
+			job->rejected = 0;
+			if (scan_front_end && !job->sentences){
+				job->sentences = malloc(SCAN_SENTENCES * sizeof(nf_scan_sentence_t));
+				job->fields = malloc(SCAN_FIELDS * sizeof(uint32_t));
+				if (!job->sentences || !job->fields){
+					perror("nf_convert");
+					exit(1);
+				}
+			}
+			if (pthread_create(&threads[t], 0, convert_range, job)){
+				fprintf(stderr, "nf_convert: cannot start thread\n");
+				exit(1);
+			}
+			start = split;
+		}
+
+		for (int t = 0; t < thread_count; t++){
+			range_job_t* job = &jobs[t];
+
+			pthread_join(threads[t], 0);
+			for (size_t i = 0; i < job->leading; i++){
+				job->records[i].speed_kmh_x10 = carried_speed;
+			}
+			for (size_t i = 0; i < job->record_count; i++){
+				write_record(&job->records[i]);
+			}
+			if (job->have_speed){
+				carried_speed = job->speed_kmh_x10;
+			}
+			record_count += job->record_count;
+			thread_accepted += job->accepted;
+			thread_rejected += job->rejected;
+		}
+
+		memmove(buffer, buffer + end, length - end);
+		length -= end;
+	}
+	if (ferror(in)){
+		perror("nf_convert: read");
+		exit(1);
+	}
+	free(buffer);
+}
+
+int main(int argc, char** argv){
+	const char* out_name = 0;
+	void (*convert)(FILE* in) = convert_stream;
+	unsigned long accepted = 0;
+	unsigned long rejected = 0;
+	struct timespec start;
+	struct timespec end;
+	int i;
+
+	for (i = 1; (i < argc) && (argv[i][0] == '-') && argv[i][1]; i++){
+		if (!strcmp(argv[i], "-b")){
+			binary_output = 1;
+		} else if (!strcmp(argv[i], "-s")){
+			scan_front_end = 1;
+		} else if (!strcmp(argv[i], "-m")){
+			map_input = 1;
+		} else if (!strcmp(argv[i], "-j") && (i + 1 < argc)){
+			thread_count = atoi(argv[++i]);
+			if ((thread_count < 1) || (thread_count > MAX_THREADS)){
+				fprintf(stderr, "nf_convert: -j takes 1 to %d threads\n", MAX_THREADS);
+				return 2;
+			}
+		} else if (!strcmp(argv[i], "-o") && (i + 1 < argc)){
+			out_name = argv[++i];
+		} else {
+			fprintf(stderr, "usage: nf_convert [-b] [-s | -m | -j threads] [-o output] [input ...]\n");
+			return 2;
+		}
+	}
+	if (map_input && (thread_count || (i == argc))){
+		fprintf(stderr, "nf_convert: -m maps input files on one thread\n");
+		return 2;
+	}
+	//a missing input must not leave a truncated output or a header-only CSV behind
+	for (int j = i; j < argc; j++){
+		FILE* in = fopen(argv[j], "rb");
+
+		if (!in){
+			perror(argv[j]);
+			return 1;
+		}
+		fclose(in);
+	}
+	out_file = out_name ? fopen(out_name, "wb") : stdout;
+	if (!out_file){
+		perror(out_name);
+		return 1;
+	}
+	if (!binary_output){
+		fputs(CSV_HEADER, out_file);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	nf_parse_reset();
+	nf_set_publish_callback(on_publish);
+	if (thread_count){
+		convert = convert_stream_threaded;
+	} else if (scan_front_end || map_input){
+		convert = convert_stream_scanned;
+		scan_result.sentences = malloc(SCAN_SENTENCES * sizeof(nf_scan_sentence_t));
+		scan_result.sentence_capacity = SCAN_SENTENCES;
+		scan_result.fields = malloc(SCAN_FIELDS * sizeof(uint32_t));
+		scan_result.field_capacity = SCAN_FIELDS;
+		if (!scan_result.sentences || !scan_result.fields){
+			perror("nf_convert");
+			return 1;
+		}
+	}
+	if (i == argc){
+		convert(stdin);
+	}
+	for (; i < argc; i++){
+		if (map_input){
+			convert_mapped(argv[i]);
+			continue;
+		}
+		FILE* in = fopen(argv[i], "rb");
+		if (!in){
+			perror(argv[i]);
+			return 1;
+		}
+		convert(in);
+		fclose(in);
+		nf_parse_char('$'); //a sentence cut off at the end of a file is not joined to the next one
+	}
+	flush_output();
+	if (out_file != stdout){
+		fclose(out_file);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	for (i = 0; i < NF_NUM_MSG_TYPES; i++){
+		accepted += nf_accept_count[i];
+		rejected += nf_reject_count[i];
+	}
+	if (thread_count){
+		accepted = thread_accepted;
+		rejected = thread_rejected;
+	} else if (scan_front_end || map_input){ //the parser saw GGA and VTG at most, the scanner saw everything
+		accepted = scan_sentences;
+		rejected = scan_result.rejected;
+	}
+	double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+	fprintf(stderr, "nf_convert: %llu bytes, %lu sentences, %lu rejected, %llu records, %.1f MB/s\n",
+		byte_count, accepted, rejected, record_count, seconds > 0 ? byte_count / seconds / 1e6 : 0.0);
+	return 0;
+}
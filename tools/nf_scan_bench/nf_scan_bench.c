@@ -0,0 +1,182 @@
+/**
+ * @file nf_scan_bench.c
+ * @brief Throughput benchmark of the nf_scan block scanner against the character parser.
+ *
+ * Each capture is read into memory once and scanned repeatedly with every scanner
+ * implementation the CPU supports; the best of the repetitions is reported. The same bytes are
+ * also run through nf_parse_char(), the byte at a time path the device uses, as the baseline.
+ * All implementations must find the same sentences; the tool fails if they do not.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -o nf_scan_bench nf_scan_bench.c ../libnf/nf_scan.c ../../wfx_sw/wfx_sw/nf/nf_parse.c
+ *
+ * Usage:
+ *   nf_scan_bench [-r repetitions] capture ...
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../libnf/nf_scan.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_parse.h"
+#include "../../wfx_sw/wfx_sw/nf/nf_types.h"
+
+//defines
+#define DEFAULT_REPETITIONS 5
+#define SENTENCE_CAPACITY (1 << 16)
+#define FIELD_CAPACITY (SENTENCE_CAPACITY * 24)
+
+/**
+ * @brief Totals of one pass over a capture, compared between implementations.
+ */
+typedef struct {
+	unsigned long sentences; /**< Valid sentences */
+	unsigned long rejected;  /**< Dropped sentences */
+	unsigned long fields;    /**< Field offsets produced */
+	uint64_t digest;         /**< Hash of all sentence and field offsets */
+} scan_totals_t;
+
+//local static
+static nf_scan_sentence_t sentences[SENTENCE_CAPACITY];
+static uint32_t fields[FIELD_CAPACITY];
+
+static double now(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Read a whole file into a malloc'd buffer.
+ */
+static uint8_t* load(const char* name, size_t* length){
+	FILE* in = fopen(name, "rb");
+	uint8_t* data;
+
+	if (!in){
+		perror(name);
+		exit(1);
+	}
+	fseek(in, 0, SEEK_END);
+	*length = (size_t)ftell(in);
+	fseek(in, 0, SEEK_SET);
+	data = malloc(*length ? *length : 1);
+	if (!data || (fread(data, 1, *length, in) != *length)){
+		fprintf(stderr, "%s: read failed\n", name);
+		exit(1);
+	}
+	fclose(in);
+	return data;
+}
+
+/**
+ * @brief Scan a whole capture block by block, as an ingestion loop would.
+ */
+static scan_totals_t scan_all(const uint8_t* data, size_t length){
+	nf_scan_result_t result = {sentences, SENTENCE_CAPACITY, 0, fields, FIELD_CAPACITY, 0, 0, 0};
+	scan_totals_t totals = {0, 0, 0, 1469598103934665603ULL};
+	size_t offset = 0;
+
+	while (offset < length){
+		nf_scan_block(data + offset, length - offset, &result);
+		for (size_t i = 0; i < result.sentence_count; i++){
+			totals.digest = (totals.digest ^ (offset + sentences[i].start)) * 1099511628211ULL;
+		}
+		for (size_t i = 0; i < result.field_count; i++){
+			totals.digest = (totals.digest ^ (offset + fields[i])) * 1099511628211ULL;
+		}
+		totals.sentences += result.sentence_count;
+		totals.fields += result.field_count;
+		if (!result.consumed){
+			break; //only an unterminated sentence is left
+		}
+		offset += result.consumed;
+	}
+	totals.rejected = result.rejected;
+	return totals;
+}
+
+/**
+ * @brief Baseline: the device parser, one character at a time.
+ */
+static unsigned long parse_all(const uint8_t* data, size_t length, unsigned long* rejected){
+	unsigned long accepted = 0;
+
+	nf_parse_reset();
+	for (size_t i = 0; i < length; i++){
+		nf_parse_char((char)data[i]);
+	}
+	*rejected = 0;
+	for (int i = 0; i < NF_NUM_MSG_TYPES; i++){
+		accepted += nf_accept_count[i];
+		*rejected += nf_reject_count[i];
+	}
+	return accepted;
+}
+
+static void bench_capture(const char* name, int repetitions){
+	static const nf_scan_impl_t impls[] = {NF_SCAN_SCALAR, NF_SCAN_SSE2, NF_SCAN_AVX2};
+	scan_totals_t reference = {0, 0, 0, 0};
+	size_t length;
+	uint8_t* data = load(name, &length);
+	double best;
+	unsigned long accepted = 0;
+	unsigned long rejected = 0;
+	double mb = length / 1e6;
+
+	printf("%s: %.1f MB\n", name, mb);
+
+	best = 1e30;
+	for (int r = 0; r < repetitions; r++){
+		double start = now();
+		accepted = parse_all(data, length, &rejected);
+		double elapsed = now() - start;
+		best = elapsed < best ? elapsed : best;
+	}
+	printf("  %-12s %8.1f MB/s  %10lu sentences  %lu rejected\n", "nf_parse_char", mb / best, accepted, rejected);
+
+	for (size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++){
+		scan_totals_t totals = {0, 0, 0, 0};
+
+		if (nf_scan_select(impls[i]) != impls[i]){
+			printf("  %-12s not supported\n", nf_scan_impl_name(impls[i]));
+			continue;
+		}
+		best = 1e30;
+		for (int r = 0; r < repetitions; r++){
+			double start = now();
+			totals = scan_all(data, length);
+			double elapsed = now() - start;
+			best = elapsed < best ? elapsed : best;
+		}
+		printf("  %-12s %8.1f MB/s  %10lu sentences  %lu rejected  %lu fields\n",
+			nf_scan_impl_name(impls[i]), mb / best, totals.sentences, totals.rejected, totals.fields);
+		if (i == 0){
+			reference = totals;
+		} else if (memcmp(&reference, &totals, sizeof(totals))){
+			fprintf(stderr, "%s: %s result differs from scalar\n", name, nf_scan_impl_name(impls[i]));
+			exit(1);
+		}
+	}
+	free(data);
+}
+
+int main(int argc, char** argv){
+	int repetitions = DEFAULT_REPETITIONS;
+	int i = 1;
+
+	if ((argc > 2) && !strcmp(argv[1], "-r")){
+		repetitions = atoi(argv[2]);
+		i = 3;
+	}
+	if ((i >= argc) || (repetitions < 1)){
+		fprintf(stderr, "usage: nf_scan_bench [-r repetitions] capture ...\n");
+		return 2;
+	}
+	for (; i < argc; i++){
+		bench_capture(argv[i], repetitions);
+	}
+	return 0;
+}
@@ -0,0 +1,451 @@
+/**
+ * @file ut_geo_bench.c
+ * @brief Accuracy and speed of the fixed-point distances in ut_geo.c against double precision references.
+ *
+ * Random point pairs are drawn over the whole globe in five classes: anywhere, within about
+ * 200km, within about 20km (the flat limit), within about 200m and within about 2km of the
+ * antipode. For each class and distance function the largest absolute error is reported,
+ * together with the largest error left after allowing 2e-7 of the distance, which is the bound
+ * ut_geo.h states for the sphere:
+ *   haversine  ut_geo_distance_dm() against a double haversine on the same sphere
+ *   sphere     ut_geo_sphere_dm(), the flat path within the limit, against the same
+ *   wgs84      ut_geo_wgs84_dm() against Vincenty's inverse formula on the ellipsoid; pairs
+ *              where Vincenty does not converge, all near the antipode, are left out
+ *   cached     ut_geo_point_range_dm() between points filled by ut_geo_point_set(), against
+ *              the sphere, or against Vincenty when built with -DUT_GEO_WGS84=1
+ *   float      the float haversine ut_update_dist() used before ut_geo.c, against the sphere
+ * The spherical reference compares the arithmetic only; the ellipsoidal one the model as well.
+ * The sine and cosine are swept separately. ut_geo_bearing_cdeg() is checked against the double
+ * precision initial great-circle bearing for nearby, regional and global pairs, across the
+ * antimeridian and near the poles, and the bench returns 1 if any pair is beyond the bound
+ * ut_geo.h states. The host time per call of every path closes the report; the cached path is
+ * timed without ut_geo_point_set(), which runs once per point.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -o ut_geo_bench ut_geo_bench.c ../../wfx_sw/wfx_sw/ut/ut_geo.c -lm
+ *
+ * Usage:
+ *   ut_geo_bench [pairs per class]   default 1000000
+ *
+ * ut_geo_bench_avr.c counts the cycles of each path on the ATmega328p; the host times above say
+ * nothing about them.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_geo.h"
+
+//defines
+#define PI 3.14159265358979323846
+#define RAD_PER_UDEG (PI / 180e6)
+#define Q30 1073741824.0
+#define RELATIVE_BOUND 2e-7 /**< Part of the error allowed to grow with the distance */
+#define WGS84_A 63781370.0 /**< Equatorial radius in decimetres */
+#define WGS84_F (1 / 298.257223563)
+#define VINCENTY_ITERATIONS 200
+#define BEARING_BOUND_DEG 0.05 /**< Bearing error ut_geo.h states, plus the mean latitude turn for nearby points */
+#define BEARING_POLE_BOUND_DEG 0.11 /**< Bearing error ut_geo.h states for points beyond the flat limit near a pole */
+#define BEARING_POLE_UDEG 20000 /**< How near a pole both points must be for BEARING_POLE_BOUND_DEG */
+
+/**
+ * @brief Classes of point pairs.
+ */
+typedef enum {
+	PAIR_GLOBAL,
+	PAIR_REGIONAL,
+	PAIR_NEARBY,
+	PAIR_LOCAL,
+	PAIR_ANTIPODAL,
+	NUM_PAIR_CLASSES
+} pair_class_t;
+
+/**
+ * @brief Distance functions compared.
+ */
+typedef enum {
+	PATH_HAVERSINE,
+	PATH_SPHERE,
+	PATH_WGS84,
+	PATH_CACHED,
+	PATH_FLOAT,
+	NUM_PATHS
+} path_t;
+
+/**
+ * @brief Worst errors of one distance function over one class.
+ */
+typedef struct {
+	double worst;         /**< Largest absolute error, decimetres */
+	double worst_excess;  /**< Largest error beyond RELATIVE_BOUND of the distance, decimetres */
+	long skipped;         /**< Pairs without a reference */
+} path_error_t;
+
+static const char* const class_names[NUM_PAIR_CLASSES] = {"global", "within 200km", "within 20km", "within 200m", "near antipode"};
+static const char* const path_names[NUM_PATHS] = {"haversine", "sphere", "wgs84", "cached", "float"};
+static const int32_t class_spread[NUM_PAIR_CLASSES] = {0, 2000000, 200000, 2000, 20000};
+
+/**
+ * @brief Where the bearing pairs are drawn.
+ */
+typedef enum {
+	BEARING_NEARBY,       /**< Within the flat limit, anywhere */
+	BEARING_LOCAL,        /**< Within about 200m, anywhere */
+	BEARING_REGIONAL,     /**< Within about 200km, anywhere */
+	BEARING_GLOBAL,       /**< Anywhere */
+	BEARING_ANTIMERIDIAN, /**< Within the flat limit, across longitude 180 */
+	BEARING_POLE,         /**< Within the flat limit, within 1 degree of a pole */
+	BEARING_POLE_WIDE,    /**< Within about 200km, within 1 degree of a pole */
+	NUM_BEARING_CLASSES
+} bearing_class_t;
+
+static const char* const bearing_names[NUM_BEARING_CLASSES] = {"within 20km", "within 200m", "within 200km", "global", "antimeridian", "near pole", "pole 200km"};
+
+//local static
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL; /**< xorshift state; fixed, so runs repeat */
+
+static double now(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int32_t random_range(int32_t low, int32_t high){
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return low + (int32_t)(rng_state % (uint64_t)((int64_t)high - low + 1));
+}
+
+static double reference_dm(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2, double radius){
+	double h = pow(sin((lat2 - lat1) * RAD_PER_UDEG / 2), 2)
+		+ cos(lat1 * RAD_PER_UDEG) * cos(lat2 * RAD_PER_UDEG) * pow(sin(((double)lon2 - lon1) * RAD_PER_UDEG / 2), 2);
+	return 2 * radius * asin(sqrt(h < 1 ? h : 1));
+}
+
+/**
+ * @brief Vincenty's inverse formula on the WGS-84 ellipsoid, in decimetres.
+ * @return The distance, or a negative value when the iteration does not converge.
+ */
+static double vincenty_dm(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2, double altitude){
+	double a = WGS84_A + altitude;
+	double b = a * (1 - WGS84_F);
+	double u1 = atan((1 - WGS84_F) * tan(lat1 * RAD_PER_UDEG));
+	double u2 = atan((1 - WGS84_F) * tan(lat2 * RAD_PER_UDEG));
+	double l = ((double)lon2 - lon1) * RAD_PER_UDEG;
+	double lambda = l;
+	double sin_sigma, cos_sigma, sigma, cos2_alpha, cos_2sm;
+
+	for (int i = 0; ; i++){
+		double sin_alpha, c, previous = lambda;
+
+		if (i == VINCENTY_ITERATIONS){
+			return -1;
+		}
+		sin_sigma = hypot(cos(u2) * sin(lambda), cos(u1) * sin(u2) - sin(u1) * cos(u2) * cos(lambda));
+		if (sin_sigma == 0){
+			return 0;
+		}
+		cos_sigma = sin(u1) * sin(u2) + cos(u1) * cos(u2) * cos(lambda);
+		sigma = atan2(sin_sigma, cos_sigma);
+		sin_alpha = cos(u1) * cos(u2) * sin(lambda) / sin_sigma;
+		cos2_alpha = 1 - sin_alpha * sin_alpha;
+		cos_2sm = (cos2_alpha != 0) ? cos_sigma - 2 * sin(u1) * sin(u2) / cos2_alpha : 0;
+		c = WGS84_F / 16 * cos2_alpha * (4 + WGS84_F * (4 - 3 * cos2_alpha));
+		lambda = l + (1 - c) * WGS84_F * sin_alpha * (sigma + c * sin_sigma * (cos_2sm + c * cos_sigma * (-1 + 2 * cos_2sm * cos_2sm)));
+		if (fabs(lambda - previous) < 1e-13){
+			break;
+		}
+	}
+	double u_2 = cos2_alpha * (a * a - b * b) / (b * b);
+	double big_a = 1 + u_2 / 16384 * (4096 + u_2 * (-768 + u_2 * (320 - 175 * u_2)));
+	double big_b = u_2 / 1024 * (256 + u_2 * (-128 + u_2 * (74 - 47 * u_2)));
+	double delta_sigma = big_b * sin_sigma * (cos_2sm + big_b / 4 * (cos_sigma * (-1 + 2 * cos_2sm * cos_2sm)
+		- big_b / 6 * cos_2sm * (-3 + 4 * sin_sigma * sin_sigma) * (-3 + 4 * cos_2sm * cos_2sm)));
+	return b * big_a * (sigma - delta_sigma);
+}
+
+/**
+ * @brief The float haversine ut_update_dist() used before ut_geo.c, in decimetres.
+ */
+static float float_dm(float lat1, float lon1, float lat2, float lon2, float radius_km){
+	float dlat = (lat2 - lat1) * (float)(PI / 180);
+	float dlon = (lon2 - lon1) * (float)(PI / 180);
+	float a = sinf(dlat / 2) * sinf(dlat / 2) +
+		cosf(lat1 * (float)(PI / 180)) * cosf(lat2 * (float)(PI / 180)) * sinf(dlon / 2) * sinf(dlon / 2);
+	float c = 2 * atan2f(sqrtf(a), sqrtf(1 - a));
+	return radius_km * c * 10000;
+}
+
+static void draw_pair(pair_class_t pair_class, int32_t* p){
+	int32_t spread = class_spread[pair_class];
+
+	p[0] = random_range(-90000000, 90000000);
+	p[1] = random_range(-180000000, 180000000);
+	switch (pair_class){
+		case PAIR_GLOBAL:
+			p[2] = random_range(-90000000, 90000000);
+			p[3] = random_range(-180000000, 180000000);
+			return;
+		case PAIR_ANTIPODAL:
+			p[2] = -p[0] + random_range(-spread, spread);
+			p[3] = p[1] + 180000000 + random_range(-spread, spread);
+			break;
+		default:
+			p[2] = p[0] + random_range(-spread, spread);
+			p[3] = p[1] + random_range(-spread, spread);
+			break;
+	}
+	p[2] = (p[2] > 90000000) ? 90000000 : ((p[2] < -90000000) ? -90000000 : p[2]);
+	p[3] = (p[3] > 180000000) ? p[3] - 360000000 : ((p[3] < -180000000) ? p[3] + 360000000 : p[3]);
+}
+
+static void record(path_error_t* error, double value, double reference){
+	double e = fabs(value - reference);
+
+	error->worst = (e > error->worst) ? e : error->worst;
+	if (e - (RELATIVE_BOUND * reference) > error->worst_excess){
+		error->worst_excess = e - (RELATIVE_BOUND * reference);
+	}
+}
+
+static void check_class(pair_class_t pair_class, long pairs){
+	path_error_t errors[NUM_PATHS] = {{0, 0, 0}};
+	int32_t p[4];
+	ut_geo_point_t from;
+	ut_geo_point_t to;
+
+	for (long i = 0; i < pairs; i++){
+		draw_pair(pair_class, p);
+		double sphere = reference_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM);
+		double ellipsoid = vincenty_dm(p[0], p[1], p[2], p[3], 0);
+
+		record(&errors[PATH_HAVERSINE], ut_geo_distance_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM), sphere);
+		record(&errors[PATH_SPHERE], ut_geo_sphere_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM), sphere);
+		if (ellipsoid < 0){
+			errors[PATH_WGS84].skipped++;
+		} else {
+			record(&errors[PATH_WGS84], ut_geo_wgs84_dm(p[0], p[1], p[2], p[3], 0), ellipsoid);
+		}
+		ut_geo_point_set(&from, p[0], p[1]);
+		ut_geo_point_set(&to, p[2], p[3]);
+#if UT_GEO_WGS84
+		if (ellipsoid < 0){
+			errors[PATH_CACHED].skipped++;
+		} else {
+			record(&errors[PATH_CACHED], ut_geo_point_range_dm(&from, &to, 0), ellipsoid);
+		}
+#else
+		record(&errors[PATH_CACHED], ut_geo_point_range_dm(&from, &to, 0), sphere);
+#endif
+		record(&errors[PATH_FLOAT], float_dm(p[0] * 1e-6f, p[1] * 1e-6f, p[2] * 1e-6f, p[3] * 1e-6f, UT_GEO_EARTH_RADIUS_DM / 10000.0f), sphere);
+	}
+	for (int path = 0; path < NUM_PATHS; path++){
+		printf("%-14s %-10s %12.2f %12.2f", path ? "" : class_names[pair_class], path_names[path], errors[path].worst / 10, errors[path].worst_excess / 10);
+		if (errors[path].skipped){
+			printf("   (%ld without reference)", errors[path].skipped);
+		}
+		printf("\n");
+	}
+}
+
+/**
+ * @brief Initial great-circle bearing in degrees, 0 to 360.
+ */
+static double reference_bearing(int32_t lat1, int32_t lon1, int32_t lat2, int32_t lon2){
+	double phi1 = lat1 * RAD_PER_UDEG;
+	double phi2 = lat2 * RAD_PER_UDEG;
+	double dlon = ((double)lon2 - lon1) * RAD_PER_UDEG;
+	double bearing = atan2(sin(dlon) * cos(phi2), cos(phi1) * sin(phi2) - sin(phi1) * cos(phi2) * cos(dlon)) * 180 / PI;
+
+	return (bearing < 0) ? bearing + 360 : bearing;
+}
+
+static void draw_bearing_pair(bearing_class_t bearing_class, int32_t* p){
+	int32_t spread = (bearing_class == BEARING_POLE_WIDE) ? 2000000 : (int32_t)UT_GEO_FLAT_LIMIT_UDEG;
+
+	switch (bearing_class){
+		case BEARING_NEARBY:
+			draw_pair(PAIR_NEARBY, p);
+			return;
+		case BEARING_LOCAL:
+			draw_pair(PAIR_LOCAL, p);
+			return;
+		case BEARING_REGIONAL:
+			draw_pair(PAIR_REGIONAL, p);
+			return;
+		case BEARING_GLOBAL:
+			draw_pair(PAIR_GLOBAL, p);
+			return;
+		case BEARING_ANTIMERIDIAN:
+			p[0] = random_range(-89000000, 89000000);
+			p[1] = 180000000 - random_range(0, spread);
+			p[2] = p[0] + random_range(-spread, spread);
+			p[3] = -180000000 + random_range(0, spread);
+			break;
+		default:
+			p[0] = random_range(89000000, 90000000);
+			p[1] = random_range(-180000000, 180000000);
+			p[2] = p[0] + random_range(-spread, spread);
+			p[3] = p[1] + random_range(-spread, spread);
+			break;
+	}
+	if (random_range(0, 1)){ //either way round, and either pole
+		int32_t swap[2] = {p[0], p[1]};
+
+		p[0] = p[2];
+		p[1] = p[3];
+		p[2] = swap[0];
+		p[3] = swap[1];
+	}
+	if ((bearing_class != BEARING_ANTIMERIDIAN) && random_range(0, 1)){
+		p[0] = -p[0];
+		p[2] = -p[2];
+	}
+	p[0] = (p[0] > 90000000) ? 180000000 - p[0] : ((p[0] < -90000000) ? -180000000 - p[0] : p[0]);
+	p[2] = (p[2] > 90000000) ? 180000000 - p[2] : ((p[2] < -90000000) ? -180000000 - p[2] : p[2]);
+	p[3] = (p[3] > 180000000) ? p[3] - 360000000 : ((p[3] < -180000000) ? p[3] + 360000000 : p[3]);
+}
+
+/**
+ * @brief Bearing of ut_geo_bearing_cdeg() against the double precision great circle.
+ * Nearby points are allowed the mean latitude turn ut_geo.h states, dlon sin(lat) / 2, on top of
+ * BEARING_BOUND_DEG; farther points within BEARING_POLE_UDEG of a pole BEARING_POLE_BOUND_DEG. Coincident points and points within 1km of each other's antipode, where
+ * the bearing is undefined or turns with the last microdegree, are left out.
+ * @return The number of pairs beyond the bound.
+ */
+static long check_bearing(bearing_class_t bearing_class, long pairs){
+	double worst = 0;
+	double worst_excess = 0;
+	long skipped = 0;
+	long failed = 0;
+	int32_t p[4];
+	ut_geo_point_t from;
+	ut_geo_point_t to;
+
+	for (long i = 0; i < pairs; i++){
+		draw_bearing_pair(bearing_class, p);
+		if (((p[0] == p[2]) && (p[1] == p[3])) || (reference_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM) > (PI * UT_GEO_EARTH_RADIUS_DM) - 10000)){
+			skipped++;
+			continue;
+		}
+		ut_geo_point_set(&from, p[0], p[1]);
+		ut_geo_point_set(&to, p[2], p[3]);
+
+		double error = fabs(ut_geo_bearing_cdeg(&from, &to) / 100.0 - reference_bearing(p[0], p[1], p[2], p[3]));
+		double bound = BEARING_BOUND_DEG;
+		int64_t dlon = llabs((int64_t)p[3] - p[1]);
+
+		error = (error > 180) ? 360 - error : error;
+		dlon = (dlon > 180000000) ? 360000000 - dlon : dlon;
+		if ((llabs((int64_t)p[2] - p[0]) <= UT_GEO_FLAT_LIMIT_UDEG) && (dlon <= UT_GEO_FLAT_LIMIT_UDEG)){
+			bound += dlon * 1e-6 * fabs(sin((p[0] / 2 + p[2] / 2) * RAD_PER_UDEG)) / 2;
+		} else if ((90000000 - labs(p[0]) <= BEARING_POLE_UDEG) && (90000000 - labs(p[2]) <= BEARING_POLE_UDEG)){
+			bound = BEARING_POLE_BOUND_DEG;
+		}
+		worst = (error > worst) ? error : worst;
+		worst_excess = (error - bound > worst_excess) ? error - bound : worst_excess;
+		failed += (error > bound);
+	}
+	printf("%-14s %12.4f %12.4f %8ld", bearing_names[bearing_class], worst, worst_excess, failed);
+	if (skipped){
+		printf("   (%ld left out)", skipped);
+	}
+	printf("\n");
+	return failed;
+}
+
+static void check_trig(){
+	double worst = 0;
+
+	for (int32_t angle = -400000000; angle < 400000000; angle += 1009){
+		double sin_error = fabs(ut_geo_sin(angle) / Q30 - sin(angle * RAD_PER_UDEG));
+		double cos_error = fabs(ut_geo_cos(angle) / Q30 - cos(angle * RAD_PER_UDEG));
+
+		worst = (sin_error > worst) ? sin_error : worst;
+		worst = (cos_error > worst) ? cos_error : worst;
+	}
+	printf("sin/cos: largest error %.2e\n\n", worst);
+}
+
+static double time_path(path_t path, int32_t (*points)[4], ut_geo_point_t (*cached)[2], long pairs){
+	volatile uint32_t sink_fixed = 0;
+	volatile float sink_float = 0;
+	double start = now();
+
+	for (long i = 0; i < pairs; i++){
+		int32_t* p = points[i];
+
+		switch (path){
+			case PATH_HAVERSINE:
+				sink_fixed += ut_geo_distance_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM);
+				break;
+			case PATH_SPHERE:
+				sink_fixed += ut_geo_sphere_dm(p[0], p[1], p[2], p[3], UT_GEO_EARTH_RADIUS_DM);
+				break;
+			case PATH_WGS84:
+				sink_fixed += ut_geo_wgs84_dm(p[0], p[1], p[2], p[3], 0);
+				break;
+			case PATH_CACHED:
+				sink_fixed += ut_geo_point_range_dm(&cached[i][0], &cached[i][1], 0);
+				break;
+			default:
+				sink_float += float_dm(p[0] * 1e-6f, p[1] * 1e-6f, p[2] * 1e-6f, p[3] * 1e-6f, 6371.0f);
+				break;
+		}
+	}
+	return (now() - start) * 1e9 / pairs;
+}
+
+/**
+ * @brief Host time per call of every path, for pairs within the flat limit and for global pairs.
+ */
+static void time_calls(long pairs){
+	int32_t (*nearby)[4] = malloc(sizeof(*nearby) * pairs);
+	int32_t (*global)[4] = malloc(sizeof(*global) * pairs);
+	ut_geo_point_t (*nearby_cached)[2] = malloc(sizeof(*nearby_cached) * pairs);
+	ut_geo_point_t (*global_cached)[2] = malloc(sizeof(*global_cached) * pairs);
+
+	if (nearby && global && nearby_cached && global_cached){
+		for (long i = 0; i < pairs; i++){
+			draw_pair(PAIR_NEARBY, nearby[i]);
+			draw_pair(PAIR_GLOBAL, global[i]);
+			for (int k = 0; k < 2; k++){
+				ut_geo_point_set(&nearby_cached[i][k], nearby[i][2 * k], nearby[i][2 * k + 1]);
+				ut_geo_point_set(&global_cached[i][k], global[i][2 * k], global[i][2 * k + 1]);
+			}
+		}
+		printf("\nhost time per call    within 20km     global\n");
+		for (int path = 0; path < NUM_PATHS; path++){
+			printf("%-18s %10.1f ns %10.1f ns\n", path_names[path], time_path((path_t)path, nearby, nearby_cached, pairs),
+				time_path((path_t)path, global, global_cached, pairs));
+		}
+	}
+	free(nearby);
+	free(global);
+	free(nearby_cached);
+	free(global_cached);
+}
+
+int main(int argc, char** argv){
+	long pairs = (argc > 1) ? atol(argv[1]) : 1000000;
+	long bearing_failures = 0;
+
+	if (pairs < 1){
+		fprintf(stderr, "usage: ut_geo_bench [pairs per class]\n");
+		return 2;
+	}
+	check_trig();
+	printf("%-14s %-10s %12s %12s\n", "pairs", "path", "error m", "- 2e-7 d m");
+	for (int c = 0; c < NUM_PAIR_CLASSES; c++){
+		check_class((pair_class_t)c, pairs);
+	}
+	printf("\n%-14s %12s %12s %8s\n", "bearing pairs", "error deg", "- bound deg", "failed");
+	for (int c = 0; c < NUM_BEARING_CLASSES; c++){
+		bearing_failures += check_bearing((bearing_class_t)c, pairs);
+	}
+	time_calls(pairs);
+	return bearing_failures ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file ut_geo_bench_avr.c
+ * @brief Cycle count of the distance paths on the ATmega328p, run under a simulator.
+ *
+ * ut_geo_distance_dm() (haversine), ut_geo_sphere_dm() (flat within the limit, else haversine),
+ * ut_geo_wgs84_dm() (flat or Lambert) and ut_geo_point_range_dm() between points filled once by
+ * ut_geo_point_set() (cached) are timed against the float haversine ut_update_dist()
+ * used before ut_geo.c, which needs sin, cos, atan2 and sqrt from the soft-float libm, for pairs
+ * about 100m, 10km, 700km and 16500km apart. Timer1 runs at the CPU clock and counts overflows,
+ * as in nf_bench_avr.c. Each line gives a path's distance in decimetres and its cycles per call;
+ * results go out on USART0 at 38400 baud and the program ends by sleeping with interrupts off,
+ * which stops simavr. It has not been run yet: the choice of the flat path within
+ * UT_GEO_FLAT_LIMIT_UDEG and the cost of UT_GEO_WGS84 rest on the multiply counts in ut_geo.h,
+ * which are estimates of the cycles.
+ *
+ * Build and run from this directory:
+ *   avr-gcc -mmcu=atmega328p -DF_CPU=4000000UL -Os -fshort-enums -o ut_geo_bench_avr.elf ut_geo_bench_avr.c ../../wfx_sw/wfx_sw/ut/ut_geo.c -lm
+ *   simavr -m atmega328p -f 4000000 ut_geo_bench_avr.elf
+ */
+
+#include <math.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_geo.h"
+
+//defines
+#define BENCH_BAUD 38400UL
+#define BENCH_UBRR ((F_CPU / (8 * BENCH_BAUD)) - 1) /**< Double speed, as the GPS link */
+#define BENCH_CALLS 16                              /**< Calls timed per pair */
+#define DEG_TO_RAD_F 0.017453292f
+#define RADIUS_KM_F 6371.0f
+
+/**
+ * @brief One pair of points, in microdegrees.
+ */
+typedef struct {
+	int32_t lat1;
+	int32_t lon1;
+	int32_t lat2;
+	int32_t lon2;
+} bench_pair_t;
+
+static const bench_pair_t pairs[] PROGMEM = {
+	{47376887, 8541694, 47377600, 8542500},   //about 100m
+	{47376887, 8541694, 47450000, 8450000},   //about 10km
+	{47376887, 8541694, 52520008, 13404954},  //about 700km
+	{47376887, 8541694, -33868820, 151209296} //about 16500km
+};
+
+//local static
+static volatile uint16_t timer_overflows; /**< Upper 16 bits of the cycle counter */
+static volatile uint32_t sink_fixed;      /**< Keeps the timed calls from being optimised away */
+static volatile float sink_float;
+
+ISR(TIMER1_OVF_vect){
+	timer_overflows++;
+}
+
+/**
+ * @brief Read the 32 bit cycle counter.
+ */
+static uint32_t cycles(){
+	uint16_t high;
+	uint16_t low;
+
+	cli();
+	low = TCNT1;
+	high = timer_overflows;
+	if ((TIFR1 & _BV(TOV1)) && (low < 0x8000)){ //overflowed after the read, before the interrupt ran
+		high++;
+	}
+	sei();
+	return ((uint32_t)high << 16) | low;
+}
+
+static void put_char(char c){
+	while (!(UCSR0A & _BV(UDRE0))){
+	}
+	UCSR0A = _BV(U2X0) | _BV(TXC0); //clear TXC0, set again once this character has left
+	UDR0 = c;
+}
+
+static void put_string_P(const char* str){
+	char c;
+
+	while ((c = pgm_read_byte(str++))){
+		put_char(c);
+	}
+}
+
+static void put_uint(uint32_t value){
+	char digits[10];
+	uint8_t count = 0;
+
+	do {
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+	while (count){
+		put_char(digits[--count]);
+	}
+}
+
+/**
+ * @brief The float haversine ut_update_dist() used before ut_geo.c, in decimetres.
+ */
+static float float_dm(float lat1, float lon1, float lat2, float lon2){
+	float dlat = (lat2 - lat1) * DEG_TO_RAD_F;
+	float dlon = (lon2 - lon1) * DEG_TO_RAD_F;
+	float a = sin(dlat / 2) * sin(dlat / 2) + cos(lat1 * DEG_TO_RAD_F) * cos(lat2 * DEG_TO_RAD_F) * sin(dlon / 2) * sin(dlon / 2);
+	float c = 2 * atan2(sqrt(a), sqrt(1 - a));
+	return RADIUS_KM_F * c * 10000;
+}
+
+static const char path_haversine[] PROGMEM = "  haversine ";
+static const char path_sphere[] PROGMEM = "  sphere    ";
+static const char path_wgs84[] PROGMEM = "  wgs84     ";
+static const char path_cached[] PROGMEM = "  cached    ";
+static const char path_float[] PROGMEM = "  float     ";
+static const char* const path_names[] PROGMEM = {path_haversine, path_sphere, path_wgs84, path_cached, path_float};
+
+static void put_result(uint8_t path, uint32_t distance_dm, uint32_t elapsed){
+	put_string_P((const char*)pgm_read_ptr(&path_names[path]));
+	put_uint(distance_dm);
+	put_string_P(PSTR("dm cycles "));
+	put_uint(elapsed);
+	put_string_P(PSTR("\r\n"));
+}
+
+static void bench_pair(const bench_pair_t* entry){
+	bench_pair_t pair;
+	ut_geo_point_t from;
+	ut_geo_point_t to;
+	float lat1;
+	float lon1;
+	float lat2;
+	float lon2;
+	uint32_t start;
+
+	memcpy_P(&pair, entry, sizeof(pair));
+	lat1 = pair.lat1 * 1e-6f;
+	lon1 = pair.lon1 * 1e-6f;
+	lat2 = pair.lat2 * 1e-6f;
+	lon2 = pair.lon2 * 1e-6f;
+	ut_geo_point_set(&from, pair.lat1, pair.lon1);
+	ut_geo_point_set(&to, pair.lat2, pair.lon2);
+
+	for (uint8_t path = 0; path < sizeof(path_names) / sizeof(path_names[0]); path++){
+		start = cycles();
+		for (uint8_t i = 0; i < BENCH_CALLS; i++){
+			switch (path){
+				case 0:
+					sink_fixed = ut_geo_distance_dm(pair.lat1, pair.lon1, pair.lat2, pair.lon2, UT_GEO_EARTH_RADIUS_DM);
+					break;
+				case 1:
+					sink_fixed = ut_geo_sphere_dm(pair.lat1, pair.lon1, pair.lat2, pair.lon2, UT_GEO_EARTH_RADIUS_DM);
+					break;
+				case 2:
+					sink_fixed = ut_geo_wgs84_dm(pair.lat1, pair.lon1, pair.lat2, pair.lon2, 0);
+					break;
+				case 3:
+					sink_fixed = ut_geo_point_range_dm(&from, &to, 0);
+					break;
+				default:
+					sink_float = float_dm(lat1, lon1, lat2, lon2);
+					break;
+			}
+		}
+		put_result(path, (path < 4) ? sink_fixed : (uint32_t)sink_float, (cycles() - start) / BENCH_CALLS);
+	}
+}
+
+int main(){
+	UBRR0H = (uint8_t)(BENCH_UBRR >> 8);
+	UBRR0L = (uint8_t)BENCH_UBRR;
+	UCSR0A = _BV(U2X0);
+	UCSR0B = _BV(TXEN0);
+	UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);
+
+	TCCR1A = 0;
+	TCCR1B = _BV(CS10); //clk/1
+	TIMSK1 = _BV(TOIE1);
+	sei();
+
+	for (uint8_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++){
+		put_string_P(PSTR("pair "));
+		put_uint(i);
+		put_string_P(PSTR("\r\n"));
+		bench_pair(&pairs[i]);
+	}
+
+	while (!(UCSR0A & _BV(TXC0))){ //let the last character leave
+	}
+	cli();
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+	return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file ut_log_bench.c
+ * @brief Checks the journaled EEPROM storage of ut_log.c against a model and measures its wear.
+ *
+ * The EEPROM is an array with a write count per byte; like eeprom_update_block(), bytes that
+ * already hold the value are not written. All UT_LOG_SLOTS memory locations are saved first and
+ * then a random mix of operations follows, most of them on a few busy locations:
+ *   SAVE 75%, CLEAR 24%, RESET 1%
+ * After every operation each location is read back and compared with the model, and every
+ * hundredth operation the RAM index is rebuilt with ut_log_init() first. With -t, every
+ * operation also loses power after a random number of byte writes, the last one erased half of
+ * the time, and the rebuilt index must give the locations either as before the operation or as
+ * after it. A torn entry whose stale CRC happens to match, about one in 65536, is counted apart
+ * and the model is reloaded from the log.
+ *
+ * The report gives the entries written per operation and the write counts of the busiest byte
+ * and of the average byte, against the fixed records of the previous layout, where the record of
+ * the busiest location takes every one of its writes.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -o ut_log_bench ut_log_bench.c ../../wfx_sw/wfx_sw/ut/ut_log.c ../../wfx_sw/wfx_sw/ut/ut_wpt.c
+ *
+ * Usage:
+ *   ut_log_bench [-n operations] [-b busy locations] [-s seed] [-t]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_log.h"
+
+//defines
+#define REBUILD_INTERVAL 100 /**< Operations between rebuilds of the RAM index */
+#define BUSY_PERCENT 90 /**< Share of the operations on the busy locations */
+
+/**
+ * @brief What the model expects of a memory location.
+ */
+typedef struct {
+	boolean_t in_use;
+	ut_wpt_t wpt;
+} location_t;
+
+//local static
+static uint8_t eeprom[UT_LOG_EEPROM_SIZE]; /**< EEPROM contents */
+static unsigned long writes[UT_LOG_EEPROM_SIZE]; /**< Writes of each byte */
+static unsigned long entry_writes; /**< Calls of ut_log_eeprom_write() */
+static long power_budget = -1; /**< Byte writes left before the power is lost, -1 for no loss */
+static uint32_t power_seed = 1; /**< Generator of the power losses, apart from rand() so the operations match the fixed records */
+
+//local function definitions
+/**
+ * @brief Random number for the power losses, 0 to 32767.
+ */
+static unsigned power_rand(){
+	power_seed = power_seed * 1103515245UL + 12345;
+	return (power_seed >> 16) & 0x7FFF;
+}
+
+//function definitions
+void ut_log_eeprom_read(void* dst, uint16_t address, uint8_t count){
+	memcpy(dst, eeprom + address, count);
+}
+
+void ut_log_eeprom_write(const void* src, uint16_t address, uint8_t count){
+	const uint8_t* bytes = src;
+
+	entry_writes++;
+	for (uint8_t i = 0; i < count; i++){
+		if (eeprom[address + i] == bytes[i]){
+			continue;
+		}
+		if (power_budget == 0){
+			return;
+		}
+		if (power_budget > 0){
+			power_budget--;
+			if ((power_budget == 0) && (power_rand() & 1)){
+				eeprom[address + i] = 0xFF; //cut between the erase and the write of the byte
+				return;
+			}
+		}
+		eeprom[address + i] = bytes[i];
+		writes[address + i]++;
+	}
+}
+
+/**
+ * @brief A random waypoint with a name from the full character set.
+ */
+static void random_wpt(ut_wpt_t* wpt){
+	static const char charset[] = " ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-.,'/&()#+:!?@*_=<>\"%$;[]^~";
+
+	wpt->lat_udeg = (int32_t)(rand() % 180000001) - 90000000;
+	wpt->lon_udeg = (int32_t)(((long)rand() << 8 ^ rand()) % 360000000) - 180000000;
+	for (int i = 0; i < UT_WPT_NAME_CHARS; i++){
+		wpt->name[i] = charset[rand() % (sizeof(charset) - 1)];
+	}
+}
+
+/**
+ * @brief Compares every location with the model.
+ * @return Number of locations that differ.
+ */
+static int check(const location_t* model){
+	int errors = 0;
+
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		ut_wpt_t wpt;
+		boolean_t in_use = ut_log_read(index, &wpt);
+
+		if ((in_use != model[index].in_use) || (in_use && ((wpt.lat_udeg != model[index].wpt.lat_udeg)
+				|| (wpt.lon_udeg != model[index].wpt.lon_udeg) || memcmp(wpt.name, model[index].wpt.name, UT_WPT_NAME_CHARS)))){
+			errors++;
+		}
+	}
+	return errors;
+}
+
+/**
+ * @brief Reloads the model from the log.
+ */
+static void reload(location_t* model){
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		model[index].in_use = ut_log_read(index, &model[index].wpt);
+	}
+}
+
+/**
+ * @brief Runs one operation on the log and the model.
+ */
+static void run_op(location_t* model, int busy){
+	int choice = rand() % 100;
+	uint8_t index = (rand() % 100 < BUSY_PERCENT) ? (uint8_t)(rand() % busy) : (uint8_t)(rand() % UT_LOG_SLOTS);
+
+	if (choice < 75){
+		random_wpt(&model[index].wpt);
+		model[index].in_use = true;
+		ut_log_save(index, &model[index].wpt);
+	} else if (choice < 99){
+		model[index].in_use = false;
+		ut_log_clear(index);
+	} else {
+		for (index = 0; index < UT_LOG_SLOTS; index++){
+			model[index].in_use = false;
+		}
+		ut_log_reset();
+	}
+}
+
+int main(int argc, char** argv){
+	long ops = 200000;
+	int busy = 3;
+	int torn = 0;
+	unsigned seed = 1;
+	location_t model[UT_LOG_SLOTS];
+	location_t before[UT_LOG_SLOTS];
+	unsigned long busiest = 0, total = 0;
+	unsigned long fixed_busiest = 0;
+	unsigned long fixed_writes[UT_LOG_SLOTS] = {0};
+	long errors = 0, torn_ops = 0, torn_accepted = 0;
+
+	for (int i = 1; i < argc; i++){
+		if ((i + 1 < argc) && !strcmp(argv[i], "-n")){
+			ops = atol(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-b")){
+			busy = atoi(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-s")){
+			seed = (unsigned)atol(argv[++i]);
+		} else if (!strcmp(argv[i], "-t")){
+			torn = 1;
+		} else {
+			ops = -1;
+		}
+	}
+	if ((ops < 0) || (busy < 1) || (busy > UT_LOG_SLOTS)){
+		fprintf(stderr, "usage: ut_log_bench [-n operations] [-b busy locations] [-s seed] [-t]\n");
+		return 1;
+	}
+	srand(seed);
+	memset(eeprom, 0xFF, sizeof(eeprom));
+	ut_log_init();
+
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		random_wpt(&model[index].wpt);
+		model[index].in_use = true;
+		ut_log_save(index, &model[index].wpt);
+	}
+	errors += check(model);
+
+	for (long op = 0; op < ops; op++){
+		memcpy(before, model, sizeof(model));
+		if (torn){
+			power_budget = power_rand() % 48;
+		}
+		run_op(model, busy);
+		if (torn){
+			boolean_t lost = (power_budget == 0);
+
+			power_budget = -1;
+			ut_log_init();
+			if (lost){
+				torn_ops++;
+				if (check(model) != 0){
+					memcpy(model, before, sizeof(model)); //the operation did not make it
+				}
+				if (check(model) != 0){
+					torn_accepted++;
+					reload(model);
+				}
+			}
+		} else if ((op % REBUILD_INTERVAL) == 0){
+			ut_log_init();
+		}
+		errors += check(model);
+	}
+
+	//previous layout: one fixed record per location, rewritten by every SAVE and CLEAR of it
+	srand(seed);
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		fixed_writes[index]++;
+	}
+	for (long op = 0; op < ops; op++){
+		int choice = rand() % 100;
+		uint8_t index = (rand() % 100 < BUSY_PERCENT) ? (uint8_t)(rand() % busy) : (uint8_t)(rand() % UT_LOG_SLOTS);
+
+		for (uint8_t i = 0; (choice >= 99) && (i < UT_LOG_SLOTS); i++){
+			fixed_writes[i]++;
+		}
+		fixed_writes[index] += (choice < 99);
+	}
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		fixed_busiest = (fixed_writes[index] > fixed_busiest) ? fixed_writes[index] : fixed_busiest;
+	}
+
+	for (int i = 0; i < UT_LOG_ENTRIES * UT_LOG_ENTRY_SIZE; i++){
+		busiest = (writes[i] > busiest) ? writes[i] : busiest;
+		total += writes[i];
+	}
+	printf("operations          %ld, %d busy locations%s\n", ops, busy, torn ? ", power lost in each" : "");
+	printf("entries per op      %.2f\n", (double)entry_writes / (ops + UT_LOG_SLOTS));
+	printf("busiest byte        %lu writes\n", busiest);
+	printf("average byte        %.0f writes\n", (double)total / (UT_LOG_ENTRIES * UT_LOG_ENTRY_SIZE));
+	printf("fixed records       %lu writes of the busiest record\n", fixed_busiest);
+	if (torn){
+		printf("power lost          %ld times during a write\n", torn_ops);
+		printf("torn entries read   %ld\n", torn_accepted);
+	}
+	printf("mismatches          %ld\n", errors);
+	return errors != 0;
+}
@@ -0,0 +1,435 @@
+/**
+ * @file ut_store_bench.c
+ * @brief Builds waypoint stores and checks and times the queries of ut_store.c.
+ *
+ * The waypoints are read from a CSV file of "latitude,longitude,name" lines in degrees, or drawn
+ * at random: UT_STORE_BENCH_CITIES clusters of a few kilometres, a tenth of the points spread
+ * over the globe. They are sorted by ut_store_key() into the layout of ut_store.h and queried in
+ * memory through the same partial sector reader an SD card driver would provide. Every query is
+ * checked against a full scan ranged with the same ut_geo.c functions, and the report gives the
+ * sectors each query reads and the host time per query against the full scan:
+ *   nearest   ut_store_nearest() for k waypoints and for the single nearest one
+ *   radius    ut_store_radius() within r metres, at most 32 waypoints
+ * Queries are made from points within about 20km of a cluster (near) and from anywhere; far from
+ * every cluster the nearest waypoints can be thousands of kilometres away and the search box
+ * covers much of the store.
+ * A query fails when it differs from the full scan or reads more sectors than its limit: a
+ * quarter of the store near a cluster and half of it from anywhere, but no less than 64 and 128
+ * reads, as a nearest search may read a sector again when its radius grows. The limits are set
+ * for the default of 5 nearest; from far out at sea the 32 nearest can take more than the whole
+ * store. The bench returns 1 on any failure.
+ * The CPU cost on the device, most of it ut_geo_point_set() and ut_geo_point_range_dm() per
+ * candidate, is counted by ut_store_bench_avr.c on an image written by -a.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c11 -O2 -Wall -o ut_store_bench ut_store_bench.c ../../wfx_sw/wfx_sw/ut/ut_store.c ../../wfx_sw/wfx_sw/ut/ut_geo.c
+ *
+ * Usage:
+ *   ut_store_bench [-n waypoints] [-q queries] [-k nearest] [-r metres] [-i waypoints.csv] [-w store.bin]
+ *   ut_store_bench -a [-n waypoints] > ut_store_bench_image.h
+ * -w writes the store file as it goes on the SD card.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_store.h"
+
+//defines
+#define UT_STORE_BENCH_CITIES 40       /**< Clusters of random waypoints */
+#define CITY_SPREAD_UDEG 40000         /**< Largest offset of a waypoint from its cluster, about 4km */
+#define SPREAD_DIVISOR 10              /**< One waypoint in this many is placed anywhere */
+#define QUERY_SPREAD_UDEG 200000       /**< Largest offset of a query near a cluster, about 20km */
+#define MAX_K 32
+#define NEAR_READ_SHARE 4              /**< A query near a cluster fails past 1/4 of the store sectors... */
+#define NEAR_READ_MIN 64               /**< ...or past 64 sector reads in a smaller store */
+#define ANYWHERE_READ_SHARE 2          /**< A query from anywhere fails past 1/2 of the store sectors... */
+#define ANYWHERE_READ_MIN 128          /**< ...or past 128 sector reads in a smaller store */
+#define AVR_WAYPOINTS 480              /**< Default waypoints in the -a image, about 17KB of flash */
+#define AVR_QUERIES 8
+#define AVR_LINE_BYTES 16
+
+/**
+ * @brief One waypoint before it goes into the store.
+ */
+typedef struct {
+	uint32_t key;
+	int32_t lat_udeg;
+	int32_t lon_udeg;
+	char name[UT_STORE_NAME_SIZE];
+} waypoint_t;
+
+//local static
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+static uint8_t* image;        /**< Store read by the queries */
+static size_t image_sectors;  /**< Sectors in image */
+static int32_t cities[UT_STORE_BENCH_CITIES][2];
+
+static double now(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int32_t random_range(int32_t low, int32_t high){
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 7;
+	rng_state ^= rng_state << 17;
+	return low + (int32_t)(rng_state % (uint64_t)((int64_t)high - low + 1));
+}
+
+static int32_t clamp_lat(int32_t lat){
+	return lat > 90000000 ? 90000000 : (lat < -90000000 ? -90000000 : lat);
+}
+
+static int32_t wrap_lon(int32_t lon){
+	return lon >= 180000000 ? lon - 360000000 : (lon < -180000000 ? lon + 360000000 : lon);
+}
+
+/**
+ * @brief Partial sector reader over the image in memory.
+ */
+static boolean_t read_image(void* dst, uint32_t sector, uint16_t offset, uint16_t count){
+	if ((sector >= image_sectors) || (offset + count > UT_STORE_SECTOR_SIZE)){
+		return false;
+	}
+	memcpy(dst, image + ((size_t)sector * UT_STORE_SECTOR_SIZE) + offset, count);
+	return true;
+}
+
+static int compare_key(const void* a, const void* b){
+	uint32_t ka = ((const waypoint_t*)a)->key;
+	uint32_t kb = ((const waypoint_t*)b)->key;
+	return (ka > kb) - (ka < kb);
+}
+
+static void put_u32(uint8_t* dst, uint32_t value){
+	for (int i = 0; i < 4; i++){
+		dst[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+static void draw_cities(){
+	for (int c = 0; c < UT_STORE_BENCH_CITIES; c++){
+		cities[c][0] = random_range(-60000000, 70000000);
+		cities[c][1] = random_range(-180000000, 179999999);
+	}
+}
+
+static void draw_waypoints(waypoint_t* points, long count){
+	for (long i = 0; i < count; i++){
+		if (i % SPREAD_DIVISOR == 0){
+			points[i].lat_udeg = random_range(-90000000, 90000000);
+			points[i].lon_udeg = random_range(-180000000, 179999999);
+		} else {
+			int c = random_range(0, UT_STORE_BENCH_CITIES - 1);
+			points[i].lat_udeg = clamp_lat(cities[c][0] + random_range(-CITY_SPREAD_UDEG, CITY_SPREAD_UDEG));
+			points[i].lon_udeg = wrap_lon(cities[c][1] + random_range(-CITY_SPREAD_UDEG, CITY_SPREAD_UDEG));
+		}
+		memset(points[i].name, ' ', UT_STORE_NAME_SIZE);
+		memcpy(points[i].name, "POI", 3);
+		snprintf(points[i].name + 4, UT_STORE_NAME_SIZE - 4, "%05ld", i);
+		points[i].name[9] = ' ';
+	}
+}
+
+/**
+ * @brief Read "latitude,longitude,name" lines in degrees.
+ */
+static waypoint_t* load_csv(const char* file, long* count){
+	FILE* in = fopen(file, "r");
+	char line[256];
+	long capacity = 1024;
+	waypoint_t* points = malloc(capacity * sizeof(waypoint_t));
+
+	if (!in || !points){
+		perror(file);
+		exit(1);
+	}
+	*count = 0;
+	while (fgets(line, sizeof(line), in)){
+		double lat;
+		double lon;
+		int used = 0;
+		char* name;
+		size_t length;
+
+		if (sscanf(line, "%lf,%lf,%n", &lat, &lon, &used) < 2 || !used){
+			continue;
+		}
+		if (*count == capacity){
+			capacity *= 2;
+			points = realloc(points, capacity * sizeof(waypoint_t));
+			if (!points){
+				exit(1);
+			}
+		}
+		name = line + used;
+		length = strcspn(name, "\r\n");
+		length = length < UT_STORE_NAME_SIZE ? length : UT_STORE_NAME_SIZE;
+		points[*count].lat_udeg = clamp_lat((int32_t)(lat * 1e6 + (lat < 0 ? -0.5 : 0.5)));
+		points[*count].lon_udeg = wrap_lon((int32_t)(lon * 1e6 + (lon < 0 ? -0.5 : 0.5)));
+		memset(points[*count].name, ' ', UT_STORE_NAME_SIZE);
+		memcpy(points[*count].name, name, length);
+		(*count)++;
+	}
+	fclose(in);
+	return points;
+}
+
+/**
+ * @brief Sort the waypoints by key and lay them out as ut_store.h describes.
+ */
+static void build_image(waypoint_t* points, long count){
+	size_t data_sectors = (count + UT_STORE_RECORDS_PER_SECTOR - 1) / UT_STORE_RECORDS_PER_SECTOR;
+	size_t index_sectors = (data_sectors + UT_STORE_KEYS_PER_INDEX_SECTOR - 1) / UT_STORE_KEYS_PER_INDEX_SECTOR;
+
+	for (long i = 0; i < count; i++){
+		points[i].key = ut_store_key(points[i].lat_udeg, points[i].lon_udeg);
+	}
+	qsort(points, count, sizeof(waypoint_t), compare_key);
+	image_sectors = 1 + index_sectors + data_sectors;
+	image = calloc(image_sectors, UT_STORE_SECTOR_SIZE);
+	if (!image){
+		exit(1);
+	}
+	put_u32(image, UT_STORE_MAGIC);
+	put_u32(image + 4, (uint32_t)count);
+	for (long i = 0; i < count; i++){
+		size_t sector = i / UT_STORE_RECORDS_PER_SECTOR;
+		size_t slot = i % UT_STORE_RECORDS_PER_SECTOR;
+		uint8_t* data = image + ((1 + index_sectors + sector) * UT_STORE_SECTOR_SIZE);
+
+		if (slot == 0){
+			put_u32(image + ((1 + (sector / UT_STORE_KEYS_PER_INDEX_SECTOR)) * UT_STORE_SECTOR_SIZE)
+				+ ((sector % UT_STORE_KEYS_PER_INDEX_SECTOR) * 4), points[i].key);
+		}
+		put_u32(data + (slot * UT_STORE_COORD_SIZE), points[i].key);
+		put_u32(data + (slot * UT_STORE_COORD_SIZE) + 4, (uint32_t)points[i].lat_udeg);
+		put_u32(data + (slot * UT_STORE_COORD_SIZE) + 8, (uint32_t)points[i].lon_udeg);
+		memcpy(data + UT_STORE_NAME_OFFSET + (slot * UT_STORE_NAME_SIZE), points[i].name, UT_STORE_NAME_SIZE);
+	}
+}
+
+static void draw_query(int32_t* lat, int32_t* lon, int near){
+	if (!near){
+		*lat = random_range(-90000000, 90000000);
+		*lon = random_range(-180000000, 179999999);
+	} else {
+		int c = random_range(0, UT_STORE_BENCH_CITIES - 1);
+		*lat = clamp_lat(cities[c][0] + random_range(-QUERY_SPREAD_UDEG, QUERY_SPREAD_UDEG));
+		*lon = wrap_lon(cities[c][1] + random_range(-QUERY_SPREAD_UDEG, QUERY_SPREAD_UDEG));
+	}
+}
+
+/**
+ * @brief Distances of the nearest waypoints within a radius by full scan, nearest first.
+ * @return The number found, at most k.
+ */
+static int full_scan(const ut_geo_point_t* cached, long count, const ut_geo_point_t* from, uint32_t radius_dm, uint32_t* best, int k){
+	int found = 0;
+
+	for (long i = 0; i < count; i++){
+		uint32_t distance = ut_geo_point_range_dm(from, &cached[i], 0);
+		int j;
+
+		if ((distance > radius_dm) || ((found == k) && (distance >= best[k - 1]))){
+			continue;
+		}
+		if (found < k){
+			found++;
+		}
+		for (j = found - 1; (j > 0) && (best[j - 1] > distance); j--){
+			best[j] = best[j - 1];
+		}
+		best[j] = distance;
+	}
+	return found;
+}
+
+/**
+ * @brief Run one kind of query, check it and report.
+ * @param radius_dm 0 for nearest-k queries.
+ * @return The number of mismatches and queries past the sector limit.
+ */
+static long run_queries(ut_store_t* store, const ut_geo_point_t* cached, long count, long queries, int k, uint32_t radius_dm, int near){
+	ut_store_hit_t hits[MAX_K];
+	uint32_t best[MAX_K];
+	uint64_t total_sectors = 0;
+	uint32_t max_sectors = 0;
+	uint64_t total_hits = 0;
+	uint32_t limit = image_sectors / (near ? NEAR_READ_SHARE : ANYWHERE_READ_SHARE);
+	long over = 0;
+	long mismatches = 0;
+	double store_time = 0;
+	double scan_time = 0;
+
+	if (limit < (near ? NEAR_READ_MIN : ANYWHERE_READ_MIN)){
+		limit = near ? NEAR_READ_MIN : ANYWHERE_READ_MIN;
+	}
+	rng_state = 0xD1B54A32D192ED03ULL;
+	for (long n = 0; n < queries; n++){
+		ut_geo_point_t from;
+		int32_t lat;
+		int32_t lon;
+		int found;
+		int expected;
+		double start;
+
+		draw_query(&lat, &lon, near);
+		ut_geo_point_set(&from, lat, lon);
+		store->sector_reads = 0;
+		store->last_sector = 0xFFFFFFFFUL;
+		start = now();
+		found = radius_dm ? ut_store_radius(store, &from, 0, radius_dm, hits, k) : ut_store_nearest(store, &from, 0, hits, k);
+		store_time += now() - start;
+		start = now();
+		expected = full_scan(cached, count, &from, radius_dm ? radius_dm : 0xFFFFFFFFUL, best, k);
+		scan_time += now() - start;
+		total_sectors += store->sector_reads;
+		max_sectors = store->sector_reads > max_sectors ? store->sector_reads : max_sectors;
+		total_hits += found;
+		if (store->sector_reads > limit){
+			over++;
+		}
+		if (found != expected){
+			mismatches++;
+			continue;
+		}
+		for (int i = 0; i < found; i++){
+			if (hits[i].distance_dm != best[i]){
+				mismatches++;
+				break;
+			}
+		}
+	}
+	if (radius_dm){
+		printf("radius %-6.0fm  %-9s", radius_dm / 10.0, near ? "near" : "anywhere");
+	} else {
+		printf("nearest %-6d  %-9s", k, near ? "near" : "anywhere");
+	}
+	printf("%9.2f %8u %8.2f %10.2f %10.2f %10ld\n", (double)total_sectors / queries, max_sectors, (double)total_hits / queries,
+		store_time * 1e6 / queries, scan_time * 1e6 / queries, mismatches);
+	if (over){
+		printf("  %ld queries read more than %u sectors\n", over, limit);
+	}
+	return mismatches + over;
+}
+
+/**
+ * @brief Write the image and some query points as PROGMEM arrays for ut_store_bench_avr.c.
+ */
+static void write_avr_image(){
+	printf("/**\n * @file ut_store_bench_image.h\n * @brief Waypoint store for ut_store_bench_avr.c, written by \"ut_store_bench -a\"; do not edit.\n */\n\n");
+	printf("#ifndef UT_STORE_BENCH_IMAGE_H_\n#define UT_STORE_BENCH_IMAGE_H_\n\n#include <avr/pgmspace.h>\n\n");
+	printf("#define IMAGE_SECTORS %zu\n\n", image_sectors);
+	printf("static const uint8_t image[IMAGE_SECTORS * UT_STORE_SECTOR_SIZE] PROGMEM = {");
+	for (size_t i = 0; i < image_sectors * UT_STORE_SECTOR_SIZE; i++){
+		printf("%s0x%02X%s", (i % AVR_LINE_BYTES) ? "" : "\n\t", image[i],
+			(i + 1 < image_sectors * UT_STORE_SECTOR_SIZE) ? ((i % AVR_LINE_BYTES == AVR_LINE_BYTES - 1) ? "," : ", ") : "");
+	}
+	printf("\n};\n\n/**\n * @brief Query positions in microdegrees, near a cluster and anywhere in turn.\n */\n");
+	printf("static const int32_t queries[][2] PROGMEM = {\n");
+	rng_state = 0xD1B54A32D192ED03ULL;
+	for (int n = 0; n < AVR_QUERIES; n++){
+		int32_t lat;
+		int32_t lon;
+
+		draw_query(&lat, &lon, !(n % 2));
+		printf("\t{%ldL, %ldL}%s\n", (long)lat, (long)lon, n + 1 < AVR_QUERIES ? "," : "");
+	}
+	printf("};\n\n#endif /* UT_STORE_BENCH_IMAGE_H_ */\n");
+}
+
+int main(int argc, char** argv){
+	long count = 5000;
+	long queries = 2000;
+	int k = 5;
+	double radius_m = 5000;
+	const char* input = 0;
+	const char* output = 0;
+	int avr = 0;
+	waypoint_t* points;
+	ut_geo_point_t* cached;
+	ut_store_t store;
+	long failures = 0;
+
+	for (int i = 1; i < argc; i++){
+		if (!strcmp(argv[i], "-a")){
+			avr = 1;
+			count = AVR_WAYPOINTS;
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-n")){
+			count = atol(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-q")){
+			queries = atol(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-k")){
+			k = atoi(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-r")){
+			radius_m = atof(argv[++i]);
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-i")){
+			input = argv[++i];
+		} else if ((i + 1 < argc) && !strcmp(argv[i], "-w")){
+			output = argv[++i];
+		} else {
+			count = -1;
+			break;
+		}
+	}
+	if ((count < 1) || (count > (long)UT_STORE_MAX_RECORDS) || (queries < 1) || (k < 1) || (k > MAX_K) || (radius_m <= 0)){
+		fprintf(stderr, "usage: ut_store_bench [-n waypoints] [-q queries] [-k nearest] [-r metres] [-i waypoints.csv] [-w store.bin]\n"
+			"       ut_store_bench -a [-n waypoints] > ut_store_bench_image.h\n");
+		return 2;
+	}
+
+	draw_cities();
+	if (input){
+		points = load_csv(input, &count);
+		if ((count < 1) || (count > (long)UT_STORE_MAX_RECORDS)){
+			fprintf(stderr, "%s: %ld waypoints, 1 to %lu supported\n", input, count, (unsigned long)UT_STORE_MAX_RECORDS);
+			return 1;
+		}
+	} else {
+		points = malloc(count * sizeof(waypoint_t));
+		if (!points){
+			return 1;
+		}
+		draw_waypoints(points, count);
+	}
+	build_image(points, count);
+	if (avr){
+		write_avr_image();
+		return 0;
+	}
+	if (output){
+		FILE* out = fopen(output, "wb");
+		if (!out || (fwrite(image, UT_STORE_SECTOR_SIZE, image_sectors, out) != image_sectors) || fclose(out)){
+			perror(output);
+			return 1;
+		}
+	}
+	if (!ut_store_open(&store, read_image)){
+		fprintf(stderr, "store does not open\n");
+		return 1;
+	}
+	cached = malloc(count * sizeof(ut_geo_point_t));
+	if (!cached){
+		return 1;
+	}
+	for (long i = 0; i < count; i++){
+		ut_geo_point_set(&cached[i], points[i].lat_udeg, points[i].lon_udeg);
+	}
+
+	printf("%ld waypoints in %zu sectors, %u index\n", count, image_sectors, store.index_sectors);
+	printf("%-15s %-9s%9s %8s %8s %10s %10s %10s\n", "query", "from", "sectors", "max", "hits", "us/query", "us/scan", "mismatch");
+	for (int near = 1; near >= 0; near--){
+		failures += run_queries(&store, cached, count, queries, k, 0, near);
+		failures += run_queries(&store, cached, count, queries, 1, 0, near);
+		failures += run_queries(&store, cached, count, queries, MAX_K, (uint32_t)(radius_m * 10), near);
+	}
+	free(cached);
+	free(points);
+	free(image);
+	return failures ? 1 : 0;
+}
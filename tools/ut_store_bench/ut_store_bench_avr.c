@@ -0,0 +1,188 @@
+/**
+ * @file ut_store_bench_avr.c
+ * @brief Cycle count of the waypoint store queries on the ATmega328p, run under a simulator.
+ *
+ * The store image in ut_store_bench_image.h is read from flash through the partial sector reader
+ * ut_store.h asks for, standing in for the SD card. For each query position ut_store_nearest()
+ * for 5 waypoints and for 1, and ut_store_radius() within 5km, are timed against ranging every
+ * waypoint of the image with ut_geo_point_set() and ut_geo_point_range_dm(), as ut_update_dist()
+ * does for the memory locations. Each line gives the sectors read, the hits and the cycles; the
+ * time an SD card takes per sector comes on top. Timer1 counts cycles as in nf_bench_avr.c;
+ * results go out on USART0 at 38400 baud and the program ends by sleeping with interrupts off,
+ * which stops simavr.
+ *
+ * Build and run from this directory:
+ *   avr-gcc -mmcu=atmega328p -DF_CPU=4000000UL -Os -fshort-enums -o ut_store_bench_avr.elf ut_store_bench_avr.c ../../wfx_sw/wfx_sw/ut/ut_store.c ../../wfx_sw/wfx_sw/ut/ut_geo.c
+ *   simavr -m atmega328p -f 4000000 ut_store_bench_avr.elf
+ *
+ * Regenerate the image after changing the store layout with
+ *   ./ut_store_bench -a > ut_store_bench_image.h
+ */
+
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_store.h"
+#include "ut_store_bench_image.h"
+
+//defines
+#define BENCH_BAUD 38400UL
+#define BENCH_UBRR ((F_CPU / (8 * BENCH_BAUD)) - 1) /**< Double speed, as the GPS link */
+#define BENCH_NEAREST 5
+#define BENCH_RADIUS_DM 50000UL                     /**< 5km */
+#define BENCH_MAX_HITS 8
+
+//local static
+static volatile uint16_t timer_overflows; /**< Upper 16 bits of the cycle counter */
+static volatile uint32_t sink;            /**< Keeps the full scan from being optimised away */
+
+ISR(TIMER1_OVF_vect){
+	timer_overflows++;
+}
+
+/**
+ * @brief Read the 32 bit cycle counter.
+ */
+static uint32_t cycles(){
+	uint16_t high;
+	uint16_t low;
+
+	cli();
+	low = TCNT1;
+	high = timer_overflows;
+	if ((TIFR1 & _BV(TOV1)) && (low < 0x8000)){ //overflowed after the read, before the interrupt ran
+		high++;
+	}
+	sei();
+	return ((uint32_t)high << 16) | low;
+}
+
+static void put_char(char c){
+	while (!(UCSR0A & _BV(UDRE0))){
+	}
+	UCSR0A = _BV(U2X0) | _BV(TXC0); //clear TXC0, set again once this character has left
+	UDR0 = c;
+}
+
+static void put_string_P(const char* str){
+	char c;
+
+	while ((c = pgm_read_byte(str++))){
+		put_char(c);
+	}
+}
+
+static void put_uint(uint32_t value){
+	char digits[10];
+	uint8_t count = 0;
+
+	do {
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while (value);
+	while (count){
+		put_char(digits[--count]);
+	}
+}
+
+/**
+ * @brief Partial sector reader over the image in flash.
+ */
+static boolean_t read_image(void* dst, uint32_t sector, uint16_t offset, uint16_t count){
+	if (sector >= IMAGE_SECTORS){
+		return false;
+	}
+	memcpy_P(dst, &image[((uint16_t)sector * UT_STORE_SECTOR_SIZE) + offset], count);
+	return true;
+}
+
+static void put_result(const char* name, uint32_t sectors, uint8_t hits, uint32_t elapsed){
+	put_string_P(name);
+	put_string_P(PSTR(" sectors "));
+	put_uint(sectors);
+	put_string_P(PSTR(" hits "));
+	put_uint(hits);
+	put_string_P(PSTR(" cycles "));
+	put_uint(elapsed);
+	put_string_P(PSTR("\r\n"));
+}
+
+static void bench_query(ut_store_t* store, const int32_t* entry){
+	ut_store_hit_t hits[BENCH_MAX_HITS];
+	ut_geo_point_t from;
+	ut_geo_point_t point;
+	int32_t coords[3]; //key, latitude, longitude
+	uint32_t start;
+	uint32_t elapsed;
+	uint8_t found;
+
+	ut_geo_point_set(&from, (int32_t)pgm_read_dword(&entry[0]), (int32_t)pgm_read_dword(&entry[1]));
+
+	store->sector_reads = 0;
+	start = cycles();
+	found = ut_store_nearest(store, &from, 0, hits, BENCH_NEAREST);
+	elapsed = cycles() - start;
+	put_result(PSTR("  nearest 5"), store->sector_reads, found, elapsed);
+
+	store->sector_reads = 0;
+	start = cycles();
+	found = ut_store_nearest(store, &from, 0, hits, 1);
+	elapsed = cycles() - start;
+	put_result(PSTR("  nearest 1"), store->sector_reads, found, elapsed);
+
+	store->sector_reads = 0;
+	start = cycles();
+	found = ut_store_radius(store, &from, 0, BENCH_RADIUS_DM, hits, BENCH_MAX_HITS);
+	elapsed = cycles() - start;
+	put_result(PSTR("  radius 5km"), store->sector_reads, found, elapsed);
+
+	//every waypoint, as ut_update_dist() ranges the memory locations
+	start = cycles();
+	for (uint32_t i = 0; i < store->count; i++){
+		uint16_t sector = 1 + store->index_sectors + (i / UT_STORE_RECORDS_PER_SECTOR);
+
+		read_image(coords, sector, (i % UT_STORE_RECORDS_PER_SECTOR) * UT_STORE_COORD_SIZE, sizeof(coords));
+		ut_geo_point_set(&point, coords[1], coords[2]);
+		sink = ut_geo_point_range_dm(&from, &point, 0);
+	}
+	elapsed = cycles() - start;
+	put_result(PSTR("  full scan"), IMAGE_SECTORS - 1 - store->index_sectors, 0, elapsed);
+}
+
+int main(){
+	ut_store_t store;
+
+	UBRR0H = (uint8_t)(BENCH_UBRR >> 8);
+	UBRR0L = (uint8_t)BENCH_UBRR;
+	UCSR0A = _BV(U2X0);
+	UCSR0B = _BV(TXEN0);
+	UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);
+
+	TCCR1A = 0;
+	TCCR1B = _BV(CS10); //clk/1
+	TIMSK1 = _BV(TOIE1);
+	sei();
+
+	if (!ut_store_open(&store, read_image)){
+		put_string_P(PSTR("store does not open\r\n"));
+	} else {
+		put_uint(store.count);
+		put_string_P(PSTR(" waypoints\r\n"));
+		for (uint8_t i = 0; i < sizeof(queries) / sizeof(queries[0]); i++){
+			put_string_P(PSTR("query "));
+			put_uint(i);
+			put_string_P(PSTR("\r\n"));
+			bench_query(&store, queries[i]);
+		}
+	}
+
+	while (!(UCSR0A & _BV(TXC0))){ //let the last character leave
+	}
+	cli();
+	set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+	sleep_enable();
+	sleep_cpu();
+	return 0;
+}
@@ -0,0 +1,1054 @@
+/**
+ * @file ut_store_bench_image.h
+ * @brief Waypoint store for ut_store_bench_avr.c, written by "ut_store_bench -a"; do not edit.
+ */
+
+#ifndef UT_STORE_BENCH_IMAGE_H_
+#define UT_STORE_BENCH_IMAGE_H_
+
+#include <avr/pgmspace.h>
+
+#define IMAGE_SECTORS 32
+
+static const uint8_t image[IMAGE_SECTORS * UT_STORE_SECTOR_SIZE] PROGMEM = {
+	0x57, 0x46, 0x58, 0x53, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xA3, 0x5B, 0x9E, 0x00, 0xAD, 0x5F, 0x4B, 0x0F, 0xFD, 0xBB, 0x3E, 0x1A, 0x6A, 0x43, 0xBD, 0x24,
+	0x5B, 0x69, 0x37, 0x28, 0x56, 0x71, 0xCF, 0x2B, 0x3F, 0x31, 0x2B, 0x30, 0x1E, 0x1E, 0x7D, 0x32,
+	0x68, 0x73, 0xB5, 0x32, 0xDC, 0x26, 0xAA, 0x39, 0xD0, 0x84, 0x5F, 0x3B, 0xBF, 0x2E, 0xFB, 0x4B,
+	0x7C, 0xEA, 0x36, 0x5A, 0x48, 0xBD, 0xB4, 0x5C, 0x81, 0xA3, 0x63, 0x60, 0x81, 0xA0, 0xF8, 0x61,
+	0x07, 0xD7, 0x81, 0x6D, 0x37, 0xBC, 0x10, 0x6E, 0x4F, 0x8B, 0xCE, 0x87, 0xCD, 0xDB, 0xF2, 0x88,
+	0x09, 0xC8, 0xB0, 0x9B, 0xE3, 0x6C, 0x50, 0xA7, 0xD8, 0x53, 0x48, 0xB7, 0xFF, 0x80, 0x45, 0xCA,
+	0x08, 0x9F, 0x57, 0xCA, 0x12, 0xA5, 0xF9, 0xD8, 0xB6, 0xA9, 0x86, 0xDF, 0xE8, 0x88, 0xC9, 0xE0,
+	0x03, 0x08, 0xC1, 0xE7, 0x66, 0x4D, 0xC9, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xA3, 0x5B, 0x9E, 0x00, 0x9A, 0x4F, 0x1B, 0xFB, 0xA0, 0xC6, 0xD7, 0xF5, 0x9D, 0x5E, 0x0C, 0x0D,
+	0xFE, 0xFE, 0x11, 0xFC, 0xCE, 0xD6, 0x89, 0xF9, 0x39, 0x79, 0x3D, 0x0D, 0xB9, 0xBE, 0x3E, 0xFC,
+	0xF5, 0xAD, 0xF3, 0xF9, 0x70, 0x54, 0x85, 0x0D, 0x24, 0x19, 0x50, 0xFC, 0x61, 0xC4, 0x9F, 0xF9,
+	0x50, 0x28, 0x27, 0x0F, 0xF4, 0x72, 0xDF, 0xFC, 0x52, 0x03, 0x8D, 0xF9, 0x7D, 0x28, 0x27, 0x0F,
+	0x5E, 0xBB, 0xDF, 0xFC, 0x79, 0x41, 0x8D, 0xF9, 0x0E, 0x29, 0x27, 0x0F, 0xDF, 0x93, 0xDF, 0xFC,
+	0xBF, 0x75, 0x8D, 0xF9, 0x99, 0x29, 0x27, 0x0F, 0x1E, 0xE4, 0xDF, 0xFC, 0xEE, 0xB2, 0x8D, 0xF9,
+	0xC0, 0x29, 0x27, 0x0F, 0x6C, 0xCC, 0xDF, 0xFC, 0x1F, 0xFB, 0x8D, 0xF9, 0x47, 0x2A, 0x27, 0x0F,
+	0x44, 0x2B, 0xE0, 0xFC, 0xE3, 0xEC, 0x8C, 0xF9, 0x7D, 0x2A, 0x27, 0x0F, 0xC9, 0x65, 0xE0, 0xFC,
+	0x5A, 0x33, 0x8D, 0xF9, 0x7E, 0x2A, 0x27, 0x0F, 0xAB, 0x6B, 0xE0, 0xFC, 0xF6, 0x2D, 0x8D, 0xF9,
+	0x1C, 0x2B, 0x27, 0x0F, 0xD3, 0x39, 0xE0, 0xFC, 0x35, 0xD0, 0x8D, 0xF9, 0x24, 0x5F, 0x4B, 0x0F,
+	0x2B, 0x2E, 0xC8, 0xFC, 0xB8, 0x04, 0x21, 0xFA, 0x30, 0x5F, 0x4B, 0x0F, 0xDF, 0x2D, 0xC8, 0xFC,
+	0xE6, 0x39, 0x21, 0xFA, 0x87, 0x5F, 0x4B, 0x0F, 0xA5, 0x5C, 0xC8, 0xFC, 0x3A, 0x1E, 0x21, 0xFA,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x37, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x34, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x31, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x34, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xAD, 0x5F, 0x4B, 0x0F, 0xE2, 0x92, 0xC8, 0xFC, 0xFB, 0x24, 0x21, 0xFA, 0xBF, 0x5F, 0x4B, 0x0F,
+	0xA6, 0x9C, 0xC8, 0xFC, 0x3B, 0x67, 0x21, 0xFA, 0x4D, 0x74, 0x4B, 0x0F, 0x89, 0xBC, 0xC8, 0xFC,
+	0x8A, 0x6C, 0x20, 0xFA, 0x70, 0x74, 0x4B, 0x0F, 0xCE, 0xD9, 0xC8, 0xFC, 0x59, 0x8D, 0x20, 0xFA,
+	0x73, 0x74, 0x4B, 0x0F, 0x45, 0xE4, 0xC8, 0xFC, 0xFC, 0x90, 0x20, 0xFA, 0x7A, 0x74, 0x4B, 0x0F,
+	0x1D, 0xF4, 0xC8, 0xFC, 0x08, 0x87, 0x20, 0xFA, 0x7D, 0x74, 0x4B, 0x0F, 0xA2, 0xEF, 0xC8, 0xFC,
+	0x67, 0xC7, 0x20, 0xFA, 0x9A, 0x75, 0x4B, 0x0F, 0x12, 0x20, 0xC9, 0xFC, 0xD7, 0x25, 0x21, 0xFA,
+	0xE4, 0xC3, 0x16, 0x16, 0xFE, 0xB0, 0x5F, 0xFB, 0x5A, 0x5E, 0xDF, 0xFD, 0xB0, 0xA3, 0x1D, 0x16,
+	0x48, 0x15, 0x6D, 0xFB, 0xAB, 0x9A, 0xE9, 0xFD, 0x3C, 0xB9, 0x3E, 0x1A, 0x84, 0x8B, 0xFA, 0xFC,
+	0x49, 0xF5, 0x2A, 0xFB, 0xBA, 0xB9, 0x3E, 0x1A, 0x9A, 0xEB, 0xFA, 0xFC, 0x9F, 0xC5, 0x2A, 0xFB,
+	0xD1, 0xB9, 0x3E, 0x1A, 0x81, 0x9E, 0xFA, 0xFC, 0x09, 0x90, 0x2B, 0xFB, 0xE0, 0xB9, 0x3E, 0x1A,
+	0xAF, 0xD0, 0xFA, 0xFC, 0x1E, 0x1C, 0x2B, 0xFB, 0xF1, 0xB9, 0x3E, 0x1A, 0xD6, 0xCC, 0xFA, 0xFC,
+	0xF4, 0x8B, 0x2B, 0xFB, 0xB1, 0xBB, 0x3E, 0x1A, 0xF1, 0x74, 0xFB, 0xFC, 0x90, 0xD2, 0x2A, 0xFB,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x30, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x30, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x35, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x34, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x37, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xFD, 0xBB, 0x3E, 0x1A, 0xA0, 0x90, 0xFB, 0xFC, 0x51, 0xB2, 0x2B, 0xFB, 0x2B, 0xBC, 0x3E, 0x1A,
+	0xD7, 0x95, 0xFA, 0xFC, 0x16, 0xD5, 0x2B, 0xFB, 0x86, 0x55, 0x0F, 0x1B, 0x64, 0x5C, 0xC6, 0xFC,
+	0x72, 0x02, 0x4F, 0xFC, 0xBC, 0x55, 0x0F, 0x1B, 0xF4, 0x90, 0xC6, 0xFC, 0x94, 0x52, 0x4F, 0xFC,
+	0x54, 0x56, 0x0F, 0x1B, 0x8A, 0xA2, 0xC6, 0xFC, 0x60, 0xAF, 0x4E, 0xFC, 0xFC, 0x56, 0x0F, 0x1B,
+	0x1E, 0x43, 0xC7, 0xFC, 0x18, 0xA1, 0x4E, 0xFC, 0x1B, 0x57, 0x0F, 0x1B, 0xB9, 0xC8, 0xC6, 0xFC,
+	0xD7, 0x44, 0x4F, 0xFC, 0x36, 0x57, 0x0F, 0x1B, 0x9C, 0xDD, 0xC6, 0xFC, 0x01, 0x56, 0x4F, 0xFC,
+	0x36, 0x57, 0x0F, 0x1B, 0x43, 0xE1, 0xC6, 0xFC, 0x17, 0x5E, 0x4F, 0xFC, 0x3F, 0x57, 0x0F, 0x1B,
+	0x47, 0xF2, 0xC6, 0xFC, 0x07, 0x6E, 0x4F, 0xFC, 0x02, 0x5D, 0x0F, 0x1B, 0x9B, 0x59, 0xC7, 0xFC,
+	0x30, 0xCD, 0x4E, 0xFC, 0x0D, 0x5D, 0x0F, 0x1B, 0x5B, 0x68, 0xC7, 0xFC, 0x0C, 0x0F, 0x4F, 0xFC,
+	0x19, 0x4B, 0x3D, 0x23, 0x3E, 0xA1, 0x3F, 0xFE, 0x27, 0x96, 0x3F, 0xF7, 0xFE, 0x41, 0xBD, 0x24,
+	0x2C, 0x59, 0xE8, 0xFD, 0x19, 0xB5, 0x97, 0xF8, 0x25, 0x43, 0xBD, 0x24, 0x51, 0x8C, 0xE8, 0xFD,
+	0xA9, 0xC2, 0x96, 0xF8, 0x54, 0x43, 0xBD, 0x24, 0xF1, 0x5F, 0xE8, 0xFD, 0x18, 0xA6, 0x97, 0xF8,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x37, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x38, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x36, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x35, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x6A, 0x43, 0xBD, 0x24, 0x8A, 0xAA, 0xE8, 0xFD, 0x46, 0x34, 0x97, 0xF8, 0xB5, 0x43, 0xBD, 0x24,
+	0x3D, 0xDC, 0xE8, 0xFD, 0xAE, 0x15, 0x97, 0xF8, 0x6F, 0x49, 0xBD, 0x24, 0x2D, 0x59, 0xE9, 0xFD,
+	0x0A, 0x70, 0x97, 0xF8, 0x7A, 0x49, 0xBD, 0x24, 0x1B, 0x5C, 0xE9, 0xFD, 0x81, 0x7F, 0x97, 0xF8,
+	0x85, 0x49, 0xBD, 0x24, 0xC2, 0x63, 0xE9, 0xFD, 0xF1, 0xBC, 0x96, 0xF8, 0x96, 0x49, 0xBD, 0x24,
+	0xAF, 0x69, 0xE9, 0xFD, 0x5E, 0x02, 0x97, 0xF8, 0x04, 0xD4, 0x7E, 0x27, 0xFD, 0xA3, 0x4D, 0xFE,
+	0x67, 0xFD, 0x8A, 0xFA, 0xD9, 0x61, 0x37, 0x28, 0x8C, 0x9F, 0xE1, 0xFE, 0x0E, 0xCF, 0xE8, 0xF5,
+	0x5C, 0x63, 0x37, 0x28, 0x81, 0xF4, 0xE1, 0xFE, 0xD5, 0xF5, 0xE8, 0xF5, 0x9B, 0x64, 0x37, 0x28,
+	0xEE, 0xA8, 0xE1, 0xFE, 0x16, 0x7E, 0xE9, 0xF5, 0x0E, 0x66, 0x37, 0x28, 0xCF, 0x00, 0xE2, 0xFE,
+	0x4B, 0x4A, 0xE9, 0xF5, 0x31, 0x66, 0x37, 0x28, 0x59, 0x02, 0xE2, 0xFE, 0x3A, 0x81, 0xE9, 0xF5,
+	0x89, 0x66, 0x37, 0x28, 0xE7, 0x44, 0xE2, 0xFE, 0xBB, 0x2C, 0xE9, 0xF5, 0x92, 0x66, 0x37, 0x28,
+	0xD4, 0x3F, 0xE2, 0xFE, 0xDC, 0x67, 0xE9, 0xF5, 0xB0, 0x66, 0x37, 0x28, 0xAB, 0x60, 0xE2, 0xFE,
+	0xBF, 0x64, 0xE9, 0xF5, 0x4F, 0x69, 0x37, 0x28, 0x03, 0xA9, 0xE2, 0xFE, 0x2F, 0xA7, 0xE8, 0xF5,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x36, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x38, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x31, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x32, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x5B, 0x69, 0x37, 0x28, 0x01, 0xA8, 0xE2, 0xFE, 0x92, 0xE2, 0xE8, 0xF5, 0x1B, 0x6C, 0x37, 0x28,
+	0x8C, 0xAC, 0xE2, 0xFE, 0x82, 0x8A, 0xE9, 0xF5, 0x23, 0x6C, 0x37, 0x28, 0x4B, 0xB9, 0xE2, 0xFE,
+	0x84, 0x36, 0xE9, 0xF5, 0x42, 0x6C, 0x37, 0x28, 0x84, 0x92, 0xE2, 0xFE, 0xBB, 0xC4, 0xE9, 0xF5,
+	0xF1, 0x34, 0xF1, 0x28, 0x23, 0xCA, 0x2C, 0xFF, 0xEA, 0xA0, 0x65, 0xF6, 0xF4, 0x34, 0xF1, 0x28,
+	0xAA, 0xCA, 0x2C, 0xFF, 0x19, 0xA3, 0x65, 0xF6, 0x40, 0x36, 0xF1, 0x28, 0x87, 0xF9, 0x2C, 0xFF,
+	0xA0, 0x28, 0x65, 0xF6, 0x5E, 0x36, 0xF1, 0x28, 0xD6, 0x1E, 0x2D, 0xFF, 0xAC, 0xAA, 0x65, 0xF6,
+	0xC2, 0x36, 0xF1, 0x28, 0xAF, 0x55, 0x2D, 0xFF, 0xE9, 0x2D, 0x65, 0xF6, 0xD4, 0x36, 0xF1, 0x28,
+	0x05, 0x52, 0x2D, 0xFF, 0x5E, 0xA6, 0x65, 0xF6, 0xDC, 0x36, 0xF1, 0x28, 0xFC, 0x65, 0x2D, 0xFF,
+	0xD7, 0xA9, 0x65, 0xF6, 0x1A, 0x37, 0xF1, 0x28, 0xA3, 0x15, 0x2D, 0xFF, 0x12, 0x2C, 0x66, 0xF6,
+	0x22, 0x37, 0xF1, 0x28, 0x57, 0x2A, 0x2D, 0xFF, 0x33, 0xCD, 0x65, 0xF6, 0x96, 0x37, 0xF1, 0x28,
+	0x43, 0x57, 0x2D, 0xFF, 0x18, 0x5D, 0x66, 0xF6, 0xAF, 0x7C, 0x77, 0x2A, 0x06, 0xD4, 0x8E, 0xFF,
+	0x39, 0x63, 0x9A, 0xF6, 0x42, 0x71, 0xCF, 0x2B, 0xE6, 0x4B, 0xCD, 0xFF, 0xFC, 0x0D, 0x9B, 0xF7,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x37, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x38, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x37, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x36, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x56, 0x71, 0xCF, 0x2B, 0xC5, 0x48, 0xCD, 0xFF, 0x02, 0x88, 0x9B, 0xF7, 0x60, 0x71, 0xCF, 0x2B,
+	0x11, 0x71, 0xCD, 0xFF, 0xB3, 0x07, 0x9B, 0xF7, 0xDA, 0x71, 0xCF, 0x2B, 0xD1, 0xB5, 0xCD, 0xFF,
+	0xE8, 0x60, 0x9B, 0xF7, 0xFC, 0x71, 0xCF, 0x2B, 0x77, 0xDD, 0xCD, 0xFF, 0x30, 0x7A, 0x9B, 0xF7,
+	0xC5, 0x73, 0xCF, 0x2B, 0x6D, 0x40, 0xCE, 0xFF, 0xAB, 0x4C, 0x9B, 0xF7, 0x89, 0x74, 0xCF, 0x2B,
+	0xA4, 0xB2, 0xCD, 0xFF, 0x03, 0xBE, 0x9B, 0xF7, 0x93, 0x74, 0xCF, 0x2B, 0x20, 0xA5, 0xCD, 0xFF,
+	0x4B, 0x11, 0x9C, 0xF7, 0x0C, 0x76, 0xCF, 0x2B, 0xB5, 0x06, 0xCE, 0xFF, 0xBD, 0xDD, 0x9B, 0xF7,
+	0x72, 0x3F, 0x4B, 0x2D, 0x68, 0xEF, 0xCD, 0xFE, 0x4F, 0x21, 0x17, 0xFA, 0x6E, 0x1B, 0x2B, 0x30,
+	0x49, 0xE5, 0x9E, 0xFD, 0xB4, 0x00, 0xC0, 0xFA, 0x7C, 0x1B, 0x2B, 0x30, 0x2A, 0xE0, 0x9E, 0xFD,
+	0x69, 0x4B, 0xC0, 0xFA, 0xD4, 0x1B, 0x2B, 0x30, 0xCF, 0xEE, 0x9E, 0xFD, 0x2D, 0x4B, 0xC0, 0xFA,
+	0xF0, 0x1B, 0x2B, 0x30, 0x1B, 0x1B, 0x9F, 0xFD, 0xF5, 0x24, 0xC0, 0xFA, 0xF1, 0x1B, 0x2B, 0x30,
+	0xBE, 0x1C, 0x9F, 0xFD, 0xBD, 0x3F, 0xC0, 0xFA, 0xFA, 0x1B, 0x2B, 0x30, 0xE9, 0x40, 0x9F, 0xFD,
+	0x6D, 0x24, 0xC0, 0xFA, 0x26, 0x1E, 0x2B, 0x30, 0xC1, 0xD1, 0x9E, 0xFD, 0x02, 0x9D, 0xC0, 0xFA,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x32, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x30, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x33, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3F, 0x31, 0x2B, 0x30, 0x32, 0x91, 0x9F, 0xFD, 0xE5, 0xB9, 0xBF, 0xFA, 0x5C, 0x31, 0x2B, 0x30,
+	0xE7, 0x5D, 0x9F, 0xFD, 0x65, 0x57, 0xC0, 0xFA, 0x64, 0x31, 0x2B, 0x30, 0x80, 0x70, 0x9F, 0xFD,
+	0x75, 0xF1, 0xBF, 0xFA, 0x6F, 0x31, 0x2B, 0x30, 0x4F, 0x94, 0x9F, 0xFD, 0x95, 0x16, 0xC0, 0xFA,
+	0xD0, 0x31, 0x2B, 0x30, 0xD1, 0x9E, 0x9F, 0xFD, 0xC4, 0x21, 0xC0, 0xFA, 0x10, 0x34, 0x2B, 0x30,
+	0x79, 0x46, 0x9F, 0xFD, 0xEF, 0xC5, 0xC0, 0xFA, 0x21, 0x34, 0x2B, 0x30, 0x58, 0x70, 0x9F, 0xFD,
+	0x6F, 0x89, 0xC0, 0xFA, 0x22, 0x34, 0x2B, 0x30, 0xE2, 0x7C, 0x9F, 0xFD, 0xCC, 0x6E, 0xC0, 0xFA,
+	0x30, 0x34, 0x2B, 0x30, 0x42, 0x6F, 0x9F, 0xFD, 0xA5, 0xC4, 0xC0, 0xFA, 0x99, 0x34, 0x2B, 0x30,
+	0xE6, 0xAE, 0x9F, 0xFD, 0xE0, 0xDE, 0xC0, 0xFA, 0x8F, 0x74, 0xBC, 0x31, 0xAD, 0xD8, 0xEA, 0xFD,
+	0x39, 0x25, 0x8E, 0xFC, 0xE0, 0x74, 0xBC, 0x31, 0xF3, 0xE4, 0xEA, 0xFD, 0xDD, 0x86, 0x8E, 0xFC,
+	0xEA, 0x74, 0xBC, 0x31, 0x6A, 0x06, 0xEB, 0xFD, 0xD6, 0x92, 0x8E, 0xFC, 0x3F, 0x76, 0xBC, 0x31,
+	0xDA, 0x57, 0xEB, 0xFD, 0x3B, 0x6F, 0x8E, 0xFC, 0x84, 0x76, 0xBC, 0x31, 0x77, 0x61, 0xEB, 0xFD,
+	0x46, 0x04, 0x8E, 0xFC, 0xBE, 0x1C, 0x7D, 0x32, 0x1B, 0x84, 0x3F, 0xFE, 0x18, 0x70, 0xED, 0xFB,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x32, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x31, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x31, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x35, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x1E, 0x1E, 0x7D, 0x32, 0xD9, 0xB4, 0x3F, 0xFE, 0x8F, 0x71, 0xED, 0xFB, 0xBB, 0x1E, 0x7D, 0x32,
+	0xB6, 0x2D, 0x40, 0xFE, 0x19, 0x50, 0xED, 0xFB, 0xBF, 0x1E, 0x7D, 0x32, 0x62, 0x2C, 0x40, 0xFE,
+	0xD7, 0x7F, 0xED, 0xFB, 0xD6, 0x1E, 0x7D, 0x32, 0xF8, 0xF1, 0x3F, 0xFE, 0xE9, 0x1E, 0xEE, 0xFB,
+	0xDC, 0x1E, 0x7D, 0x32, 0x4E, 0xF8, 0x3F, 0xFE, 0x4A, 0x11, 0xEE, 0xFB, 0xC1, 0x34, 0x7D, 0x32,
+	0x48, 0x94, 0x40, 0xFE, 0x86, 0xAA, 0xED, 0xFB, 0x06, 0x35, 0x7D, 0x32, 0xBC, 0x42, 0x40, 0xFE,
+	0x5C, 0x6B, 0xEE, 0xFB, 0x0A, 0x35, 0x7D, 0x32, 0x81, 0x57, 0x40, 0xFE, 0x27, 0x42, 0xEE, 0xFB,
+	0x29, 0x35, 0x7D, 0x32, 0xCA, 0x80, 0x40, 0xFE, 0x27, 0x5B, 0xEE, 0xFB, 0xDE, 0x70, 0xB5, 0x32,
+	0x29, 0x0F, 0x81, 0xFE, 0xCD, 0x6C, 0x4A, 0xFB, 0x03, 0x71, 0xB5, 0x32, 0xF5, 0xA8, 0x80, 0xFE,
+	0x56, 0xBB, 0x4A, 0xFB, 0x6B, 0x71, 0xB5, 0x32, 0x88, 0xEA, 0x80, 0xFE, 0xA6, 0x5B, 0x4B, 0xFB,
+	0xB0, 0x71, 0xB5, 0x32, 0x93, 0x1D, 0x81, 0xFE, 0x1F, 0xFE, 0x4A, 0xFB, 0xE3, 0x71, 0xB5, 0x32,
+	0xA7, 0x2D, 0x81, 0xFE, 0x4A, 0x58, 0x4B, 0xFB, 0x16, 0x73, 0xB5, 0x32, 0x70, 0x58, 0x81, 0xFE,
+	0x76, 0x1D, 0x4B, 0xFB, 0x44, 0x73, 0xB5, 0x32, 0xD3, 0x4B, 0x81, 0xFE, 0x23, 0x79, 0x4B, 0xFB,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x32, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x39, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x37, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x37, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x68, 0x73, 0xB5, 0x32, 0xB5, 0x8D, 0x81, 0xFE, 0xAF, 0x4C, 0x4B, 0xFB, 0x8C, 0x73, 0xB5, 0x32,
+	0xAC, 0xB6, 0x81, 0xFE, 0x9E, 0xC5, 0x4A, 0xFB, 0x96, 0x73, 0xB5, 0x32, 0x00, 0xAE, 0x81, 0xFE,
+	0x98, 0x26, 0x4B, 0xFB, 0xE5, 0x73, 0xB5, 0x32, 0x32, 0xCC, 0x81, 0xFE, 0xF6, 0x88, 0x4B, 0xFB,
+	0xF6, 0x46, 0x97, 0x37, 0xAF, 0xF4, 0x5E, 0xFE, 0x65, 0xE4, 0x4D, 0xFF, 0x4D, 0x24, 0xAA, 0x39,
+	0xC9, 0x91, 0x4C, 0xFF, 0x6D, 0xE8, 0xFD, 0xFB, 0x5E, 0x24, 0xAA, 0x39, 0x6D, 0xA0, 0x4C, 0xFF,
+	0x72, 0x27, 0xFE, 0xFB, 0x7D, 0x24, 0xAA, 0x39, 0x04, 0xBC, 0x4C, 0xFF, 0xF9, 0x3B, 0xFE, 0xFB,
+	0xE5, 0x24, 0xAA, 0x39, 0x89, 0x01, 0x4D, 0xFF, 0xD8, 0xE6, 0xFD, 0xFB, 0xF7, 0x24, 0xAA, 0x39,
+	0x96, 0x0A, 0x4D, 0xFF, 0xFA, 0x48, 0xFE, 0xFB, 0x30, 0x25, 0xAA, 0x39, 0x4E, 0xA8, 0x4C, 0xFF,
+	0x5D, 0xB4, 0xFE, 0xFB, 0x92, 0x25, 0xAA, 0x39, 0x7F, 0xDB, 0x4C, 0xFF, 0xB4, 0xB9, 0xFE, 0xFB,
+	0x97, 0x25, 0xAA, 0x39, 0x43, 0xDF, 0x4C, 0xFF, 0x65, 0xF8, 0xFE, 0xFB, 0x58, 0x26, 0xAA, 0x39,
+	0xBF, 0x3A, 0x4D, 0xFF, 0x4C, 0x10, 0xFE, 0xFB, 0x6F, 0x26, 0xAA, 0x39, 0x95, 0x73, 0x4D, 0xFF,
+	0x51, 0xEC, 0xFD, 0xFB, 0xCD, 0x26, 0xAA, 0x39, 0x7A, 0x99, 0x4D, 0xFF, 0x74, 0xE9, 0xFD, 0xFB,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x38, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x37, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x35, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xDC, 0x26, 0xAA, 0x39, 0xB0, 0x92, 0x4D, 0xFF, 0x40, 0x35, 0xFE, 0xFB, 0x14, 0x27, 0xAA, 0x39,
+	0x18, 0x26, 0x4D, 0xFF, 0xA2, 0xDB, 0xFE, 0xFB, 0x16, 0x27, 0xAA, 0x39, 0xDF, 0x38, 0x4D, 0xFF,
+	0xBC, 0xDA, 0xFE, 0xFB, 0x3F, 0x27, 0xAA, 0x39, 0x6E, 0x76, 0x4D, 0xFF, 0xD5, 0xE7, 0xFE, 0xFB,
+	0x95, 0x27, 0xAA, 0x39, 0xF0, 0x7B, 0x4D, 0xFF, 0x09, 0xF4, 0xFE, 0xFB, 0x64, 0x99, 0x2F, 0x3A,
+	0x6F, 0x8C, 0xA6, 0xFF, 0xFF, 0xE0, 0xEA, 0xFA, 0x6B, 0x99, 0x2F, 0x3A, 0x12, 0xA6, 0xA6, 0xFF,
+	0x5C, 0xC4, 0xEA, 0xFA, 0x8C, 0x99, 0x2F, 0x3A, 0xE4, 0xC2, 0xA6, 0xFF, 0xDA, 0x2E, 0xEA, 0xFA,
+	0x8E, 0x99, 0x2F, 0x3A, 0x08, 0xD3, 0xA6, 0xFF, 0x68, 0x33, 0xEA, 0xFA, 0xC0, 0x99, 0x2F, 0x3A,
+	0x32, 0xAF, 0xA6, 0xFF, 0x97, 0xBF, 0xEA, 0xFA, 0xEE, 0x99, 0x2F, 0x3A, 0x48, 0xFD, 0xA6, 0xFF,
+	0xCE, 0xDD, 0xEA, 0xFA, 0x7C, 0x9A, 0x2F, 0x3A, 0xAC, 0x44, 0xA7, 0xFF, 0xBF, 0xE5, 0xE9, 0xFA,
+	0x0C, 0x9B, 0x2F, 0x3A, 0xB1, 0x1E, 0xA7, 0xFF, 0x8F, 0x36, 0xEA, 0xFA, 0x84, 0x9B, 0x2F, 0x3A,
+	0xBC, 0x5E, 0xA7, 0xFF, 0x66, 0x2F, 0xEA, 0xFA, 0x95, 0x9B, 0x2F, 0x3A, 0x80, 0x62, 0xA7, 0xFF,
+	0xA1, 0xA2, 0xEA, 0xFA, 0xF2, 0x9B, 0x2F, 0x3A, 0x33, 0x95, 0xA7, 0xFF, 0xC1, 0x09, 0xEB, 0xFA,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x37, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x31, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x39, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x31, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xD0, 0x84, 0x5F, 0x3B, 0x49, 0x6E, 0x7A, 0xFF, 0xBC, 0xF4, 0x3F, 0xFD, 0xBC, 0x36, 0x0D, 0x3C,
+	0xF9, 0x45, 0xC2, 0xFE, 0xF0, 0x9E, 0x9A, 0xFD, 0x54, 0xEB, 0x33, 0x3C, 0x8B, 0x93, 0xE8, 0xFE,
+	0x81, 0x49, 0xCA, 0xFD, 0xB0, 0xEC, 0x33, 0x3C, 0x5B, 0x63, 0xE8, 0xFE, 0xE1, 0xCD, 0xCA, 0xFD,
+	0x4B, 0xEE, 0x33, 0x3C, 0x2A, 0xAF, 0xE8, 0xFE, 0xC2, 0x38, 0xCB, 0xFD, 0x63, 0xEE, 0x33, 0x3C,
+	0x49, 0xCB, 0xE8, 0xFE, 0x33, 0x2D, 0xCB, 0xFD, 0x98, 0xEE, 0x33, 0x3C, 0xD5, 0xFB, 0xE8, 0xFE,
+	0x51, 0xC3, 0xCA, 0xFD, 0x00, 0x44, 0x39, 0x3C, 0x8B, 0x37, 0xE9, 0xFE, 0xFD, 0x67, 0xCA, 0xFD,
+	0x2D, 0x44, 0x39, 0x3C, 0xAE, 0x7D, 0xE9, 0xFE, 0x06, 0xAE, 0xCA, 0xFD, 0x64, 0x93, 0xF9, 0x3E,
+	0xB9, 0xFC, 0xF0, 0xFF, 0x39, 0x35, 0x70, 0xFE, 0x21, 0x5A, 0x9D, 0x40, 0xB8, 0x36, 0x10, 0xFB,
+	0xB7, 0xDE, 0xA6, 0x00, 0x62, 0xC9, 0xB9, 0x41, 0xAF, 0xDF, 0x3F, 0xFB, 0x5C, 0xE6, 0xCF, 0x01,
+	0xC2, 0x0A, 0x41, 0x44, 0x24, 0x1A, 0xA5, 0xFA, 0x3F, 0x09, 0x71, 0x03, 0xCC, 0xAA, 0xF1, 0x48,
+	0xDD, 0x5D, 0x85, 0xFC, 0x63, 0x51, 0x18, 0x01, 0x36, 0x2E, 0xFB, 0x4B, 0x58, 0xA2, 0x4B, 0xFD,
+	0xBB, 0x02, 0x72, 0x02, 0x9D, 0x2E, 0xFB, 0x4B, 0xE6, 0xDE, 0x4B, 0xFD, 0x88, 0x0E, 0x72, 0x02,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x31, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x30, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x32, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x39, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x30, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xBF, 0x2E, 0xFB, 0x4B, 0xCE, 0x17, 0x4C, 0xFD, 0x08, 0x0F, 0x72, 0x02, 0x82, 0x2F, 0xFB, 0x4B,
+	0xC5, 0xCF, 0x4B, 0xFD, 0x2F, 0xD3, 0x72, 0x02, 0x42, 0x84, 0xFB, 0x4B, 0x95, 0x25, 0x4C, 0xFD,
+	0x9C, 0x2D, 0x72, 0x02, 0x44, 0x84, 0xFB, 0x4B, 0x02, 0x19, 0x4C, 0xFD, 0xF3, 0x5D, 0x72, 0x02,
+	0x00, 0x85, 0xFB, 0x4B, 0x45, 0x1A, 0x4C, 0xFD, 0x4B, 0xD9, 0x72, 0x02, 0x0C, 0x85, 0xFB, 0x4B,
+	0x49, 0x2E, 0x4C, 0xFD, 0xAD, 0xFC, 0x72, 0x02, 0x23, 0x85, 0xFB, 0x4B, 0xE9, 0x4E, 0x4C, 0xFD,
+	0xFC, 0xF9, 0x72, 0x02, 0xF4, 0xF1, 0x0F, 0x4E, 0x67, 0x8D, 0xCE, 0xFC, 0x28, 0x3A, 0x02, 0x03,
+	0x4A, 0xF3, 0x0F, 0x4E, 0xA0, 0xD6, 0xCE, 0xFC, 0x17, 0xB4, 0x01, 0x03, 0x69, 0xF3, 0x0F, 0x4E,
+	0xCF, 0xF4, 0xCE, 0xFC, 0x97, 0xCD, 0x01, 0x03, 0xBD, 0xF3, 0x0F, 0x4E, 0x12, 0x46, 0xCF, 0xFC,
+	0xD8, 0xA0, 0x01, 0x03, 0x6E, 0xF9, 0x0F, 0x4E, 0x13, 0xAC, 0xCF, 0xFC, 0x2B, 0xDF, 0x01, 0x03,
+	0xCB, 0x51, 0x74, 0x53, 0x5A, 0xCD, 0x79, 0xFB, 0x4F, 0xF3, 0xF3, 0x07, 0x9B, 0xE9, 0x36, 0x5A,
+	0x3C, 0x4C, 0xE5, 0xFC, 0xB0, 0x40, 0xEB, 0x05, 0x57, 0xEA, 0x36, 0x5A, 0xDB, 0x86, 0xE5, 0xFC,
+	0x5D, 0xC1, 0xEA, 0x05, 0x63, 0xEA, 0x36, 0x5A, 0x24, 0xB4, 0xE5, 0xFC, 0x39, 0x34, 0xEA, 0x05,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x37, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x35, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x33, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x37, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x7C, 0xEA, 0x36, 0x5A, 0x5D, 0xC5, 0xE5, 0xFC, 0x22, 0x9E, 0xEA, 0x05, 0xD0, 0xEA, 0x36, 0x5A,
+	0x80, 0xD2, 0xE5, 0xFC, 0x8D, 0x7C, 0xEA, 0x05, 0x27, 0xEB, 0x36, 0x5A, 0xD1, 0xB2, 0xE5, 0xFC,
+	0x13, 0x16, 0xEB, 0x05, 0x2A, 0xEB, 0x36, 0x5A, 0xB4, 0xCB, 0xE5, 0xFC, 0x4B, 0xC6, 0xEA, 0x05,
+	0x4A, 0x40, 0x3C, 0x5A, 0x5C, 0x50, 0xE6, 0xFC, 0x02, 0x21, 0xEA, 0x05, 0x09, 0x41, 0x3C, 0x5A,
+	0x26, 0x43, 0xE6, 0xFC, 0x86, 0xE4, 0xEA, 0x05, 0xDD, 0xB6, 0xB4, 0x5C, 0x83, 0xFF, 0x83, 0xFC,
+	0xC7, 0xBF, 0x96, 0x08, 0xFD, 0xB6, 0xB4, 0x5C, 0xD3, 0x2A, 0x84, 0xFC, 0x59, 0xD0, 0x96, 0x08,
+	0x8C, 0xB7, 0xB4, 0x5C, 0x9E, 0x02, 0x84, 0xFC, 0x9E, 0x0C, 0x97, 0x08, 0x8E, 0xB7, 0xB4, 0x5C,
+	0x06, 0x12, 0x84, 0xFC, 0xFD, 0x03, 0x97, 0x08, 0x5E, 0xBC, 0xB4, 0x5C, 0xA6, 0x67, 0x84, 0xFC,
+	0x8A, 0xB1, 0x96, 0x08, 0xCD, 0xBC, 0xB4, 0x5C, 0xFC, 0xA9, 0x84, 0xFC, 0x55, 0x75, 0x96, 0x08,
+	0xD5, 0xBC, 0xB4, 0x5C, 0xE4, 0x9C, 0x84, 0xFC, 0x5F, 0xC2, 0x96, 0x08, 0x02, 0xBD, 0xB4, 0x5C,
+	0xDD, 0x49, 0x84, 0xFC, 0x7B, 0xDF, 0x96, 0x08, 0x12, 0xBD, 0xB4, 0x5C, 0xA1, 0x51, 0x84, 0xFC,
+	0xF8, 0x39, 0x97, 0x08, 0x18, 0xBD, 0xB4, 0x5C, 0x83, 0x57, 0x84, 0xFC, 0x72, 0x39, 0x97, 0x08,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x36, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x33, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x35, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x48, 0xBD, 0xB4, 0x5C, 0x4B, 0x57, 0x84, 0xFC, 0x0E, 0x85, 0x97, 0x08, 0xE1, 0xBD, 0xB4, 0x5C,
+	0x98, 0xBF, 0x84, 0xFC, 0xBD, 0x9B, 0x97, 0x08, 0x34, 0xBF, 0xB4, 0x5C, 0x0A, 0x1B, 0x85, 0xFC,
+	0x17, 0x68, 0x97, 0x08, 0x49, 0xBF, 0xB4, 0x5C, 0x42, 0x06, 0x85, 0xFC, 0x77, 0xA7, 0x97, 0x08,
+	0xE5, 0xF3, 0xC3, 0x5E, 0x61, 0x96, 0x0F, 0xFD, 0x64, 0x37, 0xE0, 0x08, 0x19, 0xF9, 0xC3, 0x5E,
+	0x9A, 0xD5, 0x0F, 0xFD, 0xC2, 0xB9, 0xDF, 0x08, 0x36, 0xF9, 0xC3, 0x5E, 0x16, 0xF4, 0x0F, 0xFD,
+	0xA0, 0xD2, 0xDF, 0x08, 0x5D, 0xF9, 0xC3, 0x5E, 0x0D, 0xDA, 0x0F, 0xFD, 0x67, 0x86, 0xE0, 0x08,
+	0x92, 0xF9, 0xC3, 0x5E, 0x0F, 0x24, 0x10, 0xFD, 0x35, 0xA9, 0xDF, 0x08, 0xCE, 0xF9, 0xC3, 0x5E,
+	0x77, 0x35, 0x10, 0xFD, 0x64, 0x2B, 0xE0, 0x08, 0x71, 0xFB, 0xC3, 0x5E, 0xEC, 0x96, 0x10, 0xFD,
+	0x5E, 0x60, 0xE0, 0x08, 0x3F, 0xA2, 0x63, 0x60, 0x24, 0x22, 0x90, 0xFD, 0xC0, 0x33, 0xC2, 0x00,
+	0x73, 0xA2, 0x63, 0x60, 0xAE, 0x0A, 0x90, 0xFD, 0x0B, 0xBB, 0xC2, 0x00, 0xC4, 0xA2, 0x63, 0x60,
+	0x5B, 0x34, 0x90, 0xFD, 0x96, 0x79, 0xC2, 0x00, 0xF2, 0xA2, 0x63, 0x60, 0x32, 0x62, 0x90, 0xFD,
+	0x9D, 0xA4, 0xC2, 0x00, 0x03, 0xA3, 0x63, 0x60, 0x39, 0xE9, 0x8F, 0xFD, 0x19, 0x05, 0xC3, 0x00,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x34, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x31, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x32, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x32, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x36, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x81, 0xA3, 0x63, 0x60, 0x4C, 0x2D, 0x90, 0xFD, 0xB0, 0x06, 0xC3, 0x00, 0x4D, 0xA8, 0x63, 0x60,
+	0x38, 0xA0, 0x90, 0xFD, 0xE6, 0x90, 0xC2, 0x00, 0xE1, 0xA8, 0x63, 0x60, 0x7A, 0x04, 0x91, 0xFD,
+	0xD8, 0x64, 0xC2, 0x00, 0x32, 0xA9, 0x63, 0x60, 0x00, 0xB9, 0x90, 0xFD, 0xA9, 0x4A, 0xC3, 0x00,
+	0x92, 0xB9, 0xBB, 0x61, 0x48, 0x34, 0xFC, 0xFD, 0x24, 0x2F, 0xCA, 0x01, 0x1F, 0xF5, 0xED, 0x61,
+	0x20, 0xE0, 0xEF, 0xFD, 0xC2, 0xA6, 0x58, 0x02, 0x3D, 0xF5, 0xED, 0x61, 0x72, 0xFD, 0xEF, 0xFD,
+	0xA9, 0x9F, 0x58, 0x02, 0x4E, 0xF5, 0xED, 0x61, 0xDC, 0xE3, 0xEF, 0xFD, 0x00, 0xD6, 0x58, 0x02,
+	0x5E, 0xF5, 0xED, 0x61, 0x0E, 0xE4, 0xEF, 0xFD, 0xB4, 0x2A, 0x59, 0x02, 0x63, 0xF5, 0xED, 0x61,
+	0x45, 0xFB, 0xEF, 0xFD, 0x22, 0xBE, 0x58, 0x02, 0x65, 0xF5, 0xED, 0x61, 0xAA, 0xED, 0xEF, 0xFD,
+	0xEC, 0xF1, 0x58, 0x02, 0x76, 0xF5, 0xED, 0x61, 0xAD, 0xF2, 0xEF, 0xFD, 0xFE, 0x31, 0x59, 0x02,
+	0x93, 0xF5, 0xED, 0x61, 0x69, 0x25, 0xF0, 0xFD, 0x4E, 0x77, 0x58, 0x02, 0xB3, 0xF5, 0xED, 0x61,
+	0x0E, 0x49, 0xF0, 0xFD, 0xDA, 0x78, 0x58, 0x02, 0xC2, 0xF5, 0xED, 0x61, 0xAC, 0x20, 0xF0, 0xFD,
+	0xAE, 0xB8, 0x58, 0x02, 0xD5, 0xF5, 0xED, 0x61, 0xC0, 0x14, 0xF0, 0xFD, 0x9F, 0x43, 0x59, 0x02,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x38, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x33, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x35,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x37, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x81, 0xA0, 0xF8, 0x61, 0x8C, 0x18, 0xF0, 0xFD, 0xF0, 0x7A, 0x59, 0x02, 0x83, 0xA2, 0xF8, 0x61,
+	0x22, 0xC9, 0xF0, 0xFD, 0xE0, 0x73, 0x59, 0x02, 0x52, 0x8A, 0xC4, 0x68, 0x26, 0x1D, 0x06, 0xFF,
+	0xFE, 0x12, 0xD8, 0x00, 0x87, 0x8B, 0xC4, 0x68, 0xAA, 0x73, 0x06, 0xFF, 0x92, 0xA7, 0xD8, 0x00,
+	0x99, 0x8B, 0xC4, 0x68, 0x99, 0x82, 0x06, 0xFF, 0x77, 0xCA, 0xD8, 0x00, 0x9A, 0x8B, 0xC4, 0x68,
+	0xC7, 0x8C, 0x06, 0xFF, 0x58, 0xC1, 0xD8, 0x00, 0x47, 0xA0, 0xC4, 0x68, 0x6A, 0xC9, 0x06, 0xFF,
+	0x4E, 0x08, 0xD8, 0x00, 0x59, 0xA0, 0xC4, 0x68, 0x84, 0xD9, 0x06, 0xFF, 0x34, 0x24, 0xD8, 0x00,
+	0x5A, 0xA0, 0xC4, 0x68, 0x9D, 0xE3, 0x06, 0xFF, 0x38, 0x1D, 0xD8, 0x00, 0x62, 0xA0, 0xC4, 0x68,
+	0x4C, 0xF2, 0x06, 0xFF, 0xAB, 0xB4, 0xD7, 0x00, 0xA8, 0x0F, 0xC8, 0x69, 0xC8, 0xBE, 0x16, 0xFF,
+	0x26, 0x81, 0x07, 0x02, 0xDB, 0xD4, 0x81, 0x6D, 0xE0, 0x8A, 0x04, 0xFF, 0x78, 0xEF, 0x2F, 0x04,
+	0x1A, 0xD5, 0x81, 0x6D, 0xF7, 0x32, 0x04, 0xFF, 0x17, 0x83, 0x30, 0x04, 0x80, 0xD5, 0x81, 0x6D,
+	0x09, 0x63, 0x04, 0xFF, 0xC6, 0x30, 0x30, 0x04, 0x84, 0xD5, 0x81, 0x6D, 0x15, 0x69, 0x04, 0xFF,
+	0x3E, 0x4E, 0x30, 0x04, 0x5B, 0xD6, 0x81, 0x6D, 0xDA, 0xDC, 0x04, 0xFF, 0xD1, 0xE4, 0x2F, 0x04,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x39, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x35, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x37, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x31, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x07, 0xD7, 0x81, 0x6D, 0x6E, 0xC8, 0x04, 0xFF, 0x2E, 0x6E, 0x30, 0x04, 0x19, 0xD7, 0x81, 0x6D,
+	0xA8, 0xD4, 0x04, 0xFF, 0x62, 0x9E, 0x30, 0x04, 0x97, 0xD7, 0x81, 0x6D, 0xD4, 0x1E, 0x05, 0xFF,
+	0x7A, 0xBD, 0x30, 0x04, 0x9C, 0xD7, 0x81, 0x6D, 0x0C, 0x26, 0x05, 0xFF, 0x3B, 0xAF, 0x30, 0x04,
+	0xC9, 0xD7, 0x81, 0x6D, 0x18, 0x26, 0x05, 0xFF, 0xAF, 0xE3, 0x30, 0x04, 0x53, 0xB9, 0x10, 0x6E,
+	0x7F, 0xF4, 0x5D, 0xFF, 0x29, 0xDC, 0x0C, 0x03, 0x73, 0xB9, 0x10, 0x6E, 0xEB, 0x25, 0x5E, 0xFF,
+	0x26, 0xDF, 0x0C, 0x03, 0x76, 0xB9, 0x10, 0x6E, 0x6B, 0x23, 0x5E, 0xFF, 0xDE, 0xEE, 0x0C, 0x03,
+	0xD8, 0xB9, 0x10, 0x6E, 0xBB, 0x5D, 0x5E, 0xFF, 0x5B, 0xCE, 0x0C, 0x03, 0xE1, 0xB9, 0x10, 0x6E,
+	0x81, 0x6C, 0x5E, 0xFF, 0xA8, 0x86, 0x0C, 0x03, 0xF3, 0xB9, 0x10, 0x6E, 0x59, 0x7E, 0x5E, 0xFF,
+	0x68, 0xD7, 0x0C, 0x03, 0xF5, 0xB9, 0x10, 0x6E, 0xFE, 0x71, 0x5E, 0xFF, 0x9A, 0x05, 0x0D, 0x03,
+	0x7E, 0xBB, 0x10, 0x6E, 0x80, 0xE3, 0x5E, 0xFF, 0x9A, 0xEC, 0x0C, 0x03, 0x03, 0xBC, 0x10, 0x6E,
+	0xF7, 0xF9, 0x5D, 0xFF, 0xDC, 0x34, 0x0D, 0x03, 0x08, 0xBC, 0x10, 0x6E, 0xD5, 0x03, 0x5E, 0xFF,
+	0x59, 0x19, 0x0D, 0x03, 0x1E, 0xBC, 0x10, 0x6E, 0x75, 0x0F, 0x5E, 0xFF, 0x4B, 0x99, 0x0D, 0x03,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x38, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x39, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x35,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x36, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x37, 0xBC, 0x10, 0x6E, 0x3A, 0x22, 0x5E, 0xFF, 0x52, 0xAC, 0x0D, 0x03, 0xAA, 0xBC, 0x10, 0x6E,
+	0xB7, 0x8C, 0x5E, 0xFF, 0x3E, 0x1F, 0x0D, 0x03, 0x12, 0xBE, 0x10, 0x6E, 0xAF, 0xA0, 0x5E, 0xFF,
+	0x47, 0x6C, 0x0D, 0x03, 0x99, 0xBE, 0x10, 0x6E, 0x75, 0x0A, 0x5F, 0xFF, 0x60, 0x87, 0x0D, 0x03,
+	0x60, 0x70, 0xB0, 0x72, 0x88, 0xC5, 0x80, 0xFE, 0x3F, 0x99, 0xC4, 0x05, 0xEE, 0x74, 0xE3, 0x72,
+	0x7F, 0xF5, 0x8B, 0xFE, 0xAC, 0xAF, 0x32, 0x06, 0x96, 0x75, 0xAE, 0x75, 0xAB, 0x7B, 0xF5, 0xFD,
+	0x88, 0x9C, 0xA3, 0x09, 0xC7, 0xCE, 0x0F, 0x7A, 0x72, 0x7D, 0x7C, 0xFF, 0x83, 0xA5, 0xAC, 0x05,
+	0xB7, 0x12, 0xCA, 0x7D, 0x63, 0x18, 0x20, 0xFF, 0xE2, 0xC1, 0x15, 0x0A, 0xBC, 0x12, 0xCA, 0x7D,
+	0x84, 0x25, 0x20, 0xFF, 0xA3, 0x9E, 0x15, 0x0A, 0xC0, 0x12, 0xCA, 0x7D, 0xA9, 0xE4, 0x1F, 0xFF,
+	0x1C, 0xC9, 0x15, 0x0A, 0x24, 0x18, 0xCA, 0x7D, 0x67, 0x63, 0x20, 0xFF, 0xDF, 0x50, 0x15, 0x0A,
+	0x49, 0x18, 0xCA, 0x7D, 0x0F, 0x4D, 0x20, 0xFF, 0x96, 0xE1, 0x15, 0x0A, 0x69, 0x18, 0xCA, 0x7D,
+	0x05, 0x78, 0x20, 0xFF, 0x73, 0xEB, 0x15, 0x0A, 0xDE, 0x75, 0x75, 0x82, 0xEA, 0xFE, 0xD9, 0x00,
+	0x2F, 0xA6, 0x9C, 0xF6, 0x81, 0x53, 0x13, 0x84, 0x3E, 0xF4, 0x0B, 0x00, 0x33, 0xFF, 0x70, 0xF8,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x35, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x32, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x37, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x35, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x35, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x4F, 0x8B, 0xCE, 0x87, 0x57, 0x76, 0x29, 0x01, 0x33, 0x70, 0x24, 0xFA, 0x75, 0x8B, 0xCE, 0x87,
+	0x14, 0x80, 0x29, 0x01, 0x1A, 0xCB, 0x24, 0xFA, 0x7A, 0x8B, 0xCE, 0x87, 0x90, 0xA1, 0x29, 0x01,
+	0x5E, 0x82, 0x24, 0xFA, 0xCC, 0x8B, 0xCE, 0x87, 0xC0, 0xBC, 0x29, 0x01, 0x91, 0x63, 0x24, 0xFA,
+	0x1A, 0x8E, 0xCE, 0x87, 0x58, 0x71, 0x29, 0x01, 0x5A, 0x36, 0x25, 0xFA, 0x2E, 0x8E, 0xCE, 0x87,
+	0xB7, 0xA1, 0x29, 0x01, 0xE8, 0x14, 0x25, 0xFA, 0x80, 0x8E, 0xCE, 0x87, 0x5F, 0xA9, 0x29, 0x01,
+	0xBA, 0xE9, 0x24, 0xFA, 0x47, 0xA1, 0xCE, 0x87, 0x2A, 0x0B, 0x2A, 0x01, 0xFD, 0x7D, 0x24, 0xFA,
+	0x4D, 0xA1, 0xCE, 0x87, 0xAE, 0x16, 0x2A, 0x01, 0x1D, 0x6F, 0x24, 0xFA, 0x4D, 0xA1, 0xCE, 0x87,
+	0xC0, 0x17, 0x2A, 0x01, 0x52, 0x75, 0x24, 0xFA, 0x5E, 0xA1, 0xCE, 0x87, 0xE1, 0x23, 0x2A, 0x01,
+	0xD7, 0xBE, 0x24, 0xFA, 0xD9, 0xA1, 0xCE, 0x87, 0x7C, 0x6E, 0x2A, 0x01, 0xBF, 0xA4, 0x24, 0xFA,
+	0x08, 0xA4, 0xCE, 0x87, 0x3A, 0x15, 0x2A, 0x01, 0x05, 0xE1, 0x24, 0xFA, 0x2C, 0xA4, 0xCE, 0x87,
+	0x83, 0x40, 0x2A, 0x01, 0xC9, 0x04, 0x25, 0xFA, 0x36, 0xA4, 0xCE, 0x87, 0xE2, 0x37, 0x2A, 0x01,
+	0x7B, 0x68, 0x25, 0xFA, 0x85, 0xA4, 0xCE, 0x87, 0xA7, 0x50, 0x2A, 0x01, 0xB3, 0x17, 0x25, 0xFA,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x35, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x38, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x37, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x34, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x32, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x33, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xCD, 0xDB, 0xF2, 0x88, 0x73, 0xEA, 0xEA, 0x01, 0xD4, 0x5C, 0x59, 0xF6, 0xF4, 0x97, 0xDC, 0x89,
+	0xC4, 0x71, 0xC9, 0x01, 0x06, 0xDC, 0xD3, 0xF7, 0xAC, 0x5E, 0x04, 0x93, 0x5C, 0x80, 0xAE, 0x00,
+	0x9D, 0x34, 0x38, 0xFC, 0x04, 0x14, 0x01, 0x99, 0x81, 0x99, 0x57, 0x01, 0xA1, 0xFB, 0x17, 0xFC,
+	0xDD, 0x95, 0xB0, 0x9B, 0x4B, 0xD9, 0x89, 0x02, 0xE5, 0xCE, 0x5A, 0xFC, 0x65, 0x97, 0xB0, 0x9B,
+	0xE6, 0x46, 0x8A, 0x02, 0x2B, 0x7C, 0x5A, 0xFC, 0x7C, 0x97, 0xB0, 0x9B, 0x4D, 0x5D, 0x8A, 0x02,
+	0xE0, 0xB4, 0x5A, 0xFC, 0xCC, 0x97, 0xB0, 0x9B, 0xE5, 0x83, 0x8A, 0x02, 0x77, 0x72, 0x5A, 0xFC,
+	0xFB, 0x97, 0xB0, 0x9B, 0xF4, 0xB7, 0x8A, 0x02, 0x19, 0xA1, 0x5A, 0xFC, 0x5A, 0x9D, 0xB0, 0x9B,
+	0xCA, 0xE8, 0x8A, 0x02, 0x75, 0x94, 0x5A, 0xFC, 0x79, 0x9D, 0xB0, 0x9B, 0x8C, 0x02, 0x8B, 0x02,
+	0xF7, 0xA0, 0x5A, 0xFC, 0xC9, 0xC0, 0xB0, 0x9B, 0x55, 0xD3, 0x89, 0x02, 0x61, 0xA2, 0x5B, 0xFC,
+	0x0E, 0xC2, 0xB0, 0x9B, 0x52, 0x34, 0x8A, 0x02, 0x32, 0x16, 0x5B, 0xFC, 0x0E, 0xC2, 0xB0, 0x9B,
+	0xB8, 0x37, 0x8A, 0x02, 0xE6, 0x14, 0x5B, 0xFC, 0x80, 0xC2, 0xB0, 0x9B, 0x8F, 0x68, 0x8A, 0x02,
+	0xD2, 0xED, 0x5A, 0xFC, 0x06, 0xC8, 0xB0, 0x9B, 0x06, 0xCA, 0x8A, 0x02, 0x1C, 0x12, 0x5B, 0xFC,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x33, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x33, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x34, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x34, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x31, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x09, 0xC8, 0xB0, 0x9B, 0xD8, 0xD6, 0x8A, 0x02, 0x08, 0x05, 0x5B, 0xFC, 0x23, 0xC8, 0xB0, 0x9B,
+	0xD4, 0xF6, 0x8A, 0x02, 0x12, 0x05, 0x5B, 0xFC, 0x38, 0xC8, 0xB0, 0x9B, 0xE4, 0x04, 0x8B, 0x02,
+	0xCA, 0x3F, 0x5B, 0xFC, 0x2C, 0xFC, 0xF7, 0x9B, 0x69, 0x6B, 0x98, 0x02, 0x69, 0x2E, 0x4F, 0xFD,
+	0x5D, 0xAB, 0xD7, 0x9F, 0x45, 0x03, 0x6E, 0x02, 0x77, 0x9F, 0xED, 0xFF, 0x7C, 0xAB, 0xD7, 0x9F,
+	0x3D, 0x2E, 0x6E, 0x02, 0xF6, 0x8D, 0xED, 0xFF, 0x7E, 0xAB, 0xD7, 0x9F, 0x8C, 0x33, 0x6E, 0x02,
+	0x8A, 0x82, 0xED, 0xFF, 0x98, 0xAC, 0xD7, 0x9F, 0x3E, 0xAC, 0x6D, 0x02, 0xD5, 0x02, 0xEE, 0xFF,
+	0xB9, 0xAC, 0xD7, 0x9F, 0xD6, 0xD9, 0x6D, 0x02, 0x25, 0x16, 0xEE, 0xFF, 0x01, 0xAE, 0xD7, 0x9F,
+	0x8A, 0xF0, 0x6D, 0x02, 0xFB, 0xBA, 0xED, 0xFF, 0x17, 0xAE, 0xD7, 0x9F, 0xE1, 0xF4, 0x6D, 0x02,
+	0xB2, 0x3E, 0xEE, 0xFF, 0x9F, 0xAE, 0xD7, 0x9F, 0xCD, 0x67, 0x6E, 0x02, 0x0D, 0x40, 0xEE, 0xFF,
+	0x0A, 0x04, 0xDD, 0x9F, 0x5F, 0xB7, 0x6E, 0x02, 0xF6, 0xB7, 0xED, 0xFF, 0x10, 0x04, 0xDD, 0x9F,
+	0xFE, 0x93, 0x6E, 0x02, 0xE8, 0xF9, 0xED, 0xFF, 0x25, 0x04, 0xDD, 0x9F, 0xB7, 0xC0, 0x6E, 0x02,
+	0x2E, 0xF1, 0xED, 0xFF, 0x07, 0xAC, 0x1A, 0xA0, 0x7F, 0x99, 0xD8, 0x02, 0x1C, 0x3B, 0x9E, 0xF5,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x35, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x36, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x37, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xE3, 0x6C, 0x50, 0xA7, 0xCC, 0x40, 0x5F, 0x03, 0x43, 0x4F, 0x5B, 0xFA, 0x1F, 0x6E, 0x50, 0xA7,
+	0x4D, 0x80, 0x5F, 0x03, 0x96, 0x22, 0x5B, 0xFA, 0x32, 0x6E, 0x50, 0xA7, 0xD4, 0x91, 0x5F, 0x03,
+	0x3F, 0xE4, 0x5A, 0xFA, 0x9B, 0x6E, 0x50, 0xA7, 0xB8, 0xD6, 0x5F, 0x03, 0x0E, 0xEC, 0x5A, 0xFA,
+	0xB4, 0x6E, 0x50, 0xA7, 0x9C, 0xD9, 0x5F, 0x03, 0x00, 0x06, 0x5B, 0xFA, 0xBB, 0x6E, 0x50, 0xA7,
+	0x38, 0xFF, 0x5F, 0x03, 0x47, 0xE9, 0x5A, 0xFA, 0x88, 0x6F, 0x50, 0xA7, 0xE8, 0xCA, 0x5F, 0x03,
+	0x6B, 0xDF, 0x5B, 0xFA, 0x44, 0xC4, 0x50, 0xA7, 0xFE, 0x05, 0x60, 0x03, 0x80, 0x60, 0x5B, 0xFA,
+	0x58, 0xC4, 0x50, 0xA7, 0xB2, 0x1A, 0x60, 0x03, 0x9B, 0x85, 0x5B, 0xFA, 0xD7, 0xC4, 0x50, 0xA7,
+	0xF1, 0x66, 0x60, 0x03, 0x1E, 0xCE, 0x5B, 0xFA, 0x71, 0xB5, 0x48, 0xAC, 0x54, 0x07, 0x24, 0x04,
+	0x94, 0x5F, 0xAA, 0xF8, 0x06, 0xF8, 0xDA, 0xB2, 0x85, 0x22, 0xDA, 0x03, 0xB1, 0xC9, 0xB4, 0xFB,
+	0x6F, 0x04, 0x28, 0xB7, 0x5F, 0x56, 0x9B, 0x03, 0x1B, 0xB7, 0xAC, 0xFE, 0xDF, 0x52, 0x48, 0xB7,
+	0xCA, 0x43, 0x71, 0x03, 0xF6, 0x1B, 0x66, 0xFF, 0x6F, 0x53, 0x48, 0xB7, 0x8C, 0x17, 0x71, 0x03,
+	0x0A, 0x18, 0x67, 0xFF, 0x9F, 0x53, 0x48, 0xB7, 0x50, 0x3F, 0x71, 0x03, 0x69, 0xD0, 0x66, 0xFF,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x37, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x33, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x34, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x36, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x35, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xD8, 0x53, 0x48, 0xB7, 0xB9, 0x3B, 0x71, 0x03, 0x9C, 0x3D, 0x67, 0xFF, 0xDD, 0x58, 0x48, 0xB7,
+	0xA7, 0xE0, 0x71, 0x03, 0x36, 0x2A, 0x66, 0xFF, 0xFD, 0x58, 0x48, 0xB7, 0xA6, 0x10, 0x72, 0x03,
+	0x4E, 0x25, 0x66, 0xFF, 0x06, 0x59, 0x48, 0xB7, 0xC5, 0x86, 0x71, 0x03, 0x81, 0x63, 0x66, 0xFF,
+	0x13, 0x59, 0x48, 0xB7, 0x3B, 0x88, 0x71, 0x03, 0xEB, 0xA0, 0x66, 0xFF, 0x40, 0x59, 0x48, 0xB7,
+	0x06, 0x77, 0x71, 0x03, 0x9A, 0xE7, 0x66, 0xFF, 0x63, 0x59, 0x48, 0xB7, 0xE5, 0xAE, 0x71, 0x03,
+	0xF0, 0xF3, 0x66, 0xFF, 0x80, 0x59, 0x48, 0xB7, 0x2F, 0xD1, 0x71, 0x03, 0xC0, 0x34, 0x66, 0xFF,
+	0xA0, 0x59, 0x48, 0xB7, 0xDB, 0xF8, 0x71, 0x03, 0x60, 0x3D, 0x66, 0xFF, 0x10, 0x5B, 0x48, 0xB7,
+	0xDD, 0x28, 0x72, 0x03, 0x7D, 0x93, 0x66, 0xFF, 0x9D, 0x4C, 0x60, 0xBA, 0xDF, 0xBD, 0xDE, 0x04,
+	0x35, 0xA5, 0x5C, 0xFB, 0x8E, 0xB9, 0x0A, 0xBC, 0x83, 0x68, 0x30, 0x04, 0xD3, 0x9A, 0x58, 0xFD,
+	0xF0, 0xD4, 0xAA, 0xC7, 0x54, 0xB9, 0x52, 0x01, 0x50, 0x68, 0x1A, 0x04, 0xB6, 0x2B, 0x45, 0xCA,
+	0x03, 0x89, 0x08, 0x02, 0x09, 0x5C, 0xEE, 0x00, 0xBD, 0x2B, 0x45, 0xCA, 0x03, 0x97, 0x08, 0x02,
+	0x3A, 0x79, 0xEE, 0x00, 0xE1, 0x2B, 0x45, 0xCA, 0xB3, 0x7A, 0x08, 0x02, 0x15, 0xA5, 0xEE, 0x00,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x30,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x32, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x32,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x34, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x32, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x38, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xFF, 0x80, 0x45, 0xCA, 0xB7, 0x4B, 0x09, 0x02, 0x4F, 0xCA, 0xED, 0x00, 0x0C, 0x81, 0x45, 0xCA,
+	0xA2, 0xBE, 0x08, 0x02, 0x83, 0x0E, 0xEE, 0x00, 0x29, 0x81, 0x45, 0xCA, 0x37, 0xE9, 0x08, 0x02,
+	0x48, 0xED, 0xED, 0x00, 0x68, 0x81, 0x45, 0xCA, 0x27, 0xE5, 0x08, 0x02, 0x62, 0x95, 0xEE, 0x00,
+	0x53, 0x82, 0x45, 0xCA, 0xA6, 0x5B, 0x09, 0x02, 0x8C, 0x9F, 0xED, 0x00, 0x58, 0x82, 0x45, 0xCA,
+	0xA7, 0x6B, 0x09, 0x02, 0xEF, 0x81, 0xED, 0x00, 0x5C, 0x82, 0x45, 0xCA, 0x1F, 0x6B, 0x09, 0x02,
+	0x69, 0xB7, 0xED, 0x00, 0x0A, 0x83, 0x45, 0xCA, 0xE4, 0x77, 0x09, 0x02, 0x5C, 0xDA, 0xED, 0x00,
+	0x49, 0x83, 0x45, 0xCA, 0x58, 0x6A, 0x09, 0x02, 0xF7, 0x96, 0xEE, 0x00, 0x74, 0x9C, 0x57, 0xCA,
+	0xDD, 0xE9, 0x14, 0x02, 0x01, 0x8F, 0x4B, 0x01, 0x2D, 0x9D, 0x57, 0xCA, 0xDF, 0xFA, 0x14, 0x02,
+	0xE2, 0x0D, 0x4C, 0x01, 0x34, 0x9D, 0x57, 0xCA, 0xE1, 0xE5, 0x14, 0x02, 0x86, 0x3A, 0x4C, 0x01,
+	0x9F, 0x9D, 0x57, 0xCA, 0x8F, 0x31, 0x15, 0x02, 0x1A, 0x52, 0x4C, 0x01, 0xA6, 0x9D, 0x57, 0xCA,
+	0xE2, 0x49, 0x15, 0x02, 0xF3, 0xF4, 0x4B, 0x01, 0x6C, 0x9E, 0x57, 0xCA, 0x7F, 0xA1, 0x15, 0x02,
+	0x3F, 0x41, 0x4B, 0x01, 0xF1, 0x9E, 0x57, 0xCA, 0x97, 0xE7, 0x15, 0x02, 0xD7, 0x83, 0x4B, 0x01,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x32, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x30, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x33, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x35, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x32, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x31, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x08, 0x9F, 0x57, 0xCA, 0xAE, 0x7F, 0x15, 0x02, 0x2F, 0xC5, 0x4B, 0x01, 0x9A, 0x9F, 0x57, 0xCA,
+	0xA8, 0xD8, 0x15, 0x02, 0x27, 0x1C, 0x4C, 0x01, 0x40, 0x9B, 0x1A, 0xD8, 0xD7, 0x2C, 0x7F, 0x01,
+	0xF7, 0x29, 0xBB, 0x05, 0x61, 0x9B, 0x1A, 0xD8, 0x47, 0x56, 0x7F, 0x01, 0xA1, 0x46, 0xBB, 0x05,
+	0x74, 0x9B, 0x1A, 0xD8, 0xEE, 0x53, 0x7F, 0x01, 0x40, 0xB8, 0xBB, 0x05, 0x77, 0x9B, 0x1A, 0xD8,
+	0x7D, 0x5E, 0x7F, 0x01, 0x79, 0xC0, 0xBB, 0x05, 0xF5, 0x9B, 0x1A, 0xD8, 0x0E, 0xB1, 0x7F, 0x01,
+	0x13, 0xCF, 0xBB, 0x05, 0xA0, 0x9C, 0x1A, 0xD8, 0xD4, 0x04, 0x7F, 0x01, 0x36, 0xD6, 0xBB, 0x05,
+	0xAE, 0x9C, 0x1A, 0xD8, 0x4B, 0x20, 0x7F, 0x01, 0x9D, 0x01, 0xBC, 0x05, 0x22, 0x9E, 0x1A, 0xD8,
+	0xD1, 0x63, 0x7F, 0x01, 0xF1, 0xE1, 0xBB, 0x05, 0x2A, 0x9E, 0x1A, 0xD8, 0x03, 0x73, 0x7F, 0x01,
+	0xA5, 0xDF, 0xBB, 0x05, 0x31, 0x9E, 0x1A, 0xD8, 0x81, 0x5A, 0x7F, 0x01, 0x45, 0x40, 0xBC, 0x05,
+	0x55, 0xB1, 0x1A, 0xD8, 0xE9, 0xD9, 0x7F, 0x01, 0x8B, 0xC1, 0xBB, 0x05, 0x02, 0x41, 0x1F, 0xD8,
+	0x51, 0xDB, 0x77, 0x01, 0xBC, 0x4C, 0x00, 0x06, 0x27, 0xFE, 0x4A, 0xD8, 0xF8, 0x0F, 0x82, 0x01,
+	0x91, 0xAE, 0x1C, 0x06, 0xDD, 0xA4, 0xF9, 0xD8, 0xA8, 0x4C, 0xF6, 0x01, 0x45, 0xDE, 0x78, 0x06,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x39, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x37, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x33, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x32, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x39, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x33, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x35,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x36, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x32, 0x30, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x39, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x12, 0xA5, 0xF9, 0xD8, 0x9B, 0xEC, 0xF5, 0x01, 0x08, 0x4C, 0x79, 0x06, 0x19, 0xA5, 0xF9, 0xD8,
+	0x53, 0xF4, 0xF5, 0x01, 0x6F, 0x63, 0x79, 0x06, 0x1E, 0xA5, 0xF9, 0xD8, 0xC5, 0x05, 0xF6, 0x01,
+	0x13, 0x75, 0x79, 0x06, 0x20, 0xA5, 0xF9, 0xD8, 0x8F, 0x0C, 0xF6, 0x01, 0x91, 0x01, 0x79, 0x06,
+	0x22, 0xA5, 0xF9, 0xD8, 0xA3, 0x15, 0xF6, 0x01, 0x75, 0xFE, 0x78, 0x06, 0x6E, 0xA5, 0xF9, 0xD8,
+	0x72, 0x2A, 0xF6, 0x01, 0x0D, 0xD8, 0x79, 0x06, 0x6E, 0xA5, 0xF9, 0xD8, 0xF7, 0x2F, 0xF6, 0x01,
+	0x68, 0xCA, 0x79, 0x06, 0xAD, 0xA5, 0xF9, 0xD8, 0xD4, 0x72, 0xF6, 0x01, 0x0B, 0x34, 0x79, 0x06,
+	0xF7, 0xA6, 0xF9, 0xD8, 0x31, 0x13, 0xF7, 0x01, 0x76, 0xEA, 0x78, 0x06, 0x9A, 0xA7, 0xF9, 0xD8,
+	0x5B, 0x04, 0xF7, 0x01, 0x04, 0x4A, 0x79, 0x06, 0xB7, 0xA7, 0xF9, 0xD8, 0x49, 0x1C, 0xF7, 0x01,
+	0x7F, 0x94, 0x79, 0x06, 0x83, 0xE4, 0xBE, 0xDB, 0xB5, 0xB0, 0xAC, 0x02, 0x15, 0xA2, 0x43, 0x07,
+	0x33, 0xA9, 0x86, 0xDF, 0xB0, 0x78, 0x6D, 0x02, 0x1C, 0xC4, 0x90, 0x09, 0x45, 0xA9, 0x86, 0xDF,
+	0xEC, 0x3D, 0x6D, 0x02, 0xB6, 0x43, 0x91, 0x09, 0x8B, 0xA9, 0x86, 0xDF, 0xA7, 0xB5, 0x6D, 0x02,
+	0xDB, 0x73, 0x90, 0x09, 0x98, 0xA9, 0x86, 0xDF, 0x17, 0xA8, 0x6D, 0x02, 0xCF, 0xB7, 0x90, 0x09,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x39, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x32, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36,
+	0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x32, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x38, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x38, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x33, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xB6, 0xA9, 0x86, 0xDF, 0xF5, 0xD1, 0x6D, 0x02, 0xBB, 0xD3, 0x90, 0x09, 0xCC, 0xA9, 0x86, 0xDF,
+	0x20, 0xA9, 0x6D, 0x02, 0x71, 0x27, 0x91, 0x09, 0xCE, 0xA9, 0x86, 0xDF, 0x5C, 0xBA, 0x6D, 0x02,
+	0x54, 0x2D, 0x91, 0x09, 0xE2, 0xA9, 0x86, 0xDF, 0xD1, 0xCA, 0x6D, 0x02, 0x48, 0x0E, 0x91, 0x09,
+	0x15, 0xAB, 0x86, 0xDF, 0xE4, 0xF1, 0x6D, 0x02, 0xC0, 0xF5, 0x90, 0x09, 0x75, 0xAB, 0x86, 0xDF,
+	0x07, 0x14, 0x6E, 0x02, 0xDF, 0xA0, 0x91, 0x09, 0x7A, 0xAB, 0x86, 0xDF, 0x4D, 0x39, 0x6E, 0x02,
+	0x17, 0x5D, 0x91, 0x09, 0x93, 0xAB, 0x86, 0xDF, 0x6D, 0x52, 0x6E, 0x02, 0x78, 0xBB, 0x90, 0x09,
+	0x7A, 0xDD, 0xC8, 0xE0, 0x29, 0x48, 0x21, 0x03, 0x45, 0x4F, 0xC1, 0x00, 0xDC, 0xDD, 0xC8, 0xE0,
+	0x80, 0x66, 0x21, 0x03, 0xA1, 0x77, 0xC1, 0x00, 0xDF, 0xDD, 0xC8, 0xE0, 0xBF, 0x70, 0x21, 0x03,
+	0xEC, 0x8A, 0xC1, 0x00, 0x56, 0xDF, 0xC8, 0xE0, 0xE5, 0xB5, 0x21, 0x03, 0x5B, 0x75, 0xC1, 0x00,
+	0x71, 0xDF, 0xC8, 0xE0, 0x53, 0xD2, 0x21, 0x03, 0x5B, 0x58, 0xC1, 0x00, 0xD9, 0xDF, 0xC8, 0xE0,
+	0xD6, 0x12, 0x22, 0x03, 0x25, 0x58, 0xC1, 0x00, 0x01, 0x88, 0xC9, 0xE0, 0x7A, 0xF8, 0x20, 0x03,
+	0x89, 0xA8, 0xC1, 0x00, 0xC3, 0x88, 0xC9, 0xE0, 0x02, 0x61, 0x21, 0x03, 0xD4, 0x5B, 0xC2, 0x00,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x31, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x33,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x38, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x39, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x31, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x30, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34, 0x34, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x37,
+	0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x33, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38, 0x39, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x33,
+	0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x38, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0xE8, 0x88, 0xC9, 0xE0, 0x94, 0x98, 0x21, 0x03, 0x28, 0x4D, 0xC2, 0x00, 0x00, 0x8A, 0xC9, 0xE0,
+	0x74, 0xAA, 0x21, 0x03, 0xAF, 0xA3, 0xC1, 0x00, 0x41, 0x8A, 0xC9, 0xE0, 0xF3, 0xA6, 0x21, 0x03,
+	0x67, 0x55, 0xC2, 0x00, 0x63, 0x8A, 0xC9, 0xE0, 0x25, 0xE4, 0x21, 0x03, 0xBD, 0x5C, 0xC2, 0x00,
+	0x85, 0x8A, 0xC9, 0xE0, 0x44, 0x00, 0x22, 0x03, 0x56, 0xE4, 0xC1, 0x00, 0x8B, 0x8A, 0xC9, 0xE0,
+	0x13, 0x20, 0x22, 0x03, 0x2D, 0xB6, 0xC1, 0x00, 0x93, 0x8A, 0xC9, 0xE0, 0x1F, 0x0B, 0x22, 0x03,
+	0x23, 0x11, 0xC2, 0x00, 0xEC, 0x5C, 0xF2, 0xE0, 0x96, 0x69, 0x3C, 0x03, 0x40, 0x9B, 0x15, 0x01,
+	0x8F, 0xD7, 0x86, 0xE6, 0x93, 0xC1, 0xC1, 0x03, 0x0C, 0x79, 0xEE, 0x02, 0xFE, 0x55, 0xC0, 0xE7,
+	0xE4, 0x20, 0xB1, 0x03, 0xD9, 0x98, 0xC7, 0x04, 0xFE, 0x55, 0xC0, 0xE7, 0x3D, 0x22, 0xB1, 0x03,
+	0xC2, 0x89, 0xC7, 0x04, 0x5E, 0x57, 0xC0, 0xE7, 0xFF, 0x53, 0xB1, 0x03, 0x25, 0x87, 0xC7, 0x04,
+	0xFE, 0x57, 0xC0, 0xE7, 0xB0, 0xCE, 0xB1, 0x03, 0xFA, 0x99, 0xC7, 0x04, 0xB7, 0x00, 0xC1, 0xE7,
+	0x55, 0x0A, 0xB1, 0x03, 0x86, 0x4E, 0xC8, 0x04, 0x07, 0x02, 0xC1, 0xE7, 0x50, 0x38, 0xB1, 0x03,
+	0xE5, 0xF6, 0xC7, 0x04, 0x2C, 0x02, 0xC1, 0xE7, 0x17, 0x71, 0xB1, 0x03, 0x61, 0xEB, 0xC7, 0x04,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35, 0x31, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x30,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x39, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x32, 0x35, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x36,
+	0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x37, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x34,
+	0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x35, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x31, 0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x37, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x30, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x03, 0x08, 0xC1, 0xE7, 0xB8, 0xE8, 0xB1, 0x03, 0xA1, 0xCF, 0xC7, 0x04, 0x42, 0x08, 0xC1, 0xE7,
+	0x54, 0xEA, 0xB1, 0x03, 0x80, 0x63, 0xC8, 0x04, 0x66, 0xA1, 0xD9, 0xEC, 0xA8, 0xED, 0x79, 0x04,
+	0xD2, 0x5C, 0xC8, 0x03, 0x29, 0x8D, 0x49, 0xF1, 0x38, 0x66, 0xCB, 0x02, 0x16, 0x90, 0x7A, 0x07,
+	0x1C, 0x47, 0xC9, 0xF1, 0x8A, 0x0A, 0x1B, 0x03, 0xA6, 0xB3, 0x85, 0x07, 0x69, 0x47, 0xC9, 0xF1,
+	0xD4, 0x34, 0x1B, 0x03, 0xF3, 0x03, 0x86, 0x07, 0x72, 0x47, 0xC9, 0xF1, 0xA9, 0x2C, 0x1B, 0x03,
+	0x81, 0x40, 0x86, 0x07, 0xC4, 0x47, 0xC9, 0xF1, 0x30, 0x4E, 0x1B, 0x03, 0xD3, 0x1C, 0x86, 0x07,
+	0xC4, 0x47, 0xC9, 0xF1, 0x0B, 0x4A, 0x1B, 0x03, 0x74, 0x0D, 0x86, 0x07, 0xD9, 0x47, 0xC9, 0xF1,
+	0x97, 0x60, 0x1B, 0x03, 0xA7, 0x5B, 0x86, 0x07, 0xDE, 0x47, 0xC9, 0xF1, 0x98, 0x6A, 0x1B, 0x03,
+	0x15, 0x6C, 0x86, 0x07, 0xEF, 0x47, 0xC9, 0xF1, 0xAF, 0x93, 0x1B, 0x03, 0xD3, 0x21, 0x86, 0x07,
+	0x0D, 0x4D, 0xC9, 0xF1, 0xCC, 0xBA, 0x1B, 0x03, 0xD3, 0x83, 0x85, 0x07, 0x3B, 0x4D, 0xC9, 0xF1,
+	0x72, 0xEA, 0x1B, 0x03, 0x53, 0xA5, 0x85, 0x07, 0x44, 0x4D, 0xC9, 0xF1, 0xDE, 0xA0, 0x1B, 0x03,
+	0xF6, 0x19, 0x86, 0x07, 0x60, 0x4D, 0xC9, 0xF1, 0x80, 0xCB, 0x1B, 0x03, 0x0E, 0xF3, 0x85, 0x07,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x33, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x37, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x36,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x33, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x35, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x35, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x38,
+	0x38, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x32, 0x32, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x34, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x36, 0x32, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x36,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x34, 0x30, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30, 0x36, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x31, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x30,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x34, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x66, 0x4D, 0xC9, 0xF1, 0xBD, 0xD7, 0x1B, 0x03, 0xEF, 0x13, 0x86, 0x07, 0x92, 0x4D, 0xC9, 0xF1,
+	0xE5, 0x00, 0x1C, 0x03, 0x18, 0x91, 0x85, 0x07, 0x95, 0x4D, 0xC9, 0xF1, 0x69, 0xF3, 0x1B, 0x03,
+	0xF2, 0xD3, 0x85, 0x07, 0x9C, 0x4D, 0xC9, 0xF1, 0x67, 0x0A, 0x1C, 0x03, 0x9A, 0xC2, 0x85, 0x07,
+	0xC0, 0x4D, 0xC9, 0xF1, 0x8C, 0xF4, 0x1B, 0x03, 0xF8, 0xED, 0x85, 0x07, 0xD4, 0xC4, 0x48, 0xF2,
+	0xEF, 0xD8, 0x75, 0x03, 0x60, 0x3B, 0x18, 0x06, 0x13, 0xC6, 0x48, 0xF2, 0xC0, 0x2F, 0x76, 0x03,
+	0x00, 0x79, 0x17, 0x06, 0x4B, 0xC6, 0x48, 0xF2, 0x47, 0x47, 0x76, 0x03, 0x6F, 0xCE, 0x17, 0x06,
+	0x6F, 0xC6, 0x48, 0xF2, 0x15, 0x7A, 0x76, 0x03, 0x50, 0xF6, 0x17, 0x06, 0xB7, 0xC6, 0x48, 0xF2,
+	0xFC, 0xB0, 0x76, 0x03, 0x8D, 0xAE, 0x17, 0x06, 0xB8, 0xC6, 0x48, 0xF2, 0x15, 0xC3, 0x76, 0x03,
+	0x11, 0x5E, 0x17, 0x06, 0xEE, 0xC6, 0x48, 0xF2, 0x85, 0xCD, 0x76, 0x03, 0x2E, 0xDE, 0x17, 0x06,
+	0x82, 0xC7, 0x48, 0xF2, 0xBC, 0x8A, 0x76, 0x03, 0x02, 0x64, 0x18, 0x06, 0x54, 0xCC, 0x48, 0xF2,
+	0x17, 0xD2, 0x76, 0x03, 0x4E, 0x35, 0x18, 0x06, 0xE6, 0x20, 0x21, 0xFA, 0x23, 0x34, 0xE0, 0x04,
+	0xE6, 0x3B, 0x74, 0x05, 0x61, 0x62, 0xC3, 0xFA, 0xA8, 0x22, 0x16, 0x05, 0x98, 0x9E, 0x2A, 0x06,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x32, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x31, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x38,
+	0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x31, 0x32, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x33, 0x35, 0x37, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x30, 0x38, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34,
+	0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x36, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x32, 0x34, 0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x30, 0x33, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x34, 0x30,
+	0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x33, 0x32, 0x39, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x30, 0x32, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x38, 0x36, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20, 0x30, 0x30, 0x31, 0x30,
+	0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x4F, 0x49, 0x20,
+	0x30, 0x30, 0x30, 0x36, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
+};
+
+/**
+ * @brief Query positions in microdegrees, near a cluster and anywhere in turn.
+ */
+static const int32_t queries[][2] PROGMEM = {
+	{-25175916L, -78914988L},
+	{30953508L, -139318371L},
+	{40874532L, 160667176L},
+	{-61809099L, 87080599L},
+	{25174930L, 96295195L},
+	{49461356L, 113837662L},
+	{-40847531L, 12802343L},
+	{-17316286L, -117020501L}
+};
+
+#endif /* UT_STORE_BENCH_IMAGE_H_ */
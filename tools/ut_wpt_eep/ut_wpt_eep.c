@@ -0,0 +1,170 @@
+/**
+ * @file ut_wpt_eep.c
+ * @brief Host tool converting named waypoints to and from an EEPROM image of the memory locations.
+ *
+ * The waypoints are saved to an erased image by the same ut_log.c and ut_wpt.c that run on the
+ * device, one SAVE entry of the EEPROM log per memory location; an image read back from the
+ * device is listed through the index ut_log_init() rebuilds from it.
+ *
+ * Build on Linux from this directory:
+ *   cc -std=c99 -O2 -Wall -o ut_wpt_eep ut_wpt_eep.c ../../wfx_sw/wfx_sw/ut/ut_log.c ../../wfx_sw/wfx_sw/ut/ut_wpt.c -lm
+ *
+ * Usage:
+ *   ut_wpt_eep [input.csv] > eeprom.hex    lines of "lat_deg,lon_deg,name", one per memory location
+ *   ut_wpt_eep -d [eeprom.hex] > out.csv   lines of "index,lat_deg,lon_deg,name" for the locations in use
+ * The image is Intel HEX, written with avrdude -U eeprom:w:eeprom.hex:i and read back with
+ * -U eeprom:r:eeprom.hex:i.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "../../wfx_sw/wfx_sw/ut/ut_log.h"
+
+//defines
+#define EEPROM_SIZE UT_LOG_EEPROM_SIZE
+#define MEM_SLOTS UT_LOG_SLOTS /**< MAX_MEM_INDEX of utilities.h */
+#define HEX_LINE_BYTES 16 /**< Data bytes per Intel HEX record */
+#define LINE_MAX 256
+
+//local static
+static uint8_t image[EEPROM_SIZE]; /**< EEPROM contents */
+
+//local function definitions
+/**
+ * @brief Parses "lat_deg,lon_deg,name" into a waypoint, the name space padded.
+ * @return 1 on success.
+ */
+static int parse_line(char* line, ut_wpt_t* wpt){
+	char* end;
+	double lat = strtod(line, &end);
+	double lon;
+	size_t length;
+
+	if (*end++ != ','){
+		return 0;
+	}
+	lon = strtod(end, &end);
+	if ((*end++ != ',') || (fabs(lat) > 90.0) || (lon < -180.0) || (lon >= 180.0)){
+		return 0;
+	}
+	end[strcspn(end, "\r\n")] = '\0';
+	length = strlen(end);
+	if (length > UT_WPT_NAME_CHARS){
+		fprintf(stderr, "name \"%s\" cut to %d characters\n", end, UT_WPT_NAME_CHARS);
+		length = UT_WPT_NAME_CHARS;
+	}
+	wpt->lat_udeg = (int32_t)lround(lat * 1e6);
+	wpt->lon_udeg = (int32_t)lround(lon * 1e6);
+	memset(wpt->name, ' ', UT_WPT_NAME_CHARS);
+	memcpy(wpt->name, end, length);
+	return 1;
+}
+
+/**
+ * @brief Writes the image as Intel HEX.
+ */
+static void write_hex(FILE* out){
+	for (unsigned address = 0; address < EEPROM_SIZE; address += HEX_LINE_BYTES){
+		unsigned sum = HEX_LINE_BYTES + (address >> 8) + (address & 0xFF);
+
+		fprintf(out, ":%02X%04X00", HEX_LINE_BYTES, address);
+		for (unsigned i = 0; i < HEX_LINE_BYTES; i++){
+			fprintf(out, "%02X", image[address + i]);
+			sum += image[address + i];
+		}
+		fprintf(out, "%02X\n", (0x100 - (sum & 0xFF)) & 0xFF);
+	}
+	fprintf(out, ":00000001FF\n");
+}
+
+/**
+ * @brief Reads the data records of an Intel HEX file into the image.
+ * @return 1 on success.
+ */
+static int read_hex(FILE* in){
+	char line[LINE_MAX];
+
+	while (fgets(line, sizeof(line), in) != NULL){
+		unsigned count, address, type, value;
+
+		if ((line[0] != ':') || (sscanf(line + 1, "%2x%4x%2x", &count, &address, &type) != 3)){
+			continue;
+		}
+		if (type == 1){
+			break;
+		}
+		for (unsigned i = 0; (type == 0) && (i < count); i++){
+			if ((sscanf(line + 9 + 2 * i, "%2x", &value) != 1) || (address + i >= EEPROM_SIZE)){
+				return 0;
+			}
+			image[address + i] = (uint8_t)value;
+		}
+	}
+	return 1;
+}
+
+//function definitions
+void ut_log_eeprom_read(void* dst, uint16_t address, uint8_t count){
+	memcpy(dst, image + address, count);
+}
+
+void ut_log_eeprom_write(const void* src, uint16_t address, uint8_t count){
+	memcpy(image + address, src, count);
+}
+
+int main(int argc, char** argv){
+	int decode = (argc > 1) && (strcmp(argv[1], "-d") == 0);
+	FILE* in = stdin;
+	char line[LINE_MAX];
+	int slot = 0;
+	int line_number = 0;
+
+	if (argc > 1 + decode){
+		in = fopen(argv[1 + decode], "r");
+		if (in == NULL){
+			perror(argv[1 + decode]);
+			return 1;
+		}
+	}
+	memset(image, 0xFF, sizeof(image));
+
+	if (decode){
+		if (!read_hex(in)){
+			fprintf(stderr, "bad Intel HEX record\n");
+			return 1;
+		}
+		ut_log_init();
+		for (slot = 0; slot < MEM_SLOTS; slot++){
+			ut_wpt_t wpt;
+
+			if (ut_log_read((uint8_t)slot, &wpt)){
+				printf("%d,%.6f,%.6f,%.*s\n", slot, wpt.lat_udeg / 1e6, wpt.lon_udeg / 1e6, UT_WPT_NAME_CHARS, wpt.name);
+			}
+		}
+		return 0;
+	}
+
+	ut_log_init();
+	while (fgets(line, sizeof(line), in) != NULL){
+		ut_wpt_t wpt;
+
+		line_number++;
+		if ((line[0] == '#') || (line[strspn(line, " \t\r\n")] == '\0')){
+			continue;
+		}
+		if (!parse_line(line, &wpt)){
+			fprintf(stderr, "line %d: expected lat_deg,lon_deg,name\n", line_number);
+			return 1;
+		}
+		if (slot == MEM_SLOTS){
+			fprintf(stderr, "more than %d waypoints\n", MEM_SLOTS);
+			return 1;
+		}
+		ut_log_save((uint8_t)slot++, &wpt);
+	}
+	write_hex(stdout);
+	fprintf(stderr, "%d waypoints, %d bytes of EEPROM\n", slot, slot * UT_LOG_ENTRY_SIZE);
+	return 0;
+}
@@ -39,6 +39,7 @@ LICENSE:
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <avr/pgmspace.h>
+#include <util/atomic.h>
 #include "uart.h"
 
 
@@ -347,6 +348,16 @@ static volatile unsigned char UART_RxHead;
 static volatile unsigned char UART_RxTail;
 static volatile unsigned char UART_LastRxError;
 
+/* sentence receive mode, see uart_rx_sentences() */
+static volatile unsigned char UART_SentenceMode;
+static volatile unsigned char UART_SlotBuf[UART_SENTENCE_SLOTS][UART_SENTENCE_SIZE];
+static volatile unsigned char UART_SlotLength[UART_SENTENCE_SLOTS];
+static volatile unsigned char UART_SlotHead;       /* slot being filled */
+static volatile unsigned char UART_SlotTail;       /* oldest completed slot */
+static volatile unsigned char UART_SlotCount;      /* completed slots, including the one handed out */
+static volatile unsigned char UART_SlotFill;       /* bytes in the slot being filled, 0 while waiting for '$' */
+static volatile unsigned int UART_SentencesDropped;
+
 #if defined( ATMEGA_USART1 )
 static volatile unsigned char UART1_TxBuf[UART_TX_BUFFER_SIZE];
 static volatile unsigned char UART1_RxBuf[UART_RX_BUFFER_SIZE];
@@ -386,6 +397,49 @@ Purpose:  called when the UART has received a character
     lastRxError = usr & (_BV(FE)|_BV(DOR) );
 #endif
 
+    if ( UART_SentenceMode ) {
+        unsigned char fill = UART_SlotFill;
+
+        if ( lastRxError ) {
+            /* error: the sentence being received is corrupt */
+            if ( fill ) {
+                UART_SentencesDropped++;
+            }
+            fill = 0;
+        }else if ( data == '$' ) {
+            if ( fill ) {
+                /* error: previous sentence cut off */
+                UART_SentencesDropped++;
+            }
+            if ( UART_SlotCount == UART_SENTENCE_SLOTS ) {
+                /* error: no free slot, skip to the next '$' */
+                UART_SentencesDropped++;
+                fill = 0;
+            }else{
+                UART_SlotBuf[UART_SlotHead][0] = data;
+                fill = 1;
+            }
+        }else if ( fill ) {
+            if ( fill == UART_SENTENCE_SIZE ) {
+                /* error: sentence longer than a slot */
+                UART_SentencesDropped++;
+                fill = 0;
+            }else{
+                UART_SlotBuf[UART_SlotHead][fill++] = data;
+                if ( data == '\n' ) {
+                    /* sentence complete, hand the slot to the application */
+                    UART_SlotLength[UART_SlotHead] = fill;
+                    UART_SlotHead = ( UART_SlotHead + 1 == UART_SENTENCE_SLOTS ) ? 0 : UART_SlotHead + 1;
+                    UART_SlotCount++;
+                    fill = 0;
+                }
+            }
+        }
+        UART_SlotFill = fill;
+        UART_LastRxError |= lastRxError;
+        return;
+    }
+
     /* calculate buffer index */ 
     tmphead = ( UART_RxHead + 1) & UART_RX_BUFFER_MASK;
     
@@ -436,6 +490,8 @@ void uart_init(unsigned int baudrate)
     UART_TxTail = 0;
     UART_RxHead = 0;
     UART_RxTail = 0;
+    UART_SentenceMode = 0;
+    UART_SentencesDropped = 0;
 
 #ifdef UART_TEST
 #ifndef UART0_BIT_U2X
@@ -570,6 +626,102 @@ void uart_puts_p(const char *progmem_s )
 }/* uart_puts_p */
 
 
+/*************************************************************************
+Function: uart_rx_sentences()
+Purpose:  switch between byte and sentence receive mode
+Input:    1 for sentence mode, 0 for byte mode
+Returns:  none
+**************************************************************************/
+void uart_rx_sentences(unsigned char enable)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        UART_SlotHead  = 0;
+        UART_SlotTail  = 0;
+        UART_SlotCount = 0;
+        UART_SlotFill  = 0;
+        UART_SentenceMode = enable;
+    }
+
+}/* uart_rx_sentences */
+
+
+/*************************************************************************
+Function: uart_get_sentence()
+Purpose:  return the oldest completed sentence without copying it
+Input:    where to store the sentence length
+Returns:  sentence, or NULL if none is complete
+**************************************************************************/
+const char *uart_get_sentence(unsigned char *length)
+{
+    if ( UART_SlotCount == 0 ) {
+        return 0;   /* no sentence available */
+    }
+    
+    /* the interrupt does not touch this slot until it is released */
+    *length = UART_SlotLength[UART_SlotTail];
+    return (const char *)UART_SlotBuf[UART_SlotTail];
+
+}/* uart_get_sentence */
+
+
+/*************************************************************************
+Function: uart_release_sentence()
+Purpose:  free the slot returned by uart_get_sentence()
+Returns:  none
+**************************************************************************/
+void uart_release_sentence(void)
+{
+    if ( UART_SlotCount == 0 ) {
+        return;
+    }
+    
+    UART_SlotTail = ( UART_SlotTail + 1 == UART_SENTENCE_SLOTS ) ? 0 : UART_SlotTail + 1;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        UART_SlotCount--;
+    }
+
+}/* uart_release_sentence */
+
+
+/*************************************************************************
+Function: uart_sentences_dropped()
+Purpose:  number of sentences dropped in sentence receive mode
+Returns:  drop count since uart_init(), wraps
+**************************************************************************/
+unsigned int uart_sentences_dropped(void)
+{
+    unsigned int dropped;
+    
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        dropped = UART_SentencesDropped;
+    }
+    return dropped;
+
+}/* uart_sentences_dropped */
+
+
+/*************************************************************************
+Function: uart_get_rx_error()
+Purpose:  return and clear the receive errors seen since the last call
+Returns:  error bits as in the high byte of uart_getc()
+**************************************************************************/
+unsigned int uart_get_rx_error(void)
+{
+    unsigned char lastRxError;
+    
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        lastRxError = UART_LastRxError;
+        UART_LastRxError = 0;
+    }
+    return lastRxError << 8;
+
+}/* uart_get_rx_error */
+
+
 /*
  * these functions are only for ATmegas with two USART
  */
@@ -92,10 +92,31 @@ LICENSE:
 #define UART_TX_BUFFER_SIZE 32
 #endif
 
+/** @brief  Number of sentence slots used in sentence receive mode
+ *
+ *  One slot is filled by the receive interrupt while the others wait for the application.
+ *  You may need to adapt this constant to your application by adding
+ *  CDEFS += -DUART_SENTENCE_SLOTS=nn to your Makefile.
+ */
+#ifndef UART_SENTENCE_SLOTS
+#define UART_SENTENCE_SLOTS 3
+#endif
+
+/** @brief  Size of one sentence slot in bytes, from '$' to '\n' inclusive
+ *
+ *  NMEA 0183 limits a sentence to 82 characters. Longer sentences are dropped.
+ */
+#ifndef UART_SENTENCE_SIZE
+#define UART_SENTENCE_SIZE 82
+#endif
+
 /* test if the size of the circular buffers fits into SRAM */
 #if ( (UART_RX_BUFFER_SIZE+UART_TX_BUFFER_SIZE) >= (RAMEND-0x60 ) )
 #error "size of UART_RX_BUFFER_SIZE + UART_TX_BUFFER_SIZE larger than size of SRAM"
 #endif
+#if ( UART_SENTENCE_SIZE > 255 )
+#error "UART_SENTENCE_SIZE must fit into a byte"
+#endif
 
 /*
 ** high byte error return code of uart_getc()
@@ -185,6 +206,54 @@ extern void uart_puts_p(const char *s );
  */
 #define uart_puts_P(__s)       uart_puts_p(PSTR(__s))
 
+/**
+ *  @brief   Switch the receiver between byte and sentence receive mode
+ *
+ *  In sentence mode the receive interrupt stores NMEA sentences into UART_SENTENCE_SLOTS
+ *  slots instead of the ringbuffer: a '$' starts a new slot and a '\n' completes it.
+ *  Bytes outside of a sentence are discarded, so binary protocols need byte mode.
+ *  A sentence is dropped and counted if no slot is free when its '$' arrives, if it is
+ *  longer than UART_SENTENCE_SIZE, if it is cut off by the next '$' or if a framing or
+ *  overrun error hits it. uart_init() selects byte mode.
+ *
+ *  @param   enable 1 for sentence mode, 0 for byte mode; both empty the sentence slots
+ *  @return  none
+ */
+extern void uart_rx_sentences(unsigned char enable);
+
+/**
+ *  @brief   Get the oldest completed sentence in sentence receive mode
+ *
+ *  The slot belongs to the caller until uart_release_sentence() is called, the receive
+ *  interrupt keeps filling the other slots meanwhile.
+ *
+ *  @param   length set to the number of bytes, including the '$' and the '\n'
+ *  @return  the sentence, not terminated; NULL if no sentence is complete
+ */
+extern const char *uart_get_sentence(unsigned char *length);
+
+/**
+ *  @brief   Hand the sentence returned by uart_get_sentence() back to the receive interrupt
+ *  @return  none
+ */
+extern void uart_release_sentence(void);
+
+/**
+ *  @brief   Number of sentences dropped in sentence receive mode since uart_init(), wraps
+ */
+extern unsigned int uart_sentences_dropped(void);
+
+/**
+ *  @brief   Get and clear the receive errors seen since the last call
+ *
+ *  Errors are also reported and cleared by uart_getc(); in sentence receive mode this is
+ *  the only way to see them.
+ *
+ *  @return  UART_FRAME_ERROR, UART_OVERRUN_ERROR, UART_PARITY_ERROR and UART_BUFFER_OVERFLOW
+ *           bits as in the high byte of uart_getc(), 0 if there was no error
+ */
+extern unsigned int uart_get_rx_error(void);
+
 
 
 /** @brief  Initialize USART1 (only available on selected ATmegas) @see uart_init */
@@ -2,6 +2,31 @@
 #include "../lib/lcd.h"
 #include "../ut/ut_types.h"
 #include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#define DS_GLYPHS_BARS DS_ARROW_SECTORS /**< glyph_set value while the bar glyphs are loaded */
+#define DS_GLYPHS_NONE 0xFF /**< glyph_set value before anything is loaded */
+#define DS_GLYPH_MIRROR_SECTORS ((DS_ARROW_SECTORS / 2) + 1) /**< Sectors stored; the others are their mirror images */
+
+/**
+ * @brief Arrows pointing up, up-right, right, down-right and down, on a 10x16 pixel canvas.
+ * Each is four glyphs of eight 5 bit rows: top left, top right, bottom left, bottom right.
+ * Up and down have a two pixel shaft on the middle columns, right one on the middle rows.
+ */
+static const uint8_t ds_arrow_rows[DS_GLYPH_MIRROR_SECTORS][DS_ARROW_GLYPHS * DS_GLYPH_ROWS] PROGMEM = {
+	{0x01, 0x03, 0x05, 0x09, 0x01, 0x01, 0x01, 0x01, 0x10, 0x18, 0x14, 0x12, 0x10, 0x10, 0x10, 0x10,
+	 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x03, 0x05, 0x09, 0x11,
+	 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x1F,
+	 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00},
+	{0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x09, 0x05, 0x03, 0x1F, 0x00, 0x00, 0x00},
+	{0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	 0x01, 0x01, 0x01, 0x01, 0x09, 0x05, 0x03, 0x01, 0x10, 0x10, 0x10, 0x10, 0x12, 0x14, 0x18, 0x10}
+};
+
+static uint8_t glyph_set = DS_GLYPHS_NONE; /**< What CGRAM holds: an arrow sector, DS_GLYPHS_BARS or DS_GLYPHS_NONE */
 
 
 /**
@@ -33,6 +58,8 @@ void ds_print_string(char * inputString, int size, uint8_t row)
 void ds_init()
 {
 	lcd_init(LCD_DISP_ON);
+	glyph_set = DS_GLYPHS_NONE;
+	ds_load_bar_glyphs();
 	lcd_clrscr();
 	return;
 }
@@ -43,4 +70,81 @@ void ds_init()
  */
 void ds_clear(){
 	lcd_clrscr();
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Loads the bar graph glyphs into the HD44780 character generator RAM.
+ * The address counter advances after every write, so the 64 rows go out in one run.
+ */
+void ds_load_bar_glyphs(){
+	if (glyph_set == DS_GLYPHS_BARS){
+		return;
+	}
+	glyph_set = DS_GLYPHS_BARS;
+	lcd_command(_BV(LCD_CGRAM)); //CGRAM address 0
+	for (uint8_t glyph = 0; glyph < DS_BAR_GLYPHS; glyph++){
+		for (uint8_t row = 0; row < DS_GLYPH_ROWS; row++){
+			lcd_data((row >= DS_GLYPH_ROWS - 1 - glyph) ? 0x1F : 0x00); //five pixels wide
+		}
+	}
+	lcd_gotoxy(0, 0); //back to display RAM
+}
+
+/**
+ * @brief Splits a bar over two display rows.
+ *
+ * @param level Bar height from 0 to DS_BAR_LEVELS; higher values are drawn full.
+ * @param top Set to the character for the upper row.
+ * @param bottom Set to the character for the lower row.
+ */
+void ds_bar_chars(uint8_t level, char* top, char* bottom){
+	if (level > DS_BAR_LEVELS){
+		level = DS_BAR_LEVELS;
+	}
+	*bottom = (level == 0) ? ' ' : (char)(((level > DS_GLYPH_ROWS) ? DS_GLYPH_ROWS : level) - 1);
+	*top = (level <= DS_GLYPH_ROWS) ? ' ' : (char)(level - DS_GLYPH_ROWS - 1);
+}
+
+/**
+ * @brief Loads an arrow into the HD44780 character generator RAM.
+ * Sectors past down are the mirror images of those before it: the left and right glyphs swap
+ * and each row is reversed.
+ * @param sector Direction from 0 (up) to DS_ARROW_SECTORS - 1, clockwise.
+ */
+void ds_load_arrow_glyphs(uint8_t sector){
+	uint8_t stored;
+	uint8_t mirror;
+	uint8_t bits;
+
+	sector %= DS_ARROW_SECTORS;
+	if (glyph_set == sector){
+		return;
+	}
+	glyph_set = sector;
+	mirror = (sector >= DS_GLYPH_MIRROR_SECTORS);
+	stored = mirror ? DS_ARROW_SECTORS - sector : sector;
+	lcd_command(_BV(LCD_CGRAM)); //CGRAM address 0
+	for (uint8_t glyph = 0; glyph < DS_ARROW_GLYPHS; glyph++){
+		for (uint8_t row = 0; row < DS_GLYPH_ROWS; row++){
+			bits = pgm_read_byte(&ds_arrow_rows[stored][((glyph ^ mirror) * DS_GLYPH_ROWS) + row]); //glyph ^ 1 is its neighbour
+			if (mirror){
+				bits = ((bits & 0x01) << 4) | ((bits & 0x02) << 2) | (bits & 0x04) | ((bits & 0x08) >> 2) | ((bits & 0x10) >> 4);
+			}
+			lcd_data(bits);
+		}
+	}
+	lcd_gotoxy(0, 0); //back to display RAM
+}
+
+/**
+ * @brief The characters that draw the loaded arrow.
+ *
+ * @param top Set to the two characters for the upper row.
+ * @param bottom Set to the two characters for the lower row.
+ */
+void ds_arrow_chars(char* top, char* bottom){
+	top[0] = 0;
+	top[1] = 1;
+	bottom[0] = 2;
+	bottom[1] = 3;
+}
@@ -14,6 +14,12 @@
 #define MAX_COL 20 /**< Maximum number of columns on the LCD display */
 #define SPACES "                    " /**< String of spaces used for clearing the LCD display */
 
+#define DS_GLYPH_ROWS 8 /**< Pixel rows of an HD44780 character */
+#define DS_BAR_GLYPHS 8 /**< CGRAM characters 0-7 hold bars 1 to 8 pixel rows high */
+#define DS_BAR_LEVELS (2 * DS_GLYPH_ROWS) /**< Heights of a bar drawn over two display rows */
+#define DS_ARROW_SECTORS 8 /**< Directions the arrow can point, 45 degrees apart, clockwise from up */
+#define DS_ARROW_GLYPHS 4 /**< CGRAM characters 0-3 hold the arrow, two wide and two high, while it is loaded */
+
 
 #include "../ut/ut_types.h"
 
@@ -39,5 +45,36 @@ void ds_init();
  */
 void ds_clear();
 
+/**
+ * @brief Loads the bar graph glyphs into the HD44780 character generator RAM.
+ * Character n is then a bar n+1 pixel rows high, bottom aligned. Does nothing if they are
+ * already loaded, so pages using them can call it on every refresh.
+ */
+void ds_load_bar_glyphs();
+
+/**
+ * @brief Loads an arrow into the HD44780 character generator RAM, replacing the bar glyphs.
+ * Does nothing if the arrow already points that way, so the 32 glyph rows only go out when the
+ * sector changes.
+ * @param sector Direction from 0 (up) to DS_ARROW_SECTORS - 1, clockwise.
+ */
+void ds_load_arrow_glyphs(uint8_t sector);
+
+/**
+ * @brief The characters that draw the loaded arrow.
+ * @param top Set to the two characters for the upper row.
+ * @param bottom Set to the two characters for the lower row.
+ */
+void ds_arrow_chars(char* top, char* bottom);
+
+/**
+ * @brief Splits a bar over two display rows.
+ *
+ * @param level Bar height from 0 to DS_BAR_LEVELS; higher values are drawn full.
+ * @param top Set to the character for the upper row.
+ * @param bottom Set to the character for the lower row.
+ */
+void ds_bar_chars(uint8_t level, char* top, char* bottom);
+
 
 #endif /* DS_H_ */
\ No newline at end of file
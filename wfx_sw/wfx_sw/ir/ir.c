@@ -4,12 +4,15 @@
 
 //global
 uint16_t ir_sec_counter = 0; /**< Seconds counter for indicating TTFF */
-boolean_t ir_trigger_1hz_flag_g = false; /**< Global flag indicating 1Hz trigger */
+boolean_t ir_trigger_nav_flag_g = false; /**< Global flag indicating the navigation task is due */
 
 
 
 //local static
-static uint8_t timer2_overflow_counter;
+static uint8_t timer2_sec_ticks;
+static uint8_t timer2_task_ticks;
+static uint8_t task_period_ticks = IR_TICK_HZ; /**< Ticks between navigation task triggers */
+static volatile uint32_t timer2_ticks; /**< Ticks since ir_init(), see ir_ticks() */
 
 
 // Interrupt Service Routine for Timer0 overflow: Poll all four buttons in background set state if we have polled enough times
@@ -18,18 +21,48 @@ ISR(TIMER0_OVF_vect) {
 	TCNT0 = 0;
 }
 
-// Interrupt Service Routine for Timer2 overflow: Used to trip trigger flag at 1Hz
-ISR(TIMER2_OVF_vect) {
-	timer2_overflow_counter++;
-	if (timer2_overflow_counter >= 15){
-		timer2_overflow_counter = 0;
+// Interrupt Service Routine for Timer2 compare match: Used to count seconds and trip the navigation task flag
+ISR(TIMER2_COMPA_vect) {
+	timer2_ticks++;
+	timer2_sec_ticks++;
+	if (timer2_sec_ticks >= IR_TICK_HZ){
+		timer2_sec_ticks = 0;
 		ir_sec_counter++;
-		if (!ir_trigger_1hz_flag_g){
-			ir_trigger_1hz_flag_g = true;
+	}
+	timer2_task_ticks++;
+	if (timer2_task_ticks >= task_period_ticks){
+		timer2_task_ticks = 0;
+		if (!ir_trigger_nav_flag_g){
+			ir_trigger_nav_flag_g = true;
 		}
 	}
 }
 
+/**
+ * @brief Sets how often the navigation task flag is raised.
+ * 
+ * @param rate_hz Task runs per second; must divide IR_TICK_HZ.
+ */
+void ir_set_task_rate(uint8_t rate_hz){
+	uint8_t period = IR_TICK_HZ / rate_hz;
+	cli();
+	task_period_ticks = period;
+	timer2_task_ticks = 0;
+	sei();
+}
+
+/**
+ * @brief Time since ir_init() in IR_TICK_HZ ticks; wraps after about 200 days.
+ */
+uint32_t ir_ticks(){
+	uint32_t ticks;
+	uint8_t sreg = SREG;
+	cli();
+	ticks = timer2_ticks;
+	SREG = sreg;
+	return ticks;
+}
+
 /**
  * @brief Initializes interrupt system functionality.
  * 
@@ -55,14 +88,23 @@ void ir_init()
 	TCNT0 = 0;
 
 
-	//Set up timer2 for 1 hz task managment
-	// Set Timer2 in normal mode (WGM22:0 = 0)
-	TCCR2A = 0x00;
+	//Set up timer2 for task managment, IR_TICK_HZ = 4MHz / 64 / (249 + 1)
+	// Set Timer2 in CTC mode (WGM22:0 = 2)
+	TCCR2A = (1 << WGM21);
 	TCCR2B = 0x00;
-	// Set pre-scaler to clk/1024 for smoothing
-	TCCR2B |= (1 << CS22) | (1 << CS21) | (1 << CS20); // Pre-scaler = 64
-	// Enable Timer2 Overflow Interrupt
-	TIMSK2 |= (1 << TOIE2);
+	OCR2A = (F_CPU / 64 / IR_TICK_HZ) - 1;
+	TCNT2 = 0;
+	// Set pre-scaler to clk/64
+	TCCR2B |= (1 << CS22);
+	// Enable Timer2 Compare Match A Interrupt
+	TIMSK2 |= (1 << OCIE2A);
+
+#if IR_PROFILE
+	//timer 1 free running at clk/8 as a profiling clock, see ir_profile_ticks()
+	TCCR1A = 0x00;
+	TCCR1B = (1 << CS11);
+	TCNT1 = 0;
+#endif
 
 
 	sei(); // Enable interrupts.
@@ -11,9 +11,23 @@
 #define IR_H_
 
 #include "../ut/ut_types.h"
+#include <avr/io.h>
+
+#ifndef F_CPU
+#define F_CPU 4000000UL /**< Define the CPU frequency to 4MHz. */
+#endif
+
+#define IR_TICK_HZ 250 /**< Timer2 task tick; divisible by every navigation rate */
+
+#ifndef IR_PROFILE
+#define IR_PROFILE 0 /**< 1: run Timer1 as a profiling clock to measure parser and task load */
+#endif
+
+#define IR_PROFILE_TICKS_PER_SEC (F_CPU / 8) /**< ir_profile_ticks() rate */
+#define ir_profile_ticks() (TCNT1) /**< Free running 16 bit profiling clock, only with IR_PROFILE */
 
 //globals
-extern boolean_t ir_trigger_1hz_flag_g;  /**< Global flag indicating 1Hz trigger */
+extern boolean_t ir_trigger_nav_flag_g;  /**< Global flag indicating the navigation task is due */
 extern uint16_t ir_sec_counter; /**< Seconds counter for indicating TTFF */
 
 /**
@@ -23,5 +37,17 @@ extern uint16_t ir_sec_counter; /**< Seconds counter for indicating TTFF */
  */
 void ir_init();
 
+/**
+ * @brief Sets how often the navigation task flag is raised.
+ * 
+ * @param rate_hz Task runs per second; must divide IR_TICK_HZ.
+ */
+void ir_set_task_rate(uint8_t rate_hz);
+
+/**
+ * @brief Time since ir_init() in IR_TICK_HZ ticks; safe to call with interrupts enabled.
+ */
+uint32_t ir_ticks();
+
 
 #endif /* IR_H_ */
\ No newline at end of file
@@ -19,6 +19,8 @@
  * - Display of user position and velocity information
  * - Storage of multiple locations for navigation
  * - Calculation of distance to selected stored positions
+ * - List of the stored positions nearest the user
+ * - Compass page pointing at the selected stored position, relative to the direction of travel
  * - Intuitive user interface with control buttons and LCD display
  *
  * @section hardware Hardware Components
@@ -49,20 +51,44 @@
 //PORT Pin 2 PD2
 #include <avr/power.h>
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 #include <stdlib.h>
 
 #include "ds/ds.h" /**< Include display-related functions. */
 #include "ir/ir.h" /**< Include interrupt routines. */
 #include "nf/nf.h"  /**< Include navigation fetch functions */
+#include "nf/nf_health.h" /**< Include GPS link health */
 #include "nf/nf_types.h"
 #include "ut/utilities.h" /**< Include utility functions. */
 #include "ut/ut_types.h" /**< Include common type definitions. */
 #include <string.h>
 
+#define SAT_SNR_PER_LEVEL 3 /**< dB-Hz per pixel row of a satellite bar; 48 dB-Hz and up draws a full bar */
+#define SAT_NUM_DIGITS 2 /**< Characters of the counts on the satellite page */
+#define NEAR_ROWS 3 /**< Saved positions listed on the nearest page, one per row below the title */
+#define NEAR_DIST_COL 12 /**< Column of the distance on the nearest page */
+#define COMPASS_TEXT_COL 4 /**< Column of the text right of the arrow on the compass page */
+#define COMPASS_UP_COL 16 /**< Column of "C-up" or "N-up" on the compass page */
+#define COMPASS_DEG_DIGITS 3 /**< Characters of a whole degree value on the compass page */
+#define DEGREE_CHAR '\xDF' /**< Degree sign in the HD44780 A00 character ROM */
+
 void startup();
-void task_1hz();
+void task_nav();
 void update_display();
+void update_sat_lines(char* line0, char* line1, char* line2, char* line3);
+void update_near_lines(char* line0, char* line1, char* line2, char* line3);
+void update_compass_lines(const nav_solution_t* nav, char* line0, char* line1, char* line2, char* line3);
+
+static uint16_t ranked_sec; /**< ir_sec_counter when the nearest list was last ranked */
+static boolean_t near_shown; /**< The nearest list was shown at the last task_nav() */
+
+#if IR_PROFILE
+static uint32_t parse_ticks; /**< Profiling clock ticks spent in the main loop's parser polls */
+static uint32_t task_ticks; /**< Profiling clock ticks spent in task_nav() */
+static uint16_t profile_rx_bytes; /**< nf_rx_byte_count at the start of the profiling second */
+static uint16_t profile_sec; /**< ir_sec_counter at the start of the profiling second */
+#endif
 
 
 /**
@@ -76,11 +102,25 @@ int main(void)
 	startup();
     /* Main loop */
     while (1){
-		//read_nmea_msg
-		read_nmea_msg_raw();
-		if (ir_trigger_1hz_flag_g == true){
-			task_1hz();
-			ir_trigger_1hz_flag_g = false;
+		//consume whatever GPS bytes have arrived; never waits for a full sentence
+#if IR_PROFILE
+		uint16_t start = ir_profile_ticks();
+		nf_poll_serial();
+		parse_ticks += (uint16_t)(ir_profile_ticks() - start);
+#else
+		nf_poll_serial();
+#endif
+		//a button action recorded by the button ISR; its EEPROM writes are queued, not waited for
+		ut_run_action();
+		if (ir_trigger_nav_flag_g == true){
+#if IR_PROFILE
+			start = ir_profile_ticks();
+			task_nav();
+			task_ticks += (uint16_t)(ir_profile_ticks() - start);
+#else
+			task_nav();
+#endif
+			ir_trigger_nav_flag_g = false;
 		}
 	}
 }
@@ -98,48 +138,63 @@ void startup(){
 			
 	// Initialize computer software components (CSC's)
 	ds_init(); /**< Initialize display CSC. */
-	{
-		char* welcome = "- - - - ~~~~ - - - -";
+	{ //Welcome Screen - limited scope; the text is kept in flash and copied here
+		char welcome[MAX_COL];
+
+		memcpy_P(welcome, PSTR("- - - - ~~~~ - - - -"), MAX_COL);
 		ds_print_string(welcome, MAX_COL, 0);
-	}
-	{ //Welcome Screen - limited scope
-		char* welcome = "- - - WayFindX - - -";
-		ds_print_string(welcome, MAX_COL, 1);
-	}
-	{
-		char* welcome = "- - - - ~~~~ - - - -";
 		ds_print_string(welcome, MAX_COL, 2);
+		memcpy_P(welcome, PSTR("- - - WayFindX - - -"), MAX_COL);
+		ds_print_string(welcome, MAX_COL, 1);
 	}
 	_delay_ms(0.1f);
 		
 	ir_init(); /**< Initialize interrupt routines. */
 	_delay_ms(0.1f);
 	if (nf_init()){ /**<Initialize navigation fetch CSC. */
-		char* err = "  Nav init failure  ";
+		char err[MAX_COL];
+
+		memcpy_P(err, PSTR("  Nav init failure  "), MAX_COL);
 		ds_print_string(err, MAX_COL, 1);
 		while(1){};
 	}
+	if (!nf_receiver_configured){ /**<Receiver keeps its default output; parsing still works. */
+		char warn[MAX_COL];
+
+		memcpy_P(warn, PSTR(" GPS config default "), MAX_COL);
+		ds_print_string(warn, MAX_COL, 3);
+	}
+	ir_set_task_rate(nf_nav_rate_hz); /**<Run the navigation task once per solution. */
 	_delay_ms(0.6f);
 	ut_init(); /**< Initialize utilities CSC. */
 }
 
 /**
- * @brief Executes tasks that should occur every 1Hz.
+ * @brief Executes tasks that should occur once per navigation solution.
  *
- * This function is called once per second and performs tasks such as updating the display.
+ * This function is called at nf_nav_rate_hz and performs tasks such as updating the display.
+ * With UBX output the UART only buffers 8ms of data at 38400 baud, so the parser is polled between steps.
  */
-void task_1hz(){
-	//Condition where USART if out of sync with NEO6-M
-	if ((position_fix_indicator[0] == '1') && (speed[0] == ' ') && (speed[1] == ' ')){
-		/* Re-Initialize navigation fetch CSC. */
-		do {
-			char* err = "Nav module off sync!";
-			ds_print_string(err, MAX_COL, 1);
-		} while(nf_init());
-	}else if(ut_mode == NAV_MODE) {
-		//if not corrupted; do distance calculation if in nav mode
-		ut_update_dist();
+void task_nav(){
+	//corrupted sentences are dropped in nf, which resyncs on the next '$' by itself; see nf_health.h
+	if ((ut_mode == NAV_MODE) || (ut_mode == NEAR_MODE) || (ut_mode == COMPASS_MODE)) {
+		ut_set_position(nf_nav_solution());
+		//the nearest list is only shown on its page and changes slowly, so every saved position is
+		//ranged once a second while it is shown, polling between them as update_display() does between rows
+		if ((ut_mode == NEAR_MODE) && (!near_shown || (ir_sec_counter != ranked_sec))){
+			for (uint8_t i = 0; i < MAX_MEM_INDEX; i++){
+				ut_update_dist(i);
+				nf_poll_serial();
+			}
+			ut_rank_nearest();
+			ranked_sec = ir_sec_counter;
+		}
+		ut_update_selected();
+		if (ut_mode == COMPASS_MODE){
+			ut_update_bearing();
+		}
 	}
+	near_shown = (ut_mode == NEAR_MODE);
 	update_display();
 }
 
@@ -149,12 +204,21 @@ void task_1hz(){
  * This function updates the display with information such as GPS coordinates, mode, operation, and memory status.
  */
 void update_display(){
-	char line0[MAX_COL] = SPACES;
-	char line1[MAX_COL] = SPACES;  
-	char line2[MAX_COL] = SPACES;
-	char line3[MAX_COL] = SPACES;
+	char line0[MAX_COL];
+	char line1[MAX_COL];
+	char line2[MAX_COL];
+	char line3[MAX_COL];
+	const nav_solution_t* nav = nf_nav_solution(); //one consistent fix for all four rows
 
-	if (utc_time[0] == ' '){ //Until we solve for time
+	//set here rather than from SPACES, which would keep a copy of the string in RAM
+	memset(line0, ' ', MAX_COL);
+	memset(line1, ' ', MAX_COL);
+	memset(line2, ' ', MAX_COL);
+	memset(line3, ' ', MAX_COL);
+
+	if (ut_mode == SAT_MODE){ //signal levels help while acquiring, so shown with or without a fix
+		update_sat_lines(line0, line1, line2, line3);
+	} else if (nav->utc_time[0] == ' '){ //Until we solve for time
 		char counter[7];
 		itoa(ir_sec_counter, counter, 10);
 		line0[0] = 'T';
@@ -169,11 +233,8 @@ void update_display(){
 			line0[i+5] = counter[i];
 		}
 		
-		char* temp = "Acquiring Satellites";
-		for (int i = 0; i < MAX_COL; i++){
-			line3[i] = temp[i];
-		}		
-	} else if (position_fix_indicator[0] != '1'){ //Display time once we solve for time
+		memcpy_P(line3, (nf_health.state == NF_HEALTH_NO_DATA) ? PSTR("  No data from GPS  ") : PSTR("Acquiring Satellites"), MAX_COL);
+	} else if (!nf_nav_has_fix(nav)){ //Display time once we solve for time
 		char counter[7];
 		itoa(ir_sec_counter, counter, 10);
 		line0[0] = 'T';
@@ -193,21 +254,16 @@ void update_display(){
 		line2[2] = 'C';
 		line2[3] = ':';
 		for (int i=0; i < GGA_UTC_BUFFER_SIZE; i++){
-			line2[4+i] = utc_time[i];
-		}
-		
-		char* temp = "Getting PVT Solution";
-		for (int i = 0; i < MAX_COL; i++){
-			line3[i] = temp[i];
+			line2[4+i] = nav->utc_time[i];
 		}
 		
-	} else if (position_fix_indicator[0] == '1') {	//Once we get a fix, go into normal operation
-		convertNMEAtoLLA();
+		memcpy_P(line3, PSTR("Getting PVT Solution"), MAX_COL);
 		
+	} else {	//Once we get a fix, go into normal operation
 		//Mode agnostic parts
 		//line0
 		for (int i = 0; i < LLA_LAT_BUFFER_SIZE; i++){
-			line0[i] = latitudeLLA_str[i];
+			line0[i] = nav->latitudeLLA_str[i];
 		}
 		
 		line0[19] = ut_mode + '0';
@@ -218,20 +274,24 @@ void update_display(){
 		line0[14] = 'M';
 		
 		for (int i = 0; i < LLA_LONG_BUFFER_SIZE; i++){
-			line1[i] = longitudeLLA_str[i];
+			line1[i] = nav->longitudeLLA_str[i];
 		}
 		
 		//mode-specific parts
-		if (ut_mode == STAT_MODE){
+		if (ut_mode == NEAR_MODE){
+			update_near_lines(line0, line1, line2, line3);
+		} else if (ut_mode == COMPASS_MODE){
+			update_compass_lines(nav, line0, line1, line2, line3);
+		} else if (ut_mode == STAT_MODE){
 			//line1
 			line1[MAX_COL-8] = 'H';
 			line1[MAX_COL-7] = 'D';
 			line1[MAX_COL-6] = 'O';
 			line1[MAX_COL-5] = 'P';
 			line1[MAX_COL-4] = ':';
-			line1[MAX_COL-3] = hdop[0];
-			line1[MAX_COL-2] = hdop[1];
-			line1[MAX_COL-1] = hdop[2];
+			line1[MAX_COL-3] = nav->hdop[0];
+			line1[MAX_COL-2] = nav->hdop[1];
+			line1[MAX_COL-1] = nav->hdop[2];
 			
 			//line2 
 			line2[0] = 'U';
@@ -239,11 +299,11 @@ void update_display(){
 			line2[2] = 'C';
 			line2[3] = ':';
 			for (int i=0; i < GGA_UTC_BUFFER_SIZE; i++){
-				line2[4+i] = utc_time[i];
+				line2[4+i] = nav->utc_time[i];
 			}
 			
-			line2[MAX_COL-1] = satellites_used[1];
-			line2[MAX_COL-2] = satellites_used[0];
+			line2[MAX_COL-1] = nav->satellites_used[1];
+			line2[MAX_COL-2] = nav->satellites_used[0];
 			line2[MAX_COL-3] = ':';
 			line2[MAX_COL-4] = 'V';
 			line2[MAX_COL-5] = 'S';
@@ -256,37 +316,37 @@ void update_display(){
 			line3[3] = ':';
 			//put vel here once we get it done TODO
 			for (int i =0; i < 6; i++){
-				line3[4+i] = speed[i];
+				line3[4+i] = nav->speed[i];
 			}
 			
 			line3[MAX_COL-9] = 'A';
 			line3[MAX_COL-8] = 'l';
 			line3[MAX_COL-7] = 't';
 			for (int i = 0; i < 6; i ++){
-				line3[MAX_COL-6+i] = msl_altitude[i];
+				line3[MAX_COL-6+i] = nav->msl_altitude[i];
 			}
 			
 		}else { //if mode != STAT_MODE
 			//line 1
 			switch (ut_operation){
 				case SAVE_OP:
-					strncpy(line1+(MAX_COL-5), SAVE_STR, 5);
+					memcpy_P(line1+(MAX_COL-5), PSTR(SAVE_STR), 5);
 					break;
 				case CLEAR_OP:
-					strncpy(line1+(MAX_COL-5), CLEAR_STR, 5);
+					memcpy_P(line1+(MAX_COL-5), PSTR(CLEAR_STR), 5);
 					break;
 				case RESET_OP:
-					strncpy(line1+(MAX_COL-5), RESET_STR, 5);
+					memcpy_P(line1+(MAX_COL-5), PSTR(RESET_STR), 5);
 					break;
 				default:
-					strncpy(line1+(MAX_COL-5), "Error", 5);
+					memcpy_P(line1+(MAX_COL-5), PSTR("Error"), 5);
 					break; 
 			}
+			if (ut_action_busy()){
+				line1[MAX_COL-6] = '*'; //e.g. "*CLEAR" until the EEPROM holds it
+			}
 			//line2
-			line2[MAX_COL-4] = 'M';
-			line2[MAX_COL-3] = 'e';
-			line2[MAX_COL-2] = 'm';
-			line2[MAX_COL-1] = ut_memory_0idx + '0';
+			ut_mem_name(ut_memory_0idx, line2 + MAX_COL - UT_WPT_NAME_CHARS);
 			
 			for (int i = 0; i < LLA_LAT_BUFFER_SIZE-2; i++){
 				line2[i] = ut_lat_mem_str[i];
@@ -304,11 +364,178 @@ void update_display(){
 				line3[MAX_COL-(6-i)] = ut_distance_str[i];
 			}
 		} //end mode checks (stat mode)
+
+		//the shown fix is kept through a glitch, but say how old it is, in tenths as it goes stale within a second
+		if (nf_health.state == NF_HEALTH_STALE_FIX){
+			char age[6];
+			uint16_t age_ds = (nf_health.fix_age_ds > 9999) ? 9999 : nf_health.fix_age_ds;
+
+			memcpy_P(line3, PSTR("Stale fix age      s"), MAX_COL);
+			line3[MAX_COL-2] = '0' + (age_ds % 10);
+			line3[MAX_COL-3] = '.';
+			utoa(age_ds / 10, age, 10);
+			strncpy(line3 + MAX_COL - 3 - strlen(age), age, strlen(age));
+		}
 	}//end normal operation
 	
+#if IR_PROFILE
+	//replace line3 with "Pnn.n% Tnn.n% nnnnB/s" once a second: parser load, task load, RX bytes/s
+	if (ir_sec_counter != profile_sec){
+		uint16_t bytes = nf_rx_byte_count - profile_rx_bytes;
+		uint16_t parse_permille = parse_ticks / (IR_PROFILE_TICKS_PER_SEC / 1000);
+		uint16_t task_permille = task_ticks / (IR_PROFILE_TICKS_PER_SEC / 1000);
+		char num[7];
+		memcpy_P(line3, PSTR("P  . % T  . %    B/s"), MAX_COL);
+		itoa(parse_permille / 10, num, 10);
+		strncpy(line3 + 3 - strlen(num), num, strlen(num));
+		line3[4] = '0' + (parse_permille % 10);
+		itoa(task_permille / 10, num, 10);
+		strncpy(line3 + 10 - strlen(num), num, strlen(num));
+		line3[11] = '0' + (task_permille % 10);
+		utoa(bytes, num, 10);
+		strncpy(line3 + 17 - strlen(num), num, strlen(num));
+		parse_ticks = 0;
+		task_ticks = 0;
+		profile_rx_bytes = nf_rx_byte_count;
+		profile_sec = ir_sec_counter;
+	}
+#endif
+
+	//poll between rows; a full refresh takes about 4ms
 	ds_print_string(line0, MAX_COL, 0);
+	nf_poll_serial();
 	ds_print_string(line1, MAX_COL, 1);
+	nf_poll_serial();
 	ds_print_string(line2, MAX_COL, 2);
+	nf_poll_serial();
 	ds_print_string(line3, MAX_COL, 3);
 	
-} //end update display
\ No newline at end of file
+} //end update display
+
+/**
+ * @brief Writes a count as two digits, showing 99 for anything larger.
+ */
+static void put_count(char* dest, uint8_t count){
+	if (count > 99){
+		count = 99;
+	}
+	dest[0] = '0' + (count / 10);
+	dest[1] = '0' + (count % 10);
+}
+
+/**
+ * @brief Fills the display lines of the satellite page.
+ *
+ * One column per satellite in nf_sat_table: its SNR as a bar over lines 1 and 2, drawn with the
+ * CGRAM glyphs from ds_load_bar_glyphs(), and on line 3 '*' if it is used in the fix or '-' if it
+ * is only tracked. The table is filled from GSV by the parser in this loop, so it is read directly.
+ * The glyphs are loaded again if the compass page replaced them.
+ */
+void update_sat_lines(char* line0, char* line1, char* line2, char* line3){
+	uint8_t used = 0;
+	uint8_t best_snr = 0;
+
+	ds_load_bar_glyphs();
+
+	for (uint8_t i = 0; i < nf_sat_table.count; i++){
+		const nf_sat_t* sat = &nf_sat_table.sats[i];
+
+		ds_bar_chars(sat->snr / SAT_SNR_PER_LEVEL, &line1[i], &line2[i]);
+		if (sat->used){
+			line3[i] = '*';
+			used++;
+		} else if (sat->snr){
+			line3[i] = '-';
+		}
+		if (sat->snr > best_snr){
+			best_snr = sat->snr;
+		}
+	}
+
+	memcpy_P(line0, PSTR("Sats used    view   "), MAX_COL);
+	put_count(line0 + 10, used);
+	put_count(line0 + MAX_COL - SAT_NUM_DIGITS, nf_sat_table.in_view);
+	memcpy_P(line1 + MAX_COL - 6, PSTR("max"), 3);
+	put_count(line1 + MAX_COL - SAT_NUM_DIGITS, best_snr);
+	memcpy_P(line2 + MAX_COL - 5, PSTR("dBHz"), 4);
+	memcpy_P(line3 + MAX_COL - 5, PSTR("*=fix"), 5);
+}
+
+/**
+ * @brief Fills the display lines of the nearest page.
+ *
+ * The title replaces the latitude on line 0 and the saved positions nearest the user follow, one
+ * per line as "1 UTC161229 12.345km", from the ranking task_nav() made this tick.
+ */
+void update_near_lines(char* line0, char* line1, char* line2, char* line3){
+	char* rows[NEAR_ROWS] = {line1, line2, line3};
+
+	memcpy_P(line0, PSTR("Nearest saved "), MAX_COL - 6); //keeps "Mode:n"
+	memset(line1, ' ', MAX_COL);
+	if (ut_nearest_count == 0){
+		memcpy_P(line1, PSTR("No saved positions  "), MAX_COL);
+		return;
+	}
+	for (uint8_t rank = 0; (rank < NEAR_ROWS) && (rank < ut_nearest_count); rank++){
+		uint8_t index = ut_nearest[rank];
+
+		rows[rank][0] = '1' + rank;
+		ut_mem_name(index, rows[rank] + 2);
+		ut_distance_to_string(ut_mem_distance_dm[index], rows[rank] + NEAR_DIST_COL, DISTANCE_SIG_FIG);
+		memcpy_P(rows[rank] + NEAR_DIST_COL + DISTANCE_SIG_FIG, PSTR("km"), 2);
+	}
+}
+
+/**
+ * @brief Writes an angle as whole degrees, three digits and the degree sign, e.g. "045".
+ */
+static void put_degrees(char* dest, uint16_t cdeg){
+	uint16_t deg = ((cdeg + 50) / 100) % 360;
+
+	dest[0] = '0' + (deg / 100);
+	dest[1] = '0' + ((deg / 10) % 10);
+	dest[2] = '0' + (deg % 10);
+	dest[COMPASS_DEG_DIGITS] = DEGREE_CHAR;
+}
+
+/**
+ * @brief Fills the display lines of the compass page.
+ *
+ * A two by two character arrow in the left columns of lines 1 and 2 points at the selected memory
+ * location. While the receiver reports a course the arrow is relative to it, "C-up", so straight
+ * up means straight ahead; standing still it falls back to true north, "N-up". The bearing, the
+ * course and the distance are written beside it. The arrow glyphs replace the bar glyphs in CGRAM
+ * and are only uploaded when the arrow moves to another of the DS_ARROW_SECTORS sectors.
+ */
+void update_compass_lines(const nav_solution_t* nav, char* line0, char* line1, char* line2, char* line3){
+	uint16_t relative_cdeg = ut_bearing_cdeg;
+
+	memcpy_P(line0, PSTR("To            "), MAX_COL - 6); //keeps "Mode:n"
+	ut_mem_name(ut_memory_0idx, line0 + 3);
+	memset(line1, ' ', MAX_COL);
+	if (ut_bearing_cdeg == UT_BEARING_UNKNOWN){
+		memcpy_P(line1 + COMPASS_TEXT_COL, PSTR("Empty"), 5);
+		return;
+	}
+	if (nav->course_cdeg != NF_COURSE_UNKNOWN){
+		relative_cdeg = (ut_bearing_cdeg + NF_CDEG_PER_TURN - nav->course_cdeg) % NF_CDEG_PER_TURN;
+		memcpy_P(line1 + COMPASS_UP_COL, PSTR("C-up"), 4);
+	} else {
+		memcpy_P(line1 + COMPASS_UP_COL, PSTR("N-up"), 4);
+	}
+	//round to the nearest sector; sector 0 is centred on straight up
+	ds_load_arrow_glyphs((relative_cdeg + (NF_CDEG_PER_TURN / (2 * DS_ARROW_SECTORS))) / (NF_CDEG_PER_TURN / DS_ARROW_SECTORS));
+	ds_arrow_chars(line1, line2);
+
+	memcpy_P(line1 + COMPASS_TEXT_COL, PSTR("Brg"), 3);
+	put_degrees(line1 + COMPASS_TEXT_COL + 4, ut_bearing_cdeg);
+	memcpy_P(line2 + COMPASS_TEXT_COL, PSTR("Crs"), 3);
+	if (nav->course_cdeg != NF_COURSE_UNKNOWN){
+		put_degrees(line2 + COMPASS_TEXT_COL + 4, nav->course_cdeg);
+	} else {
+		memcpy_P(line2 + COMPASS_TEXT_COL + 4, PSTR("---"), COMPASS_DEG_DIGITS);
+	}
+	memcpy_P(line3 + COMPASS_TEXT_COL, PSTR("Dist"), 4);
+	memcpy(line3 + COMPASS_TEXT_COL + 5, ut_distance_str, DISTANCE_SIG_FIG);
+	memcpy_P(line3 + COMPASS_TEXT_COL + 5 + DISTANCE_SIG_FIG, PSTR("km"), 2);
+}
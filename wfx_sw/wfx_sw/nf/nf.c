@@ -3,422 +3,285 @@
 #endif
 
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/delay.h>
 #include <string.h>
-#include <stdlib.h>
 #include <stdint-gcc.h>
 #include "nf.h"
+#include "nf_health.h"
+#include "nf_parse.h"
 #include "nf_types.h"
+#include "nf_ubx.h"
 #include "../lib/uart.h"
 #include "../ds/ds.h"
 #include "../ut/utilities.h"
 
 //defines
-#define UART_BAUD_RATE 9600
-#define NMEA_MSG_ID_SIZE 5
-
-//NMEA message IDs from NMEA documentation
-#define GGA_TYPE "GPGGA"
-#define GLL_TYPE "GPGLL"
-#define GSA_TYPE "GPGSA"
-#define GSV_TYPE "GPGSV"
-#define MSS_TYPE "GPMSS"
-#define RMC_TYPE "GPRMC"
-#define VTG_TYPE "GPVTG"
-#define ZDA_TYPE "GPZDA"
-#define OK_TO_SEND_TYPE "PSRF1"
+#define NF_UART_BLOCK_SIZE 8 /**< Bytes taken from the UART ring buffer per read */
+#define NF_UART_ERRORS (UART_FRAME_ERROR | UART_OVERRUN_ERROR | UART_BUFFER_OVERFLOW) /**< uart_getc() errors that lose data */
 
 //global
-//GGA MESSAGE
-char utc_time[GGA_UTC_BUFFER_SIZE];             /**< UTC Time, e.g., "161229.487" */
-char latitude[GGA_LAT_BUFFER_SIZE];             /**< Latitude, e.g., "3723.2475" */
-char ns_indicator[GGA_INDICATOR_SIZE];          /**< N/S Indicator, 'N' for north or 'S' for south */
-char longitude[GGA_LONG_BUFFER_SIZE];            /**< Longitude, e.g., "12158.3416" */
-char ew_indicator[GGA_INDICATOR_SIZE];          /**< E/W Indicator, 'E' for east or 'W' for west */
-char position_fix_indicator[GGA_INDICATOR_SIZE];/**< Position Fix Indicator, see Table 1-4 */
-char satellites_used[GGA_SV_USD_BUFFER_SIZE];    /**< Satellites Used, range 0 to 12 eg 07 */
-char hdop[GGA_HDOP_BUFFER_SIZE];                /**< HDOP (Horizontal Dilution of Precision), e.g., "1.0" */
-char msl_altitude[GGA_ALTITUDE_BUFFER_SIZE];     /**< Mean Sea Level Altitude, e.g., "1.0" */
-char speed[VTG_SPEED_BUFER_SIZE];               /**< Speed, e.g., "0.0" */
-
-float latitudeLLA_float;    /**< Latitude in degrees */
-float longitudeLLA_float;   /**< Longitude in degrees */
-float altitudeLLA_float;    /**< Altitude in meters */
-char latitudeLLA_str[LLA_LAT_BUFFER_SIZE];      /**< Latitude in degrees */
-char longitudeLLA_str[LLA_LONG_BUFFER_SIZE];    /**< Longitude in degrees */
-char altitudeLLA_str[LLA_ALT_BUFFER_SIZE];      /**< Altitude in meters */
+uint32_t nf_gps_baud;                           /**< Baud rate the GPS link is running at */
+uint8_t nf_nav_rate_hz;                         /**< Navigation solutions per second the receiver was set to */
+uint16_t nf_rx_byte_count;                      /**< Bytes taken from the UART, wraps */
+uint16_t nf_rx_dropped_count;                   /**< Sentences the UART dropped, wraps */
+boolean_t nf_receiver_configured;               /**< Receiver acknowledged the output configuration */
 
 //local static
-static char nmea_msg_id_buffer[NMEA_MSG_ID_SIZE];/**< Buffer to store NMEA message ID */
-static char gga_msg_buffer[GGA_SIZE];            /**< Buffer to store GGA message */
+static uint16_t nf_rx_error;                    /**< Errors reported with the last byte of the block just read */
+static boolean_t nf_rx_sentences;               /**< The UART delivers whole sentences, see uart_rx_sentences() */
 
+/**
+ * @brief A baud rate tried during link detection and its UART_BAUD_SELECT() setting.
+ */
+typedef struct {
+	uint32_t baud;        /**< Baud rate */
+	uint16_t uart_setting; /**< Value for uart_init() */
+} nf_baud_candidate_t;
 
 //function definitions
 
 /**
- * @brief Clear all navigation strings except UTC time.
+ * @brief Baud rates tried by nf_detect_baud(), most likely first: the rate an earlier boot moved
+ * the receiver to, then the factory default. Rates that the 4MHz clock cannot generate within
+ * about 2% are left out (115200 would be 8.5% fast).
  */
-void nf_clear_nav_strings(){
-	    memset(nmea_msg_id_buffer,0,sizeof(char)*NMEA_MSG_ID_SIZE); //zeroize
-	    memset(gga_msg_buffer, ' ',sizeof(char)*GGA_SIZE); //zeroize msg buffer
-	    memset(latitude, ' ', GGA_LAT_BUFFER_SIZE * sizeof(char));
-	    memset(ns_indicator, ' ', GGA_INDICATOR_SIZE * sizeof(char));
-	    memset(longitude, ' ', GGA_LONG_BUFFER_SIZE * sizeof(char));
-	    memset(ew_indicator, ' ', GGA_INDICATOR_SIZE * sizeof(char));
-	    memset(position_fix_indicator, ' ', GGA_INDICATOR_SIZE * sizeof(char));
-	    memset(satellites_used, ' ', GGA_SV_USD_BUFFER_SIZE * sizeof(char));
-	    memset(hdop, ' ', GGA_HDOP_BUFFER_SIZE * sizeof(char));
-	    memset(msl_altitude, ' ', GGA_ALTITUDE_BUFFER_SIZE * sizeof(char));
-
-	    memset(latitudeLLA_str, ' ', LLA_LAT_BUFFER_SIZE * sizeof(char));
-	    memset(longitudeLLA_str, ' ', LLA_LONG_BUFFER_SIZE * sizeof(char));
-	    memset(altitudeLLA_str, ' ', LLA_ALT_BUFFER_SIZE * sizeof(char));
-}
+static const nf_baud_candidate_t nf_baud_candidates[] PROGMEM = {
+	{NF_GPS_BAUD_RATE, UART_BAUD_SELECT_DOUBLE_SPEED(NF_GPS_BAUD_RATE, F_CPU)}, //+0.2%
+	{NF_GPS_DEFAULT_BAUD_RATE, UART_BAUD_SELECT(NF_GPS_DEFAULT_BAUD_RATE, F_CPU)}, //+0.2%
+	{19200, UART_BAUD_SELECT(19200, F_CPU)}, //+0.2%
+	{4800, UART_BAUD_SELECT(4800, F_CPU)}, //+0.2%
+	{57600, UART_BAUD_SELECT_DOUBLE_SPEED(57600, F_CPU)}, //-3.5%, marginal
+};
 
 /**
- * @brief Initialize the navigation fetch module.
- * This function initializes UART communication and clears navigation strings.
- * @return 0 if initialization is successful, otherwise returns 1.
+ * @brief (Re)initialize the UART and its ring buffers.
+ * uart_init() only ever sets U2X, so it is cleared here first to allow going back to normal speed.
+ * @param uart_setting UART_BAUD_SELECT() or UART_BAUD_SELECT_DOUBLE_SPEED() value.
  */
-uint8_t nf_init(){
+static void nf_uart_init(uint16_t uart_setting){
+	uint8_t sreg = SREG;
 	cli();
-	 /*
+	UCSR0A &= ~(1 << U2X0);
+	/*
      *  Initialize UART library, pass baudrate and AVR cpu clock
      *  with the macro 
      *  UART_BAUD_SELECT() (normal speed mode )
      *  or 
      *  UART_BAUD_SELECT_DOUBLE_SPEED() ( double speed mode)
      */
-    uart_init( UART_BAUD_SELECT(UART_BAUD_RATE,F_CPU) );
-
-	// Initialize the arrays within gga_msg 
-	memset(utc_time, ' ', GGA_UTC_BUFFER_SIZE * sizeof(char));
-	memset(speed, ' ', VTG_SPEED_BUFER_SIZE * sizeof(char));
-
-    nf_clear_nav_strings();
-
-
-	latitudeLLA_float = 0;  
-	longitudeLLA_float = 0;  
-	altitudeLLA_float = 0; 
-	
-	
-	sei(); //UART is interrupt based;	
-	return NF_INIT_SUCCESS;
+	uart_init(uart_setting);
+	SREG = sreg;
 }
 
 /**
- * @brief Read a single character from the serial communication.
- * This function blocks until a character is received.
- * @param outputchar Pointer to the character variable to store the read character.
+ * @brief Check that the receiver talks to us at the current UART setting.
+ * Either a checksum-valid sentence or frame arrives, or the receiver answers a CFG-PRT poll,
+ * which also covers receivers whose periodic output was switched off by an earlier boot.
+ * @return true if the link works.
  */
-void get_serial_char(char* outputchar){
-	unsigned int c;
-	while (1){
-		/*
-		* Get received character from ringbuffer
-		* uart_getc() returns in the lower byte the received character and 
-		* in the higher byte (bitmask) the last receive error
-		* UART_NO_DATA is returned when no data is available.
-		*
-		*/
-		c = uart_getc();
-		if (!( c & UART_NO_DATA ))
-		{
-			/*
-				* new data available from UART
-				* check for Frame or Overrun error
-				*/
-			#ifdef __DEBUG__
-				if ( c & UART_FRAME_ERROR )
-				{
-					/* Framing Error detected, i.e no stop bit detected */
-					#ifdef _DEBUG_
-						char* output = "NF Frame Error! ";
-						ds_print_string(output, 16, 0);
-					#endif
-				}
-				if ( c & UART_OVERRUN_ERROR )
-				{
-					/* 
-						* Overrun, a character already present in the UART UDR register was 
-						* not read by the interrupt handler before the next character arrived,
-						* one or more received characters have been dropped
-						*/
-					char* output = "           OR ER";
-					ds_print_string(output, 16, 0);
-				}
-				if ( c & UART_BUFFER_OVERFLOW )
-				{
-					/* 
-						* We are not reading the receive buffer fast enough,
-						* one or more received character have been dropped 
-						*/
-					char* output = "OF ER";
-					ds_print_string(output, 5, 0);
-				}
-			#endif
+static boolean_t nf_link_alive(){
+	uint16_t accepted = 0;
+	for (uint8_t i = 0; i < NF_NUM_MSG_TYPES; i++){
+		accepted += nf_accept_count[i];
+	}
+	if (nf_ubx_poll_port() == NF_UBX_ACKED){
+		return true;
+	}
+	for (uint8_t i = 0; i < NF_NUM_MSG_TYPES; i++){
+		accepted -= nf_accept_count[i];
+	}
+	return accepted != 0;
+}
 
-			/* 
-			* send received character back
-			*/
-			*outputchar = (unsigned char)c;
-			return;
+/**
+ * @brief Find the baud rate the receiver is currently using.
+ * @return Index into nf_baud_candidates, or -1 if the receiver did not answer at any rate.
+ */
+static int8_t nf_detect_baud(){
+	for (uint8_t i = 0; i < sizeof(nf_baud_candidates) / sizeof(nf_baud_candidates[0]); i++){
+		nf_uart_init(pgm_read_word(&nf_baud_candidates[i].uart_setting));
+		nf_gps_baud = pgm_read_dword(&nf_baud_candidates[i].baud);
+		if (nf_link_alive()){
+			return i;
 		}
 	}
-	
+	return -1;
 }
 
 /**
- * @brief Read a raw NMEA message from the serial communication.
- * This function reads a raw NMEA message and processes GGA and VTG messages.
- * Additionally, it polls buttons between messages.
+ * @brief Detect the receiver's baud rate and move the link to NF_GPS_BAUD_RATE.
+ * If nothing answers, the UART is left at the factory default so a receiver that comes up
+ * late is still parsed.
+ * @return true if the link is up at NF_GPS_BAUD_RATE.
  */
-void read_nmea_msg_raw(){
-	//nf_clear_nav_strings();
-	char tempChar;
-	do {
-		get_serial_char(&tempChar);
-	} while (tempChar != '$');
+static boolean_t nf_link_init(){
+	int8_t found = nf_detect_baud();
 
-	for (int i = 0; i < NMEA_MSG_ID_SIZE; i++){
-		get_serial_char(nmea_msg_id_buffer + i);
+	if (found < 0){
+		nf_uart_init(UART_BAUD_SELECT(NF_GPS_DEFAULT_BAUD_RATE, F_CPU));
+		nf_gps_baud = NF_GPS_DEFAULT_BAUD_RATE;
+		return false;
+	}
+	if (nf_gps_baud == NF_GPS_BAUD_RATE){
+		return true; //already moved by an earlier boot
 	}
-	get_serial_char(&tempChar); //eat comma
-	
-	int counter = 0; //common counter to save memory alloc time	
-	//-----------------------------------------------------------------
-	//only need GGA and VTG for requirements. Drop others
-	if(strcmp(nmea_msg_id_buffer, GGA_TYPE) == 0){
-		//scrape raw
-		for (counter = 0; counter < GGA_SIZE; counter ++){
-			get_serial_char(gga_msg_buffer+counter);
-		}		
-		//process message
-		int offset = 0;
-		//////////////////////////////////////////
-		//grab UTC if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_UTC_BUFFER_SIZE; i++){
-				utc_time[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(utc_time, GGA_UTC_BUFFER_SIZE, 0);	
-		}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++;// skip comma
-		
-		//////////////////////////////////////////
-		//grab LAT if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_LAT_BUFFER_SIZE; i++){
-				latitude[i] = gga_msg_buffer[offset++];
-			}
-			
-			//ds_print_string(latitude, GGA_LAT_BUFFER_SIZE, 0);
-		}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++; // skip comma
-		
-		//////////////////////////////////////////
-		//grab NS indicator if available
-		if (gga_msg_buffer[offset] != ','){
-			ns_indicator[0] = gga_msg_buffer[offset++];
-			//ds_print_string(ew_indicator, GGA_INDICATOR_SIZE, 1);
-		}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++; // skip comma
-		
-		
-		//////////////////////////////////////////
-		//grab LONG if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_LONG_BUFFER_SIZE; i++){
-				longitude[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(longitude, GGA_LONG_BUFFER_SIZE, 1);
-		}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++; // skip comma
-		
-		//////////////////////////////////////////
-		//grab EW indicator if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_INDICATOR_SIZE; i++){
-				ew_indicator[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(ew_indicator, GGA_INDICATOR_SIZE, 1);
-			}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++; // skip comma
-		
-		
-		//////////////////////////////////////////
-		//grab FIX indicator if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_INDICATOR_SIZE; i++){
-				position_fix_indicator[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(position_fix_indicator, GGA_INDICATOR_SIZE, 1);
-			}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++; // skip comma
-		
-		//////////////////////////////////////////
-		//grab NUM_SV if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_SV_USD_BUFFER_SIZE; i++){
-				satellites_used[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(satellites_used, GGA_SV_USD_BUFFER_SIZE, 1);
-			}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-	    offset++; // skip comma
-		
-		//////////////////////////////////////////
-		//grab HDOP if available
-		if (gga_msg_buffer[offset] != ','){
-			for (int i =0; i < GGA_HDOP_BUFFER_SIZE; i++){
-				hdop[i] = gga_msg_buffer[offset++];
-			}
-			//ds_print_string(hdop, GGA_HDOP_BUFFER_SIZE, 0);
-		}else{ //otherwise skip comma from if statement
-			offset++;
-		}
-		offset++;
-		//end of known sizes. Alt is dynamic
-		tempChar = 0;
-		int i = 0;
-		get_serial_char(&tempChar);//eat comma
-		get_serial_char(&tempChar);
-		while ((tempChar != ',') && (i < GGA_ALTITUDE_BUFFER_SIZE)){
-			msl_altitude[i++] = tempChar;
-			get_serial_char(&tempChar);
-		}
-		
-		
-	} //END GGA
-	else if (strcmp(nmea_msg_id_buffer, VTG_TYPE) == 0){
-			for (uint8_t comma_counter = 6; comma_counter >0; comma_counter--){
-				do{
-					get_serial_char(&tempChar);
-				} while (tempChar != ',');
-			}
-			memset(speed, ' ', VTG_SPEED_BUFER_SIZE * sizeof(char));
-			//should be at speed now
-			int i = 0;
-			get_serial_char(&tempChar);//eat comma
-			while ((tempChar != ',') && (i < VTG_SPEED_BUFER_SIZE)){
-				speed[i++] = tempChar;
-				get_serial_char(&tempChar);
-			}
 
-	}//end VTG msg
+	nf_ubx_set_port_baud(NF_GPS_BAUD_RATE);
+	_delay_ms(NF_BAUD_SWITCH_DELAY_MS); //let the CFG-PRT frame leave at the old rate
+	nf_uart_init(pgm_read_word(&nf_baud_candidates[0].uart_setting));
+	nf_gps_baud = NF_GPS_BAUD_RATE;
+	if (nf_link_alive()){
+		return true;
+	}
 
-	//poll buttons between messages
-	//ut_poll_btns();
+	//receiver did not follow; go back to where we found it
+	nf_uart_init(pgm_read_word(&nf_baud_candidates[found].uart_setting));
+	nf_gps_baud = pgm_read_dword(&nf_baud_candidates[found].baud);
+	return false;
 }
 
-
-
-
 /**
- * @brief Convert NMEA format coordinates to Latitude, Longitude, and Altitude (LLA) format.
- * This function converts NMEA format coordinates to LLA format and stores them in global variables.
+ * @brief Initialize the navigation fetch module.
+ * This function initializes UART communication and clears navigation strings.
+ * @return 0 if initialization is successful, otherwise returns 1.
  */
-void convertNMEAtoLLA() {
-	// Convert latitude from NMEA format to degrees
-	double deg = 0.0;
-	double min = 0.0;
-
-	// Convert the latitude from degrees and minutes to degree decimal
-	char tempBuffer[9] = {0};
-	for (int i = 0; i < 8; i++){
-		tempBuffer[i] = latitude[2+i];
-	}
-	min = atof(tempBuffer);
-	
-	deg += (1.0 * (latitude[GGA_LAT_BUFFER_SIZE - 9] - '0'));
-	deg += (10.0 * (latitude[GGA_LAT_BUFFER_SIZE - 10] - '0'));
-
-	latitudeLLA_float = deg + (min / 60.0f); // Combine degrees and minutes
-
+uint8_t nf_init(){
+	cli();
+    nf_uart_init(UART_BAUD_SELECT(NF_GPS_DEFAULT_BAUD_RATE, F_CPU));
+    nf_gps_baud = NF_GPS_DEFAULT_BAUD_RATE;
 
-	// Extract integer and decimal parts
-	uint16_t integer_part = (uint16_t)latitudeLLA_float;
-    float fractional_part = latitudeLLA_float - integer_part;
-    uint32_t decimal_part = (uint32_t)(fractional_part * 100000);
+	nf_parse_reset(); //blank the nav solution, resync on the next '$'
+	nf_ubx_reset();
 	
-	// Convert integer part to string
-	latitudeLLA_str[1] = '0' + ((integer_part / 10) % 10); // Tens
-	latitudeLLA_str[2] = '0' + (integer_part % 10); // Ones
-
-	// Decimal point
-	latitudeLLA_str[3] = '.';
+	sei(); //UART is interrupt based;	
 
-    // Convert decimal part to string
-    latitudeLLA_str[4] = '0' + ((decimal_part / 10000) % 10); // Ten-thousands
-    latitudeLLA_str[5] = '0' + ((decimal_part / 1000)% 10); // Thousands
-    latitudeLLA_str[6] = '0' + ((decimal_part / 100) % 10); // Hundreds
-    latitudeLLA_str[7] = '0' + ((decimal_part / 10) % 10); // Tens
-    latitudeLLA_str[8] = '0' + (decimal_part % 10); // Ones
-	
-	if (ns_indicator[0] =='S'){
-		latitudeLLA_str[0] = '-';
-		latitudeLLA_float *= -1;
-		} else{
-		latitudeLLA_str[0] = '+';
+	//transmit is interrupt driven too, so configure the receiver after sei()
+	nf_receiver_configured = nf_link_init();
+	if (nf_receiver_configured){
+		nf_receiver_configured = nf_ubx_configure_output();
 	}
-
-	
-	//long
-	deg = 0.0;
-	min = 0.0;
-
-	// Convert the longitude from degrees and minutes to degree decimal
-	char tempBuffer2[9] = {0};
-	for (int i = 0; i < 8; i++){
-		tempBuffer2[i] = longitude[3+i];
+	nf_nav_rate_hz = 1; //receiver default
+	if (nf_receiver_configured){
+		if (nf_ubx_set_rate(NF_NAV_RATE_HZ) == NF_UBX_ACKED){
+			nf_nav_rate_hz = NF_NAV_RATE_HZ;
+		} else {
+			nf_receiver_configured = false;
+		}
 	}
-	min = atof(tempBuffer2);
-	
-	deg += (1.0 * (longitude[2] - '0'));
-	deg += (10.0 * (longitude[1] - '0'));
-	deg += (100.0 * (longitude[0] - '0'));
-
-	longitudeLLA_float = deg + (min / 60.0f); // Combine degrees and minutes
-
-	// Extract integer and decimal parts
-	integer_part = (uint16_t)longitudeLLA_float;
-	fractional_part = longitudeLLA_float - integer_part;
-	decimal_part = (uint32_t)(fractional_part * 100000);
+#if !NF_INPUT_UBX
+	//configuration is done and only NMEA follows; the receive interrupt now frames whole sentences
+	uart_rx_sentences(1);
+	nf_rx_sentences = true;
+#endif
+	nf_health_init();
+	return NF_INIT_SUCCESS;
+}
 
-	// Convert integer part to string
-	longitudeLLA_str[1] = '0' + ((integer_part / 100) % 10); // Hundreds
-	longitudeLLA_str[2] = '0' + ((integer_part / 10) % 10); // Tens
-	longitudeLLA_str[3] = '0' + (integer_part % 10); // Ones
+/**
+ * @brief Byte source reading the UART receive ring buffer; see nf_byte_source_t.
+ * A byte that comes with a receive error ends the block and leaves the error in nf_rx_error,
+ * so the parser can be resynced right before that byte.
+ * @param ctx Unused.
+ * @param buf Destination for the received bytes.
+ * @param size Room in buf.
+ * @return Number of bytes copied, 0 once the ring buffer is empty.
+ */
+static uint16_t nf_uart_read(void* ctx, uint8_t* buf, uint16_t size){
+	uint16_t count = 0;
+	unsigned int c;
 
-	// Decimal point
-	longitudeLLA_str[4] = '.';
+	/*
+	* Get received character from ringbuffer
+	* uart_getc() returns in the lower byte the received character and
+	* in the higher byte (bitmask) the last receive error
+	* UART_NO_DATA is returned when no data is available.
+	*/
+	while ((count < size) && !((c = uart_getc()) & UART_NO_DATA)){
+		#ifdef __DEBUG__
+			if ( c & UART_FRAME_ERROR )
+			{
+				/* Framing Error detected, i.e no stop bit detected */
+				#ifdef _DEBUG_
+					char* output = "NF Frame Error! ";
+					ds_print_string(output, 16, 0);
+				#endif
+			}
+			if ( c & UART_OVERRUN_ERROR )
+			{
+				/*
+					* Overrun, a character already present in the UART UDR register was
+					* not read by the interrupt handler before the next character arrived,
+					* one or more received characters have been dropped
+					*/
+				char* output = "           OR ER";
+				ds_print_string(output, 16, 0);
+			}
+			if ( c & UART_BUFFER_OVERFLOW )
+			{
+				/*
+					* We are not reading the receive buffer fast enough,
+					* one or more received character have been dropped
+					*/
+				char* output = "OF ER";
+				ds_print_string(output, 5, 0);
+			}
+		#endif
+		buf[count++] = (uint8_t)c;
+		if (c & NF_UART_ERRORS){
+			nf_rx_error = c & NF_UART_ERRORS;
+			break;
+		}
+	}
+	nf_rx_byte_count += count;
+	return count;
+}
 
-	// Convert decimal part to string
-	longitudeLLA_str[5] = '0' + ((decimal_part / 10000) % 10); // Ten-thousands
-	longitudeLLA_str[6] = '0' + ((decimal_part / 1000)% 10); // Thousands
-	longitudeLLA_str[7] = '0' + ((decimal_part / 100) % 10); // Hundreds
-	longitudeLLA_str[8] = '0' + ((decimal_part / 10) % 10); // Tens
-	longitudeLLA_str[9] = '0' + (decimal_part % 10); // Ones
+static const nf_byte_source_t nf_uart_source = {nf_uart_read, 0}; /**< The GPS receiver's UART */
 
-	if (ns_indicator[0] =='S'){
-		longitudeLLA_str[0] = '-';
-		latitudeLLA_float *= -1;
-		} else{
-		longitudeLLA_str[0] = '+';
+/**
+ * @brief Feed every character currently buffered by the UART driver to the NMEA or UBX parser.
+ * Bytes left in the ring buffer are parsed first, then every completed sentence slot, which
+ * is parsed in place and handed back to the receive interrupt. Returns as soon as both are
+ * empty, so the main loop keeps running instead of waiting for a full sentence.
+ * @return true if at least one sentence or UBX navigation message was published during this call.
+ */
+boolean_t nf_poll_serial(){
+	boolean_t published = false;
+	uint8_t block[NF_UART_BLOCK_SIZE];
+	uint16_t count;
+	const char* sentence;
+	uint8_t length;
+
+	while ((count = nf_uart_source.read(nf_uart_source.ctx, block, sizeof(block))) > 0){
+		for (uint16_t i = 0; i < count; i++){
+			if (nf_rx_error && (i + 1 == count)){ //bytes were lost before this one
+				nf_health_rx_error(nf_rx_error);
+				nf_rx_error = 0;
+			}
+			//UBX frames start with 0xB5, which never appears in NMEA text
+			if (nf_ubx_in_frame() || (block[i] == UBX_SYNC_CHAR_1)){
+				if (nf_ubx_parse_char(block[i])){
+					published = true;
+				}
+			} else if (nf_parse_char((char)block[i])){
+				published = true;
+			}
+		}
 	}
 
-	altitudeLLA_float = atof(msl_altitude); 
-}
\ No newline at end of file
+	while ((sentence = uart_get_sentence(&length)) != 0){
+		if (nf_parse_sentence(sentence, length)){
+			published = true;
+		}
+		uart_release_sentence();
+		nf_rx_byte_count += length;
+	}
+	nf_rx_dropped_count = uart_sentences_dropped();
+	if (nf_rx_sentences && ((nf_rx_error = uart_get_rx_error()) & NF_UART_ERRORS)){
+		nf_health_rx_error(nf_rx_error); //the hit sentence was already dropped by the receive interrupt; count the error
+	}
+	nf_rx_error = 0;
+	nf_health_update();
+	return published;
+}
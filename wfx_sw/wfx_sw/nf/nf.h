@@ -10,32 +10,81 @@
 
 #include "../ut/ut_types.h"
 #include "../ds/ds.h"
+#include "nf_parse.h"
 
 #define NF_INIT_SUCCESS 0
 #define NF_INIT_FAILURE 1
 
+#define NF_GPS_BAUD_RATE 38400UL /**< Baud rate the GPS link is moved to; 115200 is 8.5% off at 4MHz */
+#define NF_GPS_DEFAULT_BAUD_RATE 9600UL /**< NEO-6M factory baud rate */
+#define NF_BAUD_SWITCH_DELAY_MS 100 /**< Time for a CFG-PRT frame to leave the TX buffer at 4800 baud */
 
-/**
- * @brief Initialize the navigation fetch module.
- * @return 0 if initialization is successful
- */
-uint8_t nf_init();
+#ifndef NF_INPUT_UBX
+#define NF_INPUT_UBX 0 /**< 1: switch the receiver to UBX binary navigation output, 0: parse its NMEA output */
+#endif
 
 /**
- * @brief Read a single character from the serial communication.
- * @param outputchar Pointer to the character variable to store the read character.
+ * @brief Navigation solutions per second requested with UBX-CFG-RATE: 1, 5 or 10.
+ *
+ * Budget per rate at 38400 baud and F_CPU = 4MHz. The link figures follow from the sentence
+ * lengths. The CPU figures are estimates from instruction counts, not measurements: about 250
+ * cycles per byte for the UART RX ISR plus parser, about 6ms for the navigation task (LCD
+ * refresh 4ms, distance and bearing to the selected location 1ms, coordinate formatting 1ms)
+ * and about 6% for the button poll ISR. While the nearest list is shown, ranging all
+ * MAX_MEM_INDEX locations once a second, with the cosines of each as RAM does not keep them,
+ * adds about 55ms, 6%, at any rate. Neither
+ * tools/nf_bench/nf_bench_avr.c nor an IR_PROFILE=1 build has been run on the target yet;
+ * replace them with its parser and task share once it has.
+ *
+ *   rate   NMEA link   UBX link   parser   task   total CPU   with nearest list
+ *   1 Hz     11%          5%        3%      1%      10%           16%
+ *   5 Hz     24%         25%        6%      3%      15%           21%
+ *   10 Hz    42%         51%       10%      6%      22%           28%
+ *
+ * The check below guards the link figures only; nothing checks the CPU figures at build time.
+ *
+ * NMEA figures include the GSA and GSV satellite sentences, which are requested once per second
+ * whatever the rate.
+ *
+ * NMEA output is framed into UART_SENTENCE_SLOTS sentence slots by the receive interrupt, two
+ * full sentences or about 40ms at 38400 baud besides the one being received. UBX output goes
+ * through the 32 byte ring buffer, only 8ms, so the navigation task still polls the parser
+ * between its steps. The NEO-6M is rated for 5 Hz; 10 Hz needs a newer receiver.
  */
-void get_serial_char(char* outputchar);
+#ifndef NF_NAV_RATE_HZ
+#define NF_NAV_RATE_HZ 5
+#endif
+
+#define NF_EPOCH_BYTES_NMEA 132 /**< Longest GGA plus VTG, sent once per solution */
+#define NF_EPOCH_BYTES_UBX 194  /**< NAV-POSLLH, SOL, VELNED, DOP and TIMEUTC frames per solution */
+#define NF_SAT_BYTES_NMEA 276   /**< GSA plus a three message GSV burst, sent once per second */
+#if NF_INPUT_UBX
+#define NF_EPOCH_BYTES NF_EPOCH_BYTES_UBX
+#define NF_SAT_BYTES 0
+#else
+#define NF_EPOCH_BYTES NF_EPOCH_BYTES_NMEA
+#define NF_SAT_BYTES NF_SAT_BYTES_NMEA
+#endif
+
+#if (NF_NAV_RATE_HZ != 1) && (NF_NAV_RATE_HZ != 5) && (NF_NAV_RATE_HZ != 10)
+#error "NF_NAV_RATE_HZ must be 1, 5 or 10"
+#endif
+#if (((NF_NAV_RATE_HZ * NF_EPOCH_BYTES) + NF_SAT_BYTES) * 10UL * 4) > (NF_GPS_BAUD_RATE * 3)
+#error "GPS link would be more than 75% busy at NF_NAV_RATE_HZ"
+#endif
+
 
 /**
- * @brief Read a raw NMEA message from the serial communication and extracts relevant data.
+ * @brief Initialize the navigation fetch module.
+ * @return 0 if initialization is successful
  */
-void read_nmea_msg_raw();
+uint8_t nf_init();
 
 /**
- * @brief Convert NMEA format coordinates to Latitude, Longitude, and Altitude (LLA) format.
+ * @brief Feed all characters currently buffered by the UART to the NMEA or UBX parser and return.
+ * @return true if at least one sentence or UBX navigation message was published.
  */
-void convertNMEAtoLLA();
+boolean_t nf_poll_serial();
 
 
 #endif /* NF_H_ */
\ No newline at end of file
@@ -0,0 +1,151 @@
+/**
+ * @file nf_health.c
+ * @brief GPS link health monitor of the navigation fetch (NF) CSC.
+ *
+ * Everything is derived from the parser's accept and reject counters and the Timer2 tick, so
+ * the monitor adds no work per received byte. A receive error only drops the sentence it hit:
+ * the parsers wait for the next '$' (or UBX sync) and the navigation solution, the UART and the
+ * receiver configuration are left alone.
+ */
+
+#include "nf.h"
+#include "nf_health.h"
+#include "nf_parse.h"
+#include "nf_types.h"
+#include "nf_ubx.h"
+#include "../ir/ir.h"
+#include "../lib/uart.h"
+
+//defines
+#if NF_INPUT_UBX
+#define NF_HEALTH_FIX_MSG NF_MSG_UBX /**< Message type that carries the fix */
+#else
+#define NF_HEALTH_FIX_MSG NF_MSG_GGA
+#endif
+#define NF_HEALTH_MS_PER_TICK (1000 / IR_TICK_HZ)
+#define NF_HEALTH_TICKS_PER_DS (IR_TICK_HZ / 10)
+
+//global
+nf_health_t nf_health; /**< Current link health */
+
+//local static
+static uint32_t last_sentence_tick;  /**< When the accept count last changed */
+static uint32_t last_fix_tick;       /**< When the last fix arrived */
+static uint32_t window_start_tick;   /**< Start of the current one second window */
+static uint16_t last_accepted;       /**< Accepted sentences at the last update */
+static uint16_t window_accepted;     /**< Accepted sentences at the start of the window */
+static uint16_t window_rejected;     /**< Rejected sentences at the start of the window */
+static nf_count_t last_fix_count;    /**< nf_accept_count[NF_HEALTH_FIX_MSG] at the last update */
+static boolean_t have_sentence;      /**< A valid sentence arrived since nf_health_init() */
+static boolean_t have_fix;           /**< The last fix message reported a fix */
+
+/**
+ * @brief Clamp a duration to 16 bits.
+ */
+static uint16_t nf_health_clamp(uint32_t value){
+	return (value > 0xFFFF) ? 0xFFFF : (uint16_t)value;
+}
+
+/**
+ * @brief Sum of the accept or reject counters over all sentence types, wraps.
+ */
+static uint16_t nf_health_total(const nf_count_t* counts){
+	uint16_t total = 0;
+	for (uint8_t i = 0; i < NF_NUM_MSG_TYPES; i++){
+		total += counts[i];
+	}
+	return total;
+}
+
+//function definitions
+
+/**
+ * @brief Start monitoring; called by nf_init() once the link is set up.
+ */
+void nf_health_init(){
+	uint32_t now = ir_ticks();
+
+	nf_health.state = NF_HEALTH_NO_DATA;
+	nf_health.sentence_gap_ms = 0;
+	nf_health.fix_age_ds = 0;
+	nf_health.sentences_per_s = 0;
+	nf_health.checksum_errors_per_s = 0;
+	nf_health.framing_errors = 0;
+	nf_health.overrun_errors = 0;
+	nf_health.resyncs = 0;
+
+	last_sentence_tick = now;
+	last_fix_tick = now;
+	window_start_tick = now;
+	last_accepted = nf_health_total(nf_accept_count);
+	window_accepted = last_accepted;
+	window_rejected = nf_health_total(nf_reject_count);
+	last_fix_count = nf_accept_count[NF_HEALTH_FIX_MSG];
+	have_sentence = false;
+	have_fix = false;
+}
+
+/**
+ * @brief Count a UART receive error and resync the parsers on the next '$'.
+ * Bytes were lost or garbled, so the sentence in progress cannot pass its checksum anyway;
+ * dropping it here keeps its remains from being taken as the start of a new one.
+ * @param error UART_FRAME_ERROR, UART_OVERRUN_ERROR and UART_BUFFER_OVERFLOW bits as returned by uart_getc().
+ */
+void nf_health_rx_error(uint16_t error){
+	if (error & UART_FRAME_ERROR){
+		nf_health.framing_errors++;
+	}
+	if (error & (UART_OVERRUN_ERROR | UART_BUFFER_OVERFLOW)){
+		nf_health.overrun_errors++;
+	}
+	nf_parse_resync();
+	nf_ubx_reset();
+	nf_health.resyncs++;
+}
+
+/**
+ * @brief Update cadence, error rate, fix age and state after the parser was polled.
+ */
+void nf_health_update(){
+	uint32_t now = ir_ticks();
+	uint16_t accepted = nf_health_total(nf_accept_count);
+	uint32_t fix_ticks;
+
+	if (accepted != last_accepted){
+		last_accepted = accepted;
+		last_sentence_tick = now;
+		have_sentence = true;
+	}
+	if (nf_accept_count[NF_HEALTH_FIX_MSG] != last_fix_count){
+		last_fix_count = nf_accept_count[NF_HEALTH_FIX_MSG];
+		have_fix = nf_nav_has_fix(nf_nav_solution());
+		if (have_fix){
+			last_fix_tick = now;
+		}
+	}
+	if (now - window_start_tick >= IR_TICK_HZ){
+		uint16_t rejected = nf_health_total(nf_reject_count);
+		uint16_t sentences = accepted - window_accepted;
+		uint16_t errors = rejected - window_rejected;
+
+		nf_health.sentences_per_s = (sentences > 0xFF) ? 0xFF : (uint8_t)sentences;
+		nf_health.checksum_errors_per_s = (errors > 0xFF) ? 0xFF : (uint8_t)errors;
+		window_accepted = accepted;
+		window_rejected = rejected;
+		window_start_tick = now;
+	}
+
+	fix_ticks = now - last_fix_tick;
+	nf_health.sentence_gap_ms = nf_health_clamp((now - last_sentence_tick) * NF_HEALTH_MS_PER_TICK);
+	nf_health.fix_age_ds = have_fix ? nf_health_clamp(fix_ticks / NF_HEALTH_TICKS_PER_DS) : 0;
+
+	if (have_fix && (fix_ticks > (uint32_t)NF_HEALTH_STALE_PERIODS * (IR_TICK_HZ / nf_nav_rate_hz))){
+		nf_health.state = NF_HEALTH_STALE_FIX;
+	} else if (!have_sentence || (nf_health.sentence_gap_ms >= NF_HEALTH_SILENT_MS)){
+		nf_health.state = NF_HEALTH_NO_DATA;
+	} else if (have_fix){
+		nf_health.state = NF_HEALTH_FIX;
+	} else {
+		nf_health.state = NF_HEALTH_NO_FIX;
+	}
+}
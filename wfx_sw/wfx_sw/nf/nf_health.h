@@ -0,0 +1,60 @@
+/**
+ * @file nf_health.h
+ * @brief Header file for the GPS link health monitor of the navigation fetch (NF) CSC.
+ *
+ * This file provides declarations for tracking how well sentences arrive from the receiver and
+ * how old the last fix is, and for recovering from receive errors without running nf_init()
+ * again.
+ */
+
+#ifndef NF_HEALTH_H_
+#define NF_HEALTH_H_
+
+#include "../ut/ut_types.h"
+
+#define NF_HEALTH_SILENT_MS 2000 /**< No valid sentence for this long means the link is down */
+#define NF_HEALTH_STALE_PERIODS 3 /**< Navigation periods without a new fix before the fix is stale, 0.6s at 5 Hz */
+
+/**
+ * @brief Link states, from worst to best.
+ */
+typedef enum {
+	NF_HEALTH_NO_DATA,   /**< No valid sentence for NF_HEALTH_SILENT_MS and no fix to fall back on */
+	NF_HEALTH_STALE_FIX, /**< The receiver had a fix but none arrived for NF_HEALTH_STALE_PERIODS periods */
+	NF_HEALTH_NO_FIX,    /**< Sentences arrive, the receiver reports no fix */
+	NF_HEALTH_FIX        /**< Fixes arrive at the navigation rate */
+} nf_health_state_t;
+
+/**
+ * @brief Health of the GPS link, updated by nf_poll_serial().
+ */
+typedef struct {
+	nf_health_state_t state;          /**< Overall state, see nf_health_state_t */
+	uint16_t sentence_gap_ms;       /**< Time since the last checksum-valid sentence or UBX frame, saturates */
+	uint16_t fix_age_ds;            /**< Time since the last fix in tenths of a second, saturates; 0 without a fix */
+	uint8_t sentences_per_s;        /**< Checksum-valid sentences in the last full second */
+	uint8_t checksum_errors_per_s;  /**< Sentences rejected for their checksum in the last full second */
+	uint16_t framing_errors;        /**< UART framing errors, wraps */
+	uint16_t overrun_errors;        /**< UART overruns and receive buffer overflows, wraps */
+	uint16_t resyncs;               /**< Times the parser dropped a sentence and waited for the next '$', wraps */
+} nf_health_t;
+
+extern nf_health_t nf_health; /**< Current link health */
+
+/**
+ * @brief Start monitoring; called by nf_init() once the link is set up.
+ */
+void nf_health_init();
+
+/**
+ * @brief Count a UART receive error and resync the parsers on the next '$'.
+ * @param error UART_FRAME_ERROR, UART_OVERRUN_ERROR and UART_BUFFER_OVERFLOW bits as returned by uart_getc().
+ */
+void nf_health_rx_error(uint16_t error);
+
+/**
+ * @brief Update cadence, error rate, fix age and state after the parser was polled.
+ */
+void nf_health_update();
+
+#endif /* NF_HEALTH_H_ */
@@ -0,0 +1,887 @@
+/**
+ * @file nf_parse.c
+ * @brief Streaming NMEA parser of the navigation fetch (NF) CSC.
+ *
+ * This file holds the parts of NF that do not touch the UART: the sentence state machine, the
+ * double buffered navigation solution it publishes, the satellite table and the display
+ * formatting. It builds for the AVR and, with a native compiler, for host tools that process
+ * recorded NMEA logs.
+ */
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define memcpy_P memcpy
+#endif
+#include <string.h>
+#include "nf_parse.h"
+#include "nf_types.h"
+
+//defines
+#define NMEA_MSG_ID_SIZE 5
+#define NMEA_CHECKSUM_SIZE 2 /**< Number of hex characters following the '*' */
+#define NMEA_MAX_SENTENCE_SIZE 82 /**< Longest legal sentence including '$' and <CR><LF>; proprietary sentences may be longer */
+#define NMEA_MINUTE_FRAC_DIGITS 5 /**< Fractional minute digits kept from ddmm.mmmmm fields */
+#define NMEA_ALTITUDE_FRAC_DIGITS 1 /**< Fractional digits kept from the altitude field (decimetres) */
+#define UDEG_PER_DEG 1000000UL /**< Microdegrees per degree */
+#define LLA_FRAC_DIGITS 5 /**< Decimal places shown in the LLA strings */
+
+//GGA field numbers; field 0 is the message ID
+#define GGA_UTC_FIELD 1
+#define GGA_LAT_FIELD 2
+#define GGA_NS_FIELD 3
+#define GGA_LONG_FIELD 4
+#define GGA_EW_FIELD 5
+#define GGA_FIX_FIELD 6
+#define GGA_SV_USD_FIELD 7
+#define GGA_HDOP_FIELD 8
+#define GGA_ALTITUDE_FIELD 9
+
+//VTG field numbers
+#define VTG_COURSE_FIELD 1 /**< Course over ground, degrees true */
+#define VTG_SPEED_FIELD 7 /**< Speed over ground in km/hr */
+#define NMEA_COURSE_FRAC_DIGITS 2 /**< Fractional digits kept from course fields (hundredths of a degree) */
+
+//GSV field numbers; each message then carries up to four groups of PRN, elevation, azimuth and SNR
+#define GSV_TOTAL_FIELD 1    /**< Messages in this burst */
+#define GSV_NUMBER_FIELD 2   /**< This message's number, from 1 */
+#define GSV_IN_VIEW_FIELD 3  /**< Satellites in view for this talker */
+#define GSV_SATS_PER_MSG 4
+#define GSV_SAT_FIELDS 4     /**< PRN, elevation, azimuth, SNR */
+
+//GSA field numbers; fields 3 to 14 list the PRNs used in the fix
+#define GSA_FIRST_PRN_FIELD 3
+#define GSA_PRN_FIELDS 12
+
+//RMC and ZDA carry UTC time in field 1, GLL in field 5
+#define RMC_ZDA_UTC_FIELD 1
+#define RMC_COURSE_FIELD 8 /**< Course over ground, degrees true */
+#define GLL_UTC_FIELD 5
+
+/**
+ * @brief Pack a three letter NMEA sentence type into one integer for single compare matching.
+ */
+#define NF_PACK_ID(a, b, c) (((uint32_t)(a) << 16) | ((uint32_t)(b) << 8) | (uint32_t)(c))
+#define NF_ID_MASK 0x00FFFFFFUL /**< Keeps the sentence type and drops the two talker characters */
+
+//NMEA sentence types from NMEA documentation; any talker (GP, GN, GL, GA, ...) matches
+#define GGA_ID NF_PACK_ID('G', 'G', 'A')
+#define GLL_ID NF_PACK_ID('G', 'L', 'L')
+#define GSA_ID NF_PACK_ID('G', 'S', 'A')
+#define GSV_ID NF_PACK_ID('G', 'S', 'V')
+#define RMC_ID NF_PACK_ID('R', 'M', 'C')
+#define VTG_ID NF_PACK_ID('V', 'T', 'G')
+#define ZDA_ID NF_PACK_ID('Z', 'D', 'A')
+#define NMEA_PROPRIETARY_CHAR 'P' /**< First ID character of proprietary sentences such as $PUBX */
+
+//global
+NF_THREAD_LOCAL nf_count_t nf_accept_count[NF_NUM_MSG_TYPES];   /**< Sentences that passed the checksum, per type */
+NF_THREAD_LOCAL nf_count_t nf_reject_count[NF_NUM_MSG_TYPES];   /**< Sentences dropped for a bad or missing checksum, per type */
+NF_THREAD_LOCAL nf_sat_table_t nf_sat_table;                     /**< Satellites in view, from GSV and GSA */
+
+/**
+ * @brief One entry of the sentence dispatch table.
+ */
+typedef struct {
+	uint32_t id;                 /**< Packed sentence type, see NF_PACK_ID() */
+	nf_msg_type_t type;          /**< Index into the accept/reject counters */
+	boolean_t nav;               /**< Fields go to the navigation solution, which is published; false for the satellite table */
+	void (*field_handler)(void); /**< Points field_index at its staging place; 0 to skip all fields and publish nothing */
+	void (*finish_handler)(void); /**< Completes the staged fields once the checksum passed, 0 if nothing is left to do */
+} nf_sentence_entry_t;
+
+/**
+ * @brief Numeric fields converted to integers while their digits arrive.
+ */
+typedef enum {
+	NF_NUM_NONE,     /**< Field is not converted */
+	NF_NUM_LAT,      /**< ddmm.mmmmm latitude to microdegrees */
+	NF_NUM_LONG,     /**< dddmm.mmmmm longitude to microdegrees */
+	NF_NUM_ALTITUDE, /**< Signed metres with one decimal to decimetres */
+	NF_NUM_COURSE,   /**< Degrees with two decimals to hundredths, NF_COURSE_UNKNOWN if empty */
+	NF_NUM_BYTE,     /**< Whole number to the uint8_t at num_dest, saturating */
+	NF_NUM_WORD      /**< Whole number to the uint16_t at num_dest */
+} nf_numeric_field_t;
+
+/**
+ * @brief States of the streaming NMEA parser.
+ */
+typedef enum {
+	NF_WAIT_START, /**< Discarding characters until the next '$' */
+	NF_MSG_ID,     /**< Reading the talker and sentence ID */
+	NF_FIELDS,     /**< Reading comma separated data fields */
+	NF_CHECKSUM,   /**< Reading the two hex digits after the '*' */
+	NF_END         /**< Waiting for the terminating <CR><LF> */
+} nf_parse_state_t;
+
+//local static
+static NF_THREAD_LOCAL nf_parse_state_t parse_state;              /**< Current parser state */
+static NF_THREAD_LOCAL nf_sentence_entry_t active_sentence;       /**< Dispatch entry of the sentence being parsed */
+static NF_THREAD_LOCAL uint32_t nmea_msg_id;                      /**< Message ID characters packed as they arrive */
+static NF_THREAD_LOCAL char nmea_msg_id_first;                    /**< First message ID character, 'P' for proprietary */
+static NF_THREAD_LOCAL uint8_t running_checksum;                  /**< XOR of every character between '$' and '*' */
+static NF_THREAD_LOCAL uint8_t received_checksum;                 /**< Value of the "*hh" field */
+static NF_THREAD_LOCAL uint8_t sentence_length;                   /**< Characters received since the '$' */
+static NF_THREAD_LOCAL uint8_t field_index;                       /**< Index of the field being received */
+static NF_THREAD_LOCAL uint8_t field_offset;                      /**< Characters stored in the current field */
+static NF_THREAD_LOCAL char* field_dest;                          /**< Staging buffer of the current field, 0 if skipped */
+static NF_THREAD_LOCAL uint8_t field_size;                        /**< Size of the current staging buffer */
+static NF_THREAD_LOCAL nf_numeric_field_t numeric_field;          /**< Conversion applied to the current field */
+static NF_THREAD_LOCAL uint32_t num_whole;                        /**< Digits before the decimal point */
+static NF_THREAD_LOCAL uint32_t num_frac;                         /**< Digits after the decimal point */
+static NF_THREAD_LOCAL uint8_t num_frac_digits;                   /**< Number of digits in num_frac */
+static NF_THREAD_LOCAL uint8_t num_frac_max;                      /**< Fractional digits kept for this field */
+static NF_THREAD_LOCAL boolean_t num_in_frac;                     /**< Decimal point seen */
+static NF_THREAD_LOCAL boolean_t num_negative;                    /**< Leading '-' seen */
+static NF_THREAD_LOCAL boolean_t num_digits;                      /**< At least one digit seen */
+static NF_THREAD_LOCAL void* num_dest;                            /**< Target of NF_NUM_BYTE and NF_NUM_WORD fields */
+
+//navigation solution; sentences are parsed into the back buffer, which becomes the front buffer once its checksum passes
+static NF_THREAD_LOCAL nav_solution_t nav_buffers[2];            /**< Front and back buffer */
+static NF_THREAD_LOCAL volatile uint8_t nav_front;               /**< Index of the front buffer; one byte, so the flip is atomic */
+static NF_THREAD_LOCAL int32_t stage_latitude_udeg;              /**< Unsigned latitude until the N/S field is known */
+static NF_THREAD_LOCAL char stage_ns_indicator[GGA_INDICATOR_SIZE];
+static NF_THREAD_LOCAL int32_t stage_longitude_udeg;             /**< Unsigned longitude until the E/W field is known */
+static NF_THREAD_LOCAL char stage_ew_indicator[GGA_INDICATOR_SIZE];
+static NF_THREAD_LOCAL void (*publish_callback)(nf_msg_type_t type); /**< Called after each published sentence, 0 for none */
+
+//satellite table; a GSV message is staged and only copied into nf_sat_table once its checksum passes
+static NF_THREAD_LOCAL nf_sat_t gsv_stage[GSV_SATS_PER_MSG];      /**< Satellites of the GSV being parsed */
+static NF_THREAD_LOCAL uint8_t gsv_total;                         /**< Messages in the burst of the GSV being parsed */
+static NF_THREAD_LOCAL uint8_t gsv_number;                        /**< Number of the GSV being parsed, from 1 */
+static NF_THREAD_LOCAL uint8_t gsv_in_view;                       /**< Satellites in view of the talker of the GSV being parsed */
+static NF_THREAD_LOCAL uint8_t gsv_sat;                           /**< Satellite group of the current field */
+static NF_THREAD_LOCAL uint8_t gsv_part;                          /**< Field within the satellite group */
+static NF_THREAD_LOCAL uint8_t gsa_stage[GSA_PRN_FIELDS];         /**< PRNs of the GSA being parsed, 0 for empty fields */
+static NF_THREAD_LOCAL uint8_t sat_used_prns[NF_SAT_MAX];         /**< PRNs used in the fix, from the GSAs of this epoch */
+static NF_THREAD_LOCAL uint8_t sat_used_count;                    /**< Entries in sat_used_prns */
+static NF_THREAD_LOCAL uint8_t sat_burst_base;                    /**< Table index of the current burst's first satellite */
+static NF_THREAD_LOCAL uint8_t sat_next;                          /**< Table index the next burst starts at */
+static NF_THREAD_LOCAL uint8_t sat_in_view;                       /**< Satellites in view of the bursts completed this epoch */
+static NF_THREAD_LOCAL boolean_t sat_gsv_epoch;                   /**< A GGA arrived; the next burst restarts the table */
+static NF_THREAD_LOCAL boolean_t sat_gsa_epoch;                   /**< A GGA arrived; the next GSA restarts the used list */
+
+
+//function definitions
+
+/**
+ * @brief The buffer the parser is filling.
+ */
+static inline nav_solution_t* nf_nav_back(){
+	return &nav_buffers[nav_front ^ 1];
+}
+
+/**
+ * @brief Blank the navigation solution, clear the counters and wait for the next '$'.
+ */
+void nf_parse_reset(){
+	memset(&nav_buffers[0], ' ', sizeof(nav_solution_t)); //strings read as blank
+	nav_buffers[0].latitude_udeg = 0;
+	nav_buffers[0].longitude_udeg = 0;
+	nav_buffers[0].msl_altitude_dm = 0;
+	nav_buffers[0].course_cdeg = NF_COURSE_UNKNOWN;
+	nav_buffers[1] = nav_buffers[0];
+	nav_front = 0;
+
+	memset(&nf_sat_table, 0, sizeof(nf_sat_table));
+	sat_used_count = 0;
+	sat_next = 0;
+	sat_in_view = 0;
+	sat_gsv_epoch = false;
+	sat_gsa_epoch = false;
+
+	parse_state = NF_WAIT_START;
+	memset(nf_accept_count, 0, sizeof(nf_accept_count));
+	memset(nf_reject_count, 0, sizeof(nf_reject_count));
+}
+
+/**
+ * @brief Drop the sentence being parsed and ignore everything up to the next '$'.
+ * Unlike nf_parse_reset() the navigation solution and the counters are kept.
+ */
+void nf_parse_resync(){
+	parse_state = NF_WAIT_START;
+}
+
+/**
+ * @brief Point the current field at its place in the back buffer.
+ * @param dest Where the field's characters go; blank padded when the field ends.
+ * @param size Characters available; longer fields are truncated.
+ */
+static void nf_stage(char* dest, uint8_t size){
+	field_dest = dest;
+	field_size = size;
+}
+
+/**
+ * @brief Convert the current field to an integer as its digits arrive.
+ * @param field Conversion to apply when the field ends.
+ * @param frac_max Number of fractional digits to keep; further digits are ignored.
+ */
+static void nf_stage_numeric(nf_numeric_field_t field, uint8_t frac_max){
+	numeric_field = field;
+	num_frac_max = frac_max;
+	num_whole = 0;
+	num_frac = 0;
+	num_frac_digits = 0;
+	num_in_frac = false;
+	num_negative = false;
+	num_digits = false;
+}
+
+/**
+ * @brief Convert the current field to an unsigned integer; an empty field gives 0.
+ * @param field NF_NUM_BYTE or NF_NUM_WORD.
+ * @param dest The uint8_t or uint16_t written when the field ends.
+ */
+static void nf_stage_integer(nf_numeric_field_t field, void* dest){
+	nf_stage_numeric(field, 0);
+	num_dest = dest;
+}
+
+/**
+ * @brief Fold one character of a numeric field into the running integer.
+ * @param c The received character.
+ */
+static void nf_accumulate_digit(char c){
+	if ((c >= '0') && (c <= '9')){
+		num_digits = true;
+		if (!num_in_frac){
+			num_whole = (num_whole * 10) + (c - '0');
+		} else if (num_frac_digits < num_frac_max){
+			num_frac = (num_frac * 10) + (c - '0');
+			num_frac_digits++;
+		}
+	} else if (c == '.'){
+		num_in_frac = true;
+	} else if (c == '-'){
+		num_negative = true;
+	}
+}
+
+/**
+ * @brief Scale the accumulated number to a fixed count of fractional digits.
+ * @return The number as an integer in units of 10^-num_frac_max.
+ */
+static uint32_t nf_scaled_number(){
+	uint32_t value = num_whole;
+	for (uint8_t i = 0; i < num_frac_max; i++){
+		value *= 10;
+	}
+	while (num_frac_digits < num_frac_max){ //"12.3" with 5 kept digits is 12.30000
+		num_frac *= 10;
+		num_frac_digits++;
+	}
+	return value + num_frac;
+}
+
+/**
+ * @brief Finish the field that just ended: blank pad its characters and complete its numeric conversion.
+ * ddmm.mmmmm is split into whole degrees and minutes in units of 1e-5;
+ * 1e-5 minutes is 1/6 microdegree, so one rounded division by 6 gives microdegrees.
+ */
+static void nf_end_field(){
+	uint32_t minutes_e5;
+	uint32_t degrees;
+
+	while (field_offset < field_size){ //short or empty fields read as blanks
+		field_dest[field_offset++] = ' ';
+	}
+	switch (numeric_field){
+		case NF_NUM_LAT:
+		case NF_NUM_LONG:
+			degrees = num_whole / 100;
+			num_whole -= degrees * 100; //whole minutes
+			minutes_e5 = nf_scaled_number();
+			if (numeric_field == NF_NUM_LAT){
+				stage_latitude_udeg = (int32_t)((degrees * UDEG_PER_DEG) + ((minutes_e5 + 3) / 6));
+			} else {
+				stage_longitude_udeg = (int32_t)((degrees * UDEG_PER_DEG) + ((minutes_e5 + 3) / 6));
+			}
+			break;
+		case NF_NUM_ALTITUDE:
+			nf_nav_back()->msl_altitude_dm = num_negative ? -(int32_t)nf_scaled_number() : (int32_t)nf_scaled_number();
+			break;
+		case NF_NUM_COURSE:
+			nf_nav_back()->course_cdeg = num_digits ? (uint16_t)(nf_scaled_number() % NF_CDEG_PER_TURN) : NF_COURSE_UNKNOWN;
+			break;
+		case NF_NUM_BYTE:
+			*(uint8_t*)num_dest = (num_whole > UINT8_MAX) ? UINT8_MAX : (uint8_t)num_whole;
+			break;
+		case NF_NUM_WORD:
+			*(uint16_t*)num_dest = (uint16_t)num_whole;
+			break;
+		default:
+			break;
+	}
+	numeric_field = NF_NUM_NONE;
+}
+
+/**
+ * @brief Field handler for GGA: time, position, fix quality, satellites, HDOP and altitude.
+ */
+static void nf_gga_field(){
+	nav_solution_t* nav = nf_nav_back();
+
+	switch (field_index){
+		case GGA_UTC_FIELD:
+			nf_stage(nav->utc_time, GGA_UTC_BUFFER_SIZE);
+			break;
+		case GGA_LAT_FIELD:
+			nf_stage_numeric(NF_NUM_LAT, NMEA_MINUTE_FRAC_DIGITS);
+			break;
+		case GGA_NS_FIELD:
+			nf_stage(stage_ns_indicator, GGA_INDICATOR_SIZE);
+			break;
+		case GGA_LONG_FIELD:
+			nf_stage_numeric(NF_NUM_LONG, NMEA_MINUTE_FRAC_DIGITS);
+			break;
+		case GGA_EW_FIELD:
+			nf_stage(stage_ew_indicator, GGA_INDICATOR_SIZE);
+			break;
+		case GGA_FIX_FIELD:
+			nf_stage(nav->position_fix_indicator, GGA_INDICATOR_SIZE);
+			break;
+		case GGA_SV_USD_FIELD:
+			nf_stage(nav->satellites_used, GGA_SV_USD_BUFFER_SIZE);
+			break;
+		case GGA_HDOP_FIELD:
+			nf_stage(nav->hdop, GGA_HDOP_BUFFER_SIZE);
+			break;
+		case GGA_ALTITUDE_FIELD:
+			nf_stage(nav->msl_altitude, GGA_ALTITUDE_BUFFER_SIZE);
+			nf_stage_numeric(NF_NUM_ALTITUDE, NMEA_ALTITUDE_FRAC_DIGITS);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Finish handler for GGA: sign the position and format it.
+ */
+static void nf_gga_finish(){
+	nav_solution_t* nav = nf_nav_back();
+
+	nav->latitude_udeg = (stage_ns_indicator[0] == 'S') ? -stage_latitude_udeg : stage_latitude_udeg;
+	nav->longitude_udeg = (stage_ew_indicator[0] == 'W') ? -stage_longitude_udeg : stage_longitude_udeg;
+	convertNMEAtoLLA(nav);
+	sat_gsv_epoch = true;
+	sat_gsa_epoch = true;
+}
+
+/**
+ * @brief Field handler for VTG: course and speed over ground in km/hr.
+ */
+static void nf_vtg_field(){
+	if (field_index == VTG_COURSE_FIELD){
+		nf_stage_numeric(NF_NUM_COURSE, NMEA_COURSE_FRAC_DIGITS);
+	} else if (field_index == VTG_SPEED_FIELD){
+		nf_stage(nf_nav_back()->speed, VTG_SPEED_BUFER_SIZE);
+	}
+}
+
+/**
+ * @brief Field handler for RMC: the UTC time and the course over ground.
+ */
+static void nf_rmc_field(){
+	if (field_index == RMC_ZDA_UTC_FIELD){
+		nf_stage(nf_nav_back()->utc_time, GGA_UTC_BUFFER_SIZE);
+	} else if (field_index == RMC_COURSE_FIELD){
+		nf_stage_numeric(NF_NUM_COURSE, NMEA_COURSE_FRAC_DIGITS);
+	}
+}
+
+/**
+ * @brief Field handler for ZDA: the UTC time.
+ */
+static void nf_utc_field(){
+	if (field_index == RMC_ZDA_UTC_FIELD){
+		nf_stage(nf_nav_back()->utc_time, GGA_UTC_BUFFER_SIZE);
+	}
+}
+
+/**
+ * @brief Field handler for GLL: the UTC time.
+ */
+static void nf_gll_field(){
+	if (field_index == GLL_UTC_FIELD){
+		nf_stage(nf_nav_back()->utc_time, GGA_UTC_BUFFER_SIZE);
+	}
+}
+
+/**
+ * @brief Whether a satellite is listed in the GSAs of the current epoch.
+ * @param prn Satellite number; 0 is never used.
+ */
+static boolean_t nf_sat_used(uint8_t prn){
+	for (uint8_t i = 0; i < sat_used_count; i++){
+		if (sat_used_prns[i] == prn){
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Field handler for GSV: burst position, then four groups of PRN, elevation, azimuth and SNR.
+ * Fields go straight to integers, so a burst costs no more per byte than the GGA position fields.
+ */
+static void nf_gsv_field(){
+	nf_sat_t* sat;
+
+	switch (field_index){
+		case GSV_TOTAL_FIELD:
+			memset(gsv_stage, 0, sizeof(gsv_stage)); //satellites with empty fields read as not tracked
+			gsv_sat = 0;
+			gsv_part = 0;
+			nf_stage_integer(NF_NUM_BYTE, &gsv_total);
+			break;
+		case GSV_NUMBER_FIELD:
+			nf_stage_integer(NF_NUM_BYTE, &gsv_number);
+			break;
+		case GSV_IN_VIEW_FIELD:
+			nf_stage_integer(NF_NUM_BYTE, &gsv_in_view);
+			break;
+		default:
+			if (gsv_sat >= GSV_SATS_PER_MSG){ //NMEA 4.10 signal ID
+				break;
+			}
+			sat = &gsv_stage[gsv_sat];
+			switch (gsv_part){
+				case 0:
+					nf_stage_integer(NF_NUM_BYTE, &sat->prn);
+					break;
+				case 1:
+					nf_stage_integer(NF_NUM_BYTE, &sat->elevation);
+					break;
+				case 2:
+					nf_stage_integer(NF_NUM_WORD, &sat->azimuth);
+					break;
+				default:
+					nf_stage_integer(NF_NUM_BYTE, &sat->snr);
+					break;
+			}
+			if (++gsv_part == GSV_SAT_FIELDS){
+				gsv_part = 0;
+				gsv_sat++;
+			}
+			break;
+	}
+}
+
+/**
+ * @brief Finish handler for GSV: copy the staged satellites to their place in nf_sat_table.
+ * Each talker (GP, GL, GA, ...) sends its own burst; the bursts after a GGA fill the table one
+ * after the other, and count and in_view change when a burst's last message arrives. A burst
+ * whose first message was lost lands where that talker's burst did in the previous epoch.
+ */
+static void nf_gsv_finish(){
+	uint16_t first = (uint16_t)(gsv_number - 1) * GSV_SATS_PER_MSG; //satellites in the burst before this message
+	uint16_t index;
+	nf_sat_t* sat;
+
+	if ((gsv_number == 0) || (gsv_number > gsv_total)){
+		return;
+	}
+	if (gsv_number == 1){
+		if (sat_gsv_epoch){
+			sat_gsv_epoch = false;
+			sat_next = 0;
+			sat_in_view = 0;
+		}
+		sat_burst_base = sat_next;
+	}
+	for (uint8_t i = 0; (i < GSV_SATS_PER_MSG) && (first + i < gsv_in_view); i++){ //the last message may carry fewer
+		index = sat_burst_base + first + i;
+		if (index >= NF_SAT_MAX){
+			break;
+		}
+		sat = &nf_sat_table.sats[index];
+		*sat = gsv_stage[i];
+		sat->used = nf_sat_used(sat->prn);
+	}
+	if (gsv_number == gsv_total){
+		index = sat_burst_base + gsv_in_view;
+		sat_next = (index > NF_SAT_MAX) ? NF_SAT_MAX : (uint8_t)index;
+		sat_in_view = ((uint16_t)sat_in_view + gsv_in_view > UINT8_MAX) ? UINT8_MAX : sat_in_view + gsv_in_view;
+		nf_sat_table.count = sat_next;
+		nf_sat_table.in_view = sat_in_view;
+	}
+}
+
+/**
+ * @brief Field handler for GSA: the PRNs used in the fix.
+ */
+static void nf_gsa_field(){
+	uint8_t slot = field_index - GSA_FIRST_PRN_FIELD;
+
+	if (field_index == 1){
+		memset(gsa_stage, 0, sizeof(gsa_stage));
+	} else if (slot < GSA_PRN_FIELDS){ //unsigned, so this also skips the fix type field
+		nf_stage_integer(NF_NUM_BYTE, &gsa_stage[slot]);
+	}
+}
+
+/**
+ * @brief Finish handler for GSA: add the used PRNs to this epoch's list and mark them in the table.
+ * Multi-GNSS receivers send one GSA per constellation, so only the first after a GGA restarts the list.
+ */
+static void nf_gsa_finish(){
+	if (sat_gsa_epoch){
+		sat_gsa_epoch = false;
+		sat_used_count = 0;
+	}
+	for (uint8_t i = 0; i < GSA_PRN_FIELDS; i++){
+		if (gsa_stage[i] && (sat_used_count < NF_SAT_MAX) && !nf_sat_used(gsa_stage[i])){
+			sat_used_prns[sat_used_count++] = gsa_stage[i];
+		}
+	}
+	for (uint8_t i = 0; i < nf_sat_table.count; i++){
+		nf_sat_table.sats[i].used = nf_sat_used(nf_sat_table.sats[i].prn);
+	}
+}
+
+/**
+ * @brief Sentence dispatch table, keyed on the packed sentence type with the talker ID ignored.
+ */
+static const nf_sentence_entry_t nf_sentence_table[] PROGMEM = {
+	{GGA_ID, NF_MSG_GGA, true, nf_gga_field, nf_gga_finish},
+	{VTG_ID, NF_MSG_VTG, true, nf_vtg_field, 0},
+	{RMC_ID, NF_MSG_RMC, true, nf_rmc_field, 0},
+	{GSA_ID, NF_MSG_GSA, false, nf_gsa_field, nf_gsa_finish},
+	{GSV_ID, NF_MSG_GSV, false, nf_gsv_field, nf_gsv_finish},
+	{GLL_ID, NF_MSG_GLL, true, nf_gll_field, 0},
+	{ZDA_ID, NF_MSG_ZDA, true, nf_utc_field, 0},
+};
+
+/**
+ * @brief Load the dispatch entry for a packed sentence ID into active_sentence.
+ * Unknown IDs get the NF_MSG_OTHER entry, whose fields are all skipped.
+ * @param id Packed sentence type, see NF_PACK_ID().
+ */
+static void nf_dispatch(uint32_t id){
+	for (uint8_t i = 0; i < sizeof(nf_sentence_table) / sizeof(nf_sentence_table[0]); i++){
+		if (pgm_read_dword(&nf_sentence_table[i].id) == id){
+			memcpy_P(&active_sentence, &nf_sentence_table[i], sizeof(nf_sentence_entry_t));
+			return;
+		}
+	}
+	memset(&active_sentence, 0, sizeof(nf_sentence_entry_t)); //NF_MSG_OTHER, no handlers
+}
+
+/**
+ * @brief Reset per-field state and let the active sentence's handler pick a staging buffer.
+ * Fields without a staging buffer are skipped byte by byte.
+ */
+static void nf_begin_field(){
+	field_dest = 0;
+	field_size = 0;
+	field_offset = 0;
+	numeric_field = NF_NUM_NONE;
+	if (active_sentence.field_handler){
+		active_sentence.field_handler();
+	}
+}
+
+/**
+ * @brief Convert one ASCII hex digit of the checksum field to its value.
+ * @param c The character to convert.
+ * @return 0-15, or -1 if the character is not a hex digit.
+ */
+static int8_t nf_hex_value(char c){
+	if ((c >= '0') && (c <= '9')){
+		return c - '0';
+	}
+	if ((c >= 'A') && (c <= 'F')){
+		return c - 'A' + 10;
+	}
+	if ((c >= 'a') && (c <= 'f')){
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+/**
+ * @brief Drop the sentence being parsed and count it against its type.
+ * Only the back buffer was written, so the published solution keeps the last good values.
+ */
+static void nf_reject_msg(){
+	if (parse_state > NF_MSG_ID){
+		nf_reject_count[active_sentence.type]++;
+	}
+	parse_state = NF_WAIT_START;
+}
+
+/**
+ * @brief One parser step; inlined into the nf_parse_source() loop for host throughput.
+ * Never blocks; fields are staged as they arrive and the XOR checksum is accumulated on the fly.
+ * A sentence is only published once its terminating "*hh<CR><LF>" has been seen and the
+ * checksum matches; anything else is counted in nf_reject_count and dropped.
+ * @param c The received character.
+ * @return true if this character completed a valid GGA or VTG sentence.
+ */
+static inline boolean_t nf_parse_step(char c){
+	int8_t nibble;
+
+	//'$' always starts a new sentence, even in the middle of a broken one
+	if (c == '$'){
+		if (parse_state != NF_WAIT_START){
+			nf_reject_msg();
+		}
+		parse_state = NF_MSG_ID;
+		sentence_length = 1;
+		field_offset = 0;
+		running_checksum = 0;
+		return false;
+	}
+	if (parse_state == NF_WAIT_START){
+		return false;
+	}
+	//only sentences with staged fields are held to the limit; skipped ones such as the 109 byte
+	//$PUBX,00 run on to their checksum, and one that lost its terminator is dropped at the next '$'
+	if ((++sentence_length > NMEA_MAX_SENTENCE_SIZE) && (active_sentence.type != NF_MSG_OTHER)){
+		nf_reject_msg(); //lost the terminator; resync on next '$'
+		return false;
+	}
+
+	switch (parse_state){
+		case NF_MSG_ID:
+			if (c == '*'){ //no fields, e.g. "$PMTK000*32"; counted as OTHER
+				memset(&active_sentence, 0, sizeof(nf_sentence_entry_t));
+				field_offset = 0;
+				received_checksum = 0;
+				parse_state = NF_CHECKSUM;
+				break;
+			}
+			running_checksum ^= c;
+			if (c == ','){
+				//"ttSSS": talker ignored, one integer compare per table entry
+				if ((field_offset == NMEA_MSG_ID_SIZE) && (nmea_msg_id_first != NMEA_PROPRIETARY_CHAR)){
+					nf_dispatch(nmea_msg_id & NF_ID_MASK);
+					if (active_sentence.nav){
+						nf_nav_begin(); //fields the sentence does not carry keep their published values
+					}
+				} else { //proprietary or non-standard ID; checksum counted, fields skipped
+					memset(&active_sentence, 0, sizeof(nf_sentence_entry_t));
+				}
+				field_index = 1;
+				nf_begin_field();
+				parse_state = NF_FIELDS;
+			} else if ((c == '\r') || (c == '\n')){
+				parse_state = NF_WAIT_START;
+			} else if (field_offset < NMEA_MSG_ID_SIZE){
+				if (field_offset++ == 0){
+					nmea_msg_id_first = c;
+				}
+				nmea_msg_id = (nmea_msg_id << 8) | (uint8_t)c;
+			} else {
+				field_offset = NMEA_MSG_ID_SIZE + 1; //longer IDs such as $PMTK001 are parsed as OTHER
+			}
+			break;
+
+		case NF_FIELDS:
+			if (c == '*'){
+				nf_end_field();
+				field_offset = 0;
+				received_checksum = 0;
+				parse_state = NF_CHECKSUM;
+				break;
+			}
+			running_checksum ^= c;
+			if (c == ','){
+				nf_end_field();
+				field_index++;
+				nf_begin_field();
+			} else if ((c == '\r') || (c == '\n')){
+				nf_reject_msg(); //checksum is mandatory
+			} else {
+				if (field_offset < field_size){
+					field_dest[field_offset++] = c;
+				}
+				if (numeric_field != NF_NUM_NONE){
+					nf_accumulate_digit(c);
+				}
+			}
+			break;
+
+		case NF_CHECKSUM:
+			nibble = nf_hex_value(c);
+			if (nibble < 0){
+				nf_reject_msg();
+				break;
+			}
+			received_checksum = (received_checksum << 4) | nibble;
+			if (++field_offset >= NMEA_CHECKSUM_SIZE){
+				parse_state = NF_END;
+			}
+			break;
+
+		case NF_END:
+			if (c == '\n'){
+				if (received_checksum != running_checksum){
+					nf_reject_msg();
+					break;
+				}
+				parse_state = NF_WAIT_START;
+				nf_accept_count[active_sentence.type]++;
+				if (active_sentence.finish_handler){
+					active_sentence.finish_handler();
+				}
+				if (active_sentence.nav){
+					nf_nav_commit();
+					if (publish_callback){
+						publish_callback(active_sentence.type);
+					}
+					return true;
+				}
+			} else if (c != '\r'){
+				nf_reject_msg();
+			}
+			break;
+
+		default:
+			parse_state = NF_WAIT_START;
+			break;
+	}
+	return false;
+}
+
+/**
+ * @brief Advance the NMEA parser by one received character.
+ * @param c The received character.
+ * @return true if this character completed a sentence that updated the navigation solution.
+ */
+boolean_t nf_parse_char(char c){
+	return nf_parse_step(c);
+}
+
+/**
+ * @brief Run a whole received sentence through the NMEA parser.
+ * @param sentence Characters from the '$' to the '\n', not terminated.
+ * @param length Number of characters.
+ * @return true if the sentence updated the navigation solution.
+ */
+boolean_t nf_parse_sentence(const char* sentence, uint8_t length){
+	boolean_t published = false;
+
+	for (uint8_t i = 0; i < length; i++){
+		if (nf_parse_step(sentence[i])){
+			published = true;
+		}
+	}
+	return published;
+}
+
+/**
+ * @brief Feed every byte a source has available to the NMEA parser.
+ * @param source Where the bytes come from.
+ * @return true if at least one sentence was published.
+ */
+boolean_t nf_parse_source(const nf_byte_source_t* source){
+	boolean_t published = false;
+	uint8_t block[NF_PARSE_BLOCK_SIZE];
+	uint16_t count;
+
+	while ((count = source->read(source->ctx, block, sizeof(block))) > 0){
+		for (uint16_t i = 0; i < count; i++){
+			if (nf_parse_step((char)block[i])){
+				published = true;
+			}
+		}
+	}
+	return published;
+}
+
+/**
+ * @brief Register a function to be called after every published sentence.
+ * @param callback Called with the sentence type once nf_nav_solution() holds its fields; 0 to remove.
+ */
+void nf_set_publish_callback(void (*callback)(nf_msg_type_t type)){
+	publish_callback = callback;
+}
+
+/**
+ * @brief Format a microdegree value as a signed decimal degree string, e.g. "+037.38746".
+ * @param udeg Value in microdegrees.
+ * @param str Output buffer of at least int_digits + LLA_FRAC_DIGITS + 2 characters.
+ * @param int_digits Number of whole degree digits (2 for latitude, 3 for longitude).
+ */
+void nf_format_udeg(int32_t udeg, char* str, uint8_t int_digits){
+	uint32_t value;
+
+	if (udeg < 0){
+		str[0] = '-';
+		value = (uint32_t)(-udeg);
+	} else {
+		str[0] = '+';
+		value = (uint32_t)udeg;
+	}
+	value = (value + 5) / 10; //round to the 1e-5 degrees shown
+
+	//fill from the last digit back, skipping over the decimal point
+	uint8_t pos = int_digits + LLA_FRAC_DIGITS + 1;
+	while (pos > 0){
+		if (pos == int_digits + 1){
+			str[pos] = '.';
+		} else {
+			str[pos] = '0' + (value % 10);
+			value /= 10;
+		}
+		pos--;
+	}
+}
+
+/**
+ * @brief Convert NMEA format coordinates to Latitude, Longitude, and Altitude (LLA) format.
+ * The coordinates were already converted to microdegrees while they were parsed; this only
+ * formats the display strings.
+ * @param nav Solution being filled, between nf_nav_begin() and nf_nav_commit().
+ */
+void convertNMEAtoLLA(nav_solution_t* nav) {
+	nf_format_udeg(nav->latitude_udeg, nav->latitudeLLA_str, 2);
+	nf_format_udeg(nav->longitude_udeg, nav->longitudeLLA_str, 3);
+}
+
+/**
+ * @brief Start filling the back buffer from the current solution.
+ * Fields the new data does not carry keep their published values.
+ * @return The back buffer; readers do not see it until nf_nav_commit().
+ */
+nav_solution_t* nf_nav_begin(){
+	nav_solution_t* back = nf_nav_back();
+
+	*back = nav_buffers[nav_front];
+	return back;
+}
+
+/**
+ * @brief Publish the back buffer by flipping the front index.
+ */
+void nf_nav_commit(){
+	__asm__ __volatile__("" ::: "memory"); //every write to the back buffer lands before the flip
+	nav_front ^= 1;
+}
+
+/**
+ * @brief The last published navigation solution.
+ * Fields always belong to the same sentence. The buffer stays unchanged until the parser
+ * publishes again, so a reader in the main loop should take the pointer once and not poll the
+ * parser while using it; an interrupt always sees a complete solution.
+ */
+const nav_solution_t* nf_nav_solution(){
+	return &nav_buffers[nav_front];
+}
+
+/**
+ * @brief Check if a navigation solution holds a position fix.
+ * @param nav Navigation solution.
+ * @return true for GGA fix qualities '1' to '8' except '6', dead reckoning.
+ */
+boolean_t nf_nav_has_fix(const nav_solution_t* nav){
+	char quality = nav->position_fix_indicator[0];
+
+	return (quality >= '1') && (quality <= '8') && (quality != '6');
+}
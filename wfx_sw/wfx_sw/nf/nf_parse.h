@@ -0,0 +1,105 @@
+/**
+ * @file nf_parse.h
+ * @brief Header file for the streaming NMEA parser of the navigation fetch (NF) CSC.
+ *
+ * This file provides declarations for the UART independent part of NF. Bytes reach the parser
+ * through an nf_byte_source_t, so the same code parses the receiver's UART on the device and
+ * recorded NMEA logs on a host.
+ */
+
+#ifndef NF_PARSE_H_
+#define NF_PARSE_H_
+
+#include "../ut/ut_types.h"
+#include "nf_types.h"
+
+#define NF_PARSE_BLOCK_SIZE 64 /**< Bytes requested from a byte source per read */
+
+/**
+ * @brief A source of received bytes for nf_parse_source().
+ */
+typedef struct {
+	uint16_t (*read)(void* ctx, uint8_t* buf, uint16_t size); /**< Copy up to size bytes to buf, return the count; 0 if none are available now */
+	void* ctx; /**< Passed to read */
+} nf_byte_source_t;
+
+/**
+ * @brief Blank the navigation solution, clear the counters and wait for the next '$'.
+ */
+void nf_parse_reset();
+
+/**
+ * @brief Drop the sentence being parsed and ignore everything up to the next '$'.
+ * The navigation solution and the counters are kept.
+ */
+void nf_parse_resync();
+
+/**
+ * @brief Advance the NMEA parser by one received character. Never blocks.
+ * @param c The received character.
+ * @return true if this character completed a sentence that updated the navigation solution.
+ */
+boolean_t nf_parse_char(char c);
+
+/**
+ * @brief Run a whole received sentence through the NMEA parser.
+ * @param sentence Characters from the '$' to the '\n', not terminated.
+ * @param length Number of characters.
+ * @return true if the sentence updated the navigation solution.
+ */
+boolean_t nf_parse_sentence(const char* sentence, uint8_t length);
+
+/**
+ * @brief Feed every byte a source has available to the NMEA parser.
+ * @param source Where the bytes come from.
+ * @return true if at least one sentence was published.
+ */
+boolean_t nf_parse_source(const nf_byte_source_t* source);
+
+/**
+ * @brief Register a function to be called after every published sentence.
+ * @param callback Called with the sentence type once nf_nav_solution() holds its fields; 0 to remove.
+ */
+void nf_set_publish_callback(void (*callback)(nf_msg_type_t type));
+
+/**
+ * @brief Format a microdegree value as a signed decimal degree string, e.g. "+037.38746".
+ * @param udeg Value in microdegrees.
+ * @param str Output buffer of at least int_digits + 7 characters: sign, point and five decimals.
+ * @param int_digits Number of whole degree digits (2 for latitude, 3 for longitude).
+ */
+void nf_format_udeg(int32_t udeg, char* str, uint8_t int_digits);
+
+/**
+ * @brief Convert NMEA format coordinates to Latitude, Longitude, and Altitude (LLA) format.
+ * @param nav Solution being filled, between nf_nav_begin() and nf_nav_commit().
+ */
+void convertNMEAtoLLA(nav_solution_t* nav);
+
+/**
+ * @brief Start filling the back buffer, initialised from the current solution.
+ * @return The back buffer; readers do not see it until nf_nav_commit().
+ */
+nav_solution_t* nf_nav_begin();
+
+/**
+ * @brief Publish the back buffer filled since nf_nav_begin().
+ */
+void nf_nav_commit();
+
+/**
+ * @brief The last published navigation solution; all its fields belong to the same update.
+ * The buffer is not written until the parser publishes again, so main loop readers take the
+ * pointer once per use and do not poll the parser in between.
+ */
+const nav_solution_t* nf_nav_solution();
+
+/**
+ * @brief Check if a navigation solution holds a position fix.
+ * @param nav Navigation solution.
+ * @return true for GGA fix qualities '1' to '8' (GPS, DGPS, PPS, RTK, float RTK, manual,
+ * simulation) except '6', dead reckoning, which is no measured position.
+ */
+boolean_t nf_nav_has_fix(const nav_solution_t* nav);
+
+#endif /* NF_PARSE_H_ */
@@ -9,6 +9,8 @@
 #ifndef NF_TYPES_H_
 #define NF_TYPES_H_
 
+#include "../ut/ut_types.h"
+
 #define GGA_INDICATOR_SIZE 1 /**< Size of the N/S and E/W indicators in the GGA message */
 
 #define LLA_LONG_BUFFER_SIZE 10 /**< Size of the buffer for storing longitude in LLA format */
@@ -21,31 +23,95 @@
 #define GGA_LONG_BUFFER_SIZE 11 /**< Size of the buffer for storing longitude in the GGA message */
 #define GGA_SV_USD_BUFFER_SIZE 2 /**< Size of the buffer for storing satellites used in the GGA message */
 #define GGA_HDOP_BUFFER_SIZE 3 /**< Size of the buffer for storing HDOP in the GGA message */
-#define GGA_NUM_INDICATORS_ACTIVE 3 /**< Number of active indicators in the GGA message */
-#define GGA_NUM_ITEMS_ACTIVE 8 /**< Number of active items in the GGA message */
 #define GGA_ALTITUDE_BUFFER_SIZE 7 /**< Size of the buffer for storing altitude in the GGA message */
 #define VTG_SPEED_BUFER_SIZE 7 /**< Size of the buffer for storing speed in the VTG message */
+#define NF_COURSE_UNKNOWN 0xFFFFU /**< course_cdeg while the receiver reports no course */
+#define NF_CDEG_PER_TURN 36000U /**< Hundredths of a degree in a full turn */
+
+/**
+ * @brief Sentence types the parser keeps; also indexes the accept/reject counters.
+ */
+typedef enum {
+	NF_MSG_OTHER, /**< Any sentence the firmware does not use */
+	NF_MSG_GGA,   /**< Fix data */
+	NF_MSG_VTG,   /**< Course and speed over ground */
+	NF_MSG_RMC,   /**< Recommended minimum data */
+	NF_MSG_GSA,   /**< DOP and active satellites */
+	NF_MSG_GSV,   /**< Satellites in view */
+	NF_MSG_GLL,   /**< Geographic position */
+	NF_MSG_ZDA,   /**< Time and date */
+	NF_MSG_UBX,   /**< Any UBX binary frame */
+	NF_NUM_MSG_TYPES
+} nf_msg_type_t;
+
+/**
+ * @brief Storage class of the parser state and the navigation solution it publishes. Host builds keep
+ * them per thread so tools can run one parser per worker thread.
+ */
+#ifdef __AVR__
+#define NF_THREAD_LOCAL
+#else
+#define NF_THREAD_LOCAL _Thread_local
+#endif
+
+/**
+ * @brief Sentence counter; 16 bits on the device, 32 bits for host tools reading whole log archives.
+ */
+#ifdef __AVR__
+typedef uint16_t nf_count_t;
+#else
+typedef uint32_t nf_count_t;
+#endif
 
-#define GGA_SIZE (GGA_UTC_BUFFER_SIZE + GGA_LAT_BUFFER_SIZE + GGA_LONG_BUFFER_SIZE + GGA_SV_USD_BUFFER_SIZE + GGA_HDOP_BUFFER_SIZE + GGA_NUM_INDICATORS_ACTIVE + GGA_NUM_ITEMS_ACTIVE) /**< Total size of the GGA message */
+/**
+ * @brief One navigation solution. The parser fills one copy while readers use the other, see
+ * nf_nav_solution(); numbers come first so the struct has no padding on the host either.
+ */
+typedef struct {
+	int32_t latitude_udeg; /**< Latitude in microdegrees, negative south */
+	int32_t longitude_udeg; /**< Longitude in microdegrees, negative west */
+	int32_t msl_altitude_dm; /**< Altitude above sea level in decimetres */
+	uint16_t course_cdeg; /**< Course over ground in hundredths of a degree from true north, NF_COURSE_UNKNOWN if not reported */
+	char utc_time[GGA_UTC_BUFFER_SIZE]; /**< UTC Time, e.g., "161229.487" */
+	char position_fix_indicator[GGA_INDICATOR_SIZE]; /**< Position Fix Indicator, see Table 1-4 */
+	char satellites_used[GGA_SV_USD_BUFFER_SIZE]; /**< Satellites Used, range 0 to 12 eg 07 */
+	char hdop[GGA_HDOP_BUFFER_SIZE]; /**< HDOP (Horizontal Dilution of Precision), e.g., "1.0" */
+	char msl_altitude[GGA_ALTITUDE_BUFFER_SIZE]; /**< Altitude above sea level in meters one decimal of precision. */
+	char speed[VTG_SPEED_BUFER_SIZE]; /**< Speed in km/hr */
+	char latitudeLLA_str[LLA_LAT_BUFFER_SIZE]; /**< Latitude in degrees */
+	char longitudeLLA_str[LLA_LONG_BUFFER_SIZE]; /**< Longitude in degrees */
+} nav_solution_t;
 
-extern char utc_time[GGA_UTC_BUFFER_SIZE]; /**< UTC Time, e.g., "161229.487" */
-extern char latitude[GGA_LAT_BUFFER_SIZE]; /**< Latitude, e.g., "3723.24756" */
-extern char ns_indicator[GGA_INDICATOR_SIZE]; /**< N/S Indicator, 'N' for north or 'S' for south */
-extern char longitude[GGA_LONG_BUFFER_SIZE]; /**< Longitude, e.g., "12158.34166" */
-extern char ew_indicator[GGA_INDICATOR_SIZE]; /**< E/W Indicator, 'E' for east or 'W' for west */
-extern char position_fix_indicator[GGA_INDICATOR_SIZE]; /**< Position Fix Indicator, see Table 1-4 */
-extern char satellites_used[GGA_SV_USD_BUFFER_SIZE]; /**< Satellites Used, range 0 to 12 eg 07 */
-extern char hdop[GGA_HDOP_BUFFER_SIZE]; /**< HDOP (Horizontal Dilution of Precision), e.g., "1.0" */
-extern char msl_altitude[GGA_ALTITUDE_BUFFER_SIZE]; /**< Altitude above sea level in meters one decimal of precision. */
+#define NF_SAT_MAX 12 /**< Satellites kept in nf_sat_table; further satellites in view are not stored */
 
-extern float latitudeLLA_float; /**< Latitude in degrees */
-extern float longitudeLLA_float; /**< Longitude in degrees */
-extern float altitudeLLA_float; /**< Altitude in meters */
+/**
+ * @brief One satellite in view, from GSV, with its used in fix flag from GSA.
+ */
+typedef struct {
+	uint8_t prn;       /**< Satellite number as the talker reports it; constellations may reuse numbers */
+	uint8_t elevation; /**< Degrees above the horizon */
+	uint16_t azimuth;  /**< Degrees from true north */
+	uint8_t snr;       /**< Carrier to noise ratio in dB-Hz, 0 if not tracked */
+	boolean_t used;    /**< Listed in the GSA of the current epoch */
+} nf_sat_t;
 
-extern char latitudeLLA_str[LLA_LAT_BUFFER_SIZE]; /**< Latitude in degrees */
-extern char longitudeLLA_str[LLA_LONG_BUFFER_SIZE]; /**< Longitude in degrees */
-extern char altitudeLLA_str[LLA_ALT_BUFFER_SIZE]; /**< Altitude in meters */
+/**
+ * @brief Satellites in view, rebuilt from the GSV bursts that follow each GGA.
+ * The parser runs in the main loop, so main loop readers never see a half written entry.
+ */
+typedef struct {
+	nf_sat_t sats[NF_SAT_MAX]; /**< The first count entries are valid */
+	uint8_t count;             /**< Entries in sats */
+	uint8_t in_view;           /**< Satellites in view reported by all talkers, may exceed NF_SAT_MAX */
+} nf_sat_table_t;
 
-extern char speed[VTG_SPEED_BUFER_SIZE]; /**< Speed in km/hr */
+extern uint32_t nf_gps_baud; /**< Baud rate the GPS link is running at */
+extern uint8_t nf_nav_rate_hz; /**< Navigation solutions per second the receiver was set to */
+extern uint16_t nf_rx_byte_count; /**< Bytes taken from the UART, wraps */
+extern uint16_t nf_rx_dropped_count; /**< Sentences the UART dropped because no slot was free or they were corrupt, wraps */
+extern boolean_t nf_receiver_configured; /**< Receiver acknowledged the output configuration sent by nf_init() */
+extern NF_THREAD_LOCAL nf_count_t nf_accept_count[NF_NUM_MSG_TYPES]; /**< Sentences that passed the checksum, per type */
+extern NF_THREAD_LOCAL nf_count_t nf_reject_count[NF_NUM_MSG_TYPES]; /**< Sentences dropped for a bad or missing checksum, per type */
+extern NF_THREAD_LOCAL nf_sat_table_t nf_sat_table; /**< Satellites in view, from GSV and GSA */
 
 #endif /* NF_TYPES_H_ */
\ No newline at end of file
@@ -0,0 +1,639 @@
+#ifndef F_CPU
+#define F_CPU 4000000UL /**< Define the CPU frequency to 4MHz. */
+#endif
+
+#include <avr/pgmspace.h>
+#include <util/delay.h>
+#include <string.h>
+#include <stdint-gcc.h>
+#include "nf.h"
+#include "nf_parse.h"
+#include "nf_types.h"
+#include "nf_ubx.h"
+#include "../lib/uart.h"
+
+//defines
+#define UBX_CFG_PRT_UART1 1 /**< Port ID of the receiver's UART */
+#define UBX_CFG_PRT_MODE_8N1 0x000008D0UL /**< 8 data bits, no parity, 1 stop bit */
+#define UBX_PROTO_UBX 0x0001 /**< UBX bit of the in/out protocol masks */
+#define UBX_PROTO_NMEA 0x0002 /**< NMEA bit of the in/out protocol masks */
+
+#define UBX_KEY(msg_class, msg_id) (((uint16_t)(msg_class) << 8) | (msg_id)) /**< Class and ID as one dispatch key */
+
+//payload lengths and field offsets from the u-blox 6 receiver description
+#define NAV_POSLLH_LEN 28
+#define NAV_POSLLH_LON 4   /**< I4, 1e-7 deg */
+#define NAV_POSLLH_LAT 8   /**< I4, 1e-7 deg */
+#define NAV_POSLLH_HMSL 16 /**< I4, mm */
+
+#define NAV_DOP_LEN 18
+#define NAV_DOP_HDOP 12    /**< U2, 0.01 */
+
+#define NAV_SOL_LEN 52
+#define NAV_SOL_GPSFIX 10  /**< U1, fix type */
+#define NAV_SOL_FLAGS 11   /**< X1, bit 0 gpsFixOK */
+#define NAV_SOL_NUMSV 47   /**< U1 */
+
+#define NAV_VELNED_LEN 36
+#define NAV_VELNED_GSPEED 20 /**< U4, cm/s */
+#define NAV_VELNED_HEADING 24 /**< I4, 1e-5 deg */
+
+#define NAV_TIMEUTC_LEN 20
+#define NAV_TIMEUTC_NANO 8   /**< I4, ns */
+#define NAV_TIMEUTC_HOUR 16  /**< U1; MIN and SEC follow */
+#define NAV_TIMEUTC_VALID 19 /**< X1, bit 2 validUTC */
+#define NAV_TIMEUTC_VALID_UTC 0x04
+
+#define NAV_PVT_LEN 92
+#define NAV_PVT_HOUR 8       /**< U1; MIN and SEC follow */
+#define NAV_PVT_VALID 11     /**< X1, bit 1 validTime */
+#define NAV_PVT_VALID_TIME 0x02
+#define NAV_PVT_NANO 16      /**< I4, ns */
+#define NAV_PVT_FIXTYPE 20   /**< U1 */
+#define NAV_PVT_FLAGS 21     /**< X1, bit 0 gnssFixOK */
+#define NAV_PVT_NUMSV 23     /**< U1 */
+#define NAV_PVT_LON 24       /**< I4, 1e-7 deg */
+#define NAV_PVT_LAT 28       /**< I4, 1e-7 deg */
+#define NAV_PVT_HMSL 36      /**< I4, mm */
+#define NAV_PVT_GSPEED 60    /**< I4, mm/s */
+#define NAV_PVT_HEADMOT 64   /**< I4, 1e-5 deg */
+
+#define CFG_PRT_LEN 20
+#define CFG_PRT_PORT_ID 0   /**< U1 */
+#define CFG_PRT_MODE 4      /**< X4, character framing */
+#define CFG_PRT_BAUD 8      /**< U4 */
+#define CFG_PRT_IN_PROTO 12 /**< X2 */
+#define CFG_PRT_OUT_PROTO 14 /**< X2 */
+
+#define CFG_RATE_LEN 6
+#define CFG_RATE_MEAS 0      /**< U2, ms between measurements */
+#define CFG_RATE_NAV 2       /**< U2, measurements per navigation solution */
+#define CFG_RATE_TIME_REF 4  /**< U2 */
+#define UBX_TIME_REF_GPS 1
+
+#define ACK_LEN 2
+#define ACK_CLASS 0 /**< U1, class of the acknowledged message */
+#define ACK_ID 1    /**< U1, ID of the acknowledged message */
+
+#if NF_INPUT_UBX
+#define UBX_PAYLOAD_SIZE NF_UBX_MAX_PAYLOAD
+#else
+#define UBX_PAYLOAD_SIZE ACK_LEN /**< Only ACKs are decoded while the receiver sends NMEA */
+#endif
+
+#define UBX_FIX_2D 0x02      /**< Lowest fix type that is reported as a position fix */
+#define UBX_FIX_GPS_DR 0x04  /**< Highest fix type that is reported as a position fix */
+#define UBX_FIX_OK 0x01      /**< Fix within DOP and accuracy masks */
+#define UBX_COURSE_MIN_CM_S 50 /**< Below this ground speed the heading of motion is noise and no course is published, as the receiver's NMEA output does */
+#define UBX_HEADING_PER_CDEG 1000 /**< 1e-5 degrees per hundredth of a degree */
+
+/**
+ * @brief States of the UBX frame decoder.
+ */
+typedef enum {
+	UBX_WAIT_SYNC1, /**< Waiting for 0xB5 */
+	UBX_WAIT_SYNC2, /**< Waiting for 0x62 */
+	UBX_CLASS,      /**< Reading the message class */
+	UBX_ID,         /**< Reading the message ID */
+	UBX_LENGTH_LO,  /**< Reading the low payload length byte */
+	UBX_LENGTH_HI,  /**< Reading the high payload length byte */
+	UBX_PAYLOAD,    /**< Reading payload bytes */
+	UBX_CK_A,       /**< Checking the first checksum byte */
+	UBX_CK_B        /**< Checking the second checksum byte */
+} nf_ubx_state_t;
+
+/**
+ * @brief One entry of the UBX message dispatch table.
+ */
+typedef struct {
+	uint16_t key;            /**< Class and ID, see UBX_KEY() */
+	uint8_t length;          /**< Required payload length */
+	void (*handler)(void);   /**< Decodes ubx_payload into the navigation solution */
+} nf_ubx_entry_t;
+
+/**
+ * @brief One output rate setting applied with CFG-MSG.
+ */
+typedef struct {
+	uint8_t msg_class;  /**< Class of the message to set */
+	uint8_t msg_id;     /**< ID of the message to set */
+	uint8_t rate;       /**< Send once every this many solutions, 0 to silence */
+	boolean_t required; /**< Configuration fails if the receiver does not accept this one */
+} nf_ubx_rate_t;
+
+//local static
+static nf_ubx_state_t ubx_state;               /**< Current decoder state */
+static uint8_t ubx_class;                      /**< Class of the frame being received */
+static uint8_t ubx_id;                         /**< ID of the frame being received */
+static uint16_t ubx_length;                    /**< Payload length of the frame being received */
+static uint16_t ubx_offset;                    /**< Payload bytes received so far */
+static uint8_t ubx_ck_a;                       /**< Running Fletcher checksum, first byte */
+static uint8_t ubx_ck_b;                       /**< Running Fletcher checksum, second byte */
+static uint8_t ubx_payload[UBX_PAYLOAD_SIZE]; /**< Payload of the frame being received */
+static const nf_ubx_entry_t* ubx_entry;        /**< Dispatch table entry of the frame being received */
+static uint8_t ack_msg_id;                     /**< CFG message ID we are waiting on */
+static uint8_t ack_result;                     /**< NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY */
+static nav_solution_t* ubx_nav;                /**< Back buffer a NAV handler fills */
+
+//local functions
+/**
+ * @brief Read a little-endian unsigned 16 bit payload field.
+ */
+static uint16_t nf_ubx_u16(uint8_t offset){
+	return (uint16_t)ubx_payload[offset] | ((uint16_t)ubx_payload[offset + 1] << 8);
+}
+
+/**
+ * @brief Read a little-endian signed 32 bit payload field.
+ */
+static int32_t nf_ubx_i32(uint8_t offset){
+	return (int32_t)((uint32_t)nf_ubx_u16(offset) | ((uint32_t)nf_ubx_u16(offset + 2) << 16));
+}
+
+/**
+ * @brief Write a value as a fixed number of zero padded decimal digits.
+ */
+static void nf_ubx_put_digits(char* str, uint32_t value, uint8_t digits){
+	while (digits > 0){
+		digits--;
+		str[digits] = '0' + (value % 10);
+		value /= 10;
+	}
+}
+
+/**
+ * @brief Write a value with one decimal place left aligned and space padded, e.g. "-12.6  ".
+ * @param value_x10 Value in tenths.
+ * @param str Output buffer.
+ * @param size Size of the output buffer; leading digits that do not fit are dropped.
+ */
+static void nf_ubx_put_tenths(int32_t value_x10, char* str, uint8_t size){
+	char digits[12];
+	uint8_t count = 0;
+	uint8_t pos = 0;
+	uint32_t value = (value_x10 < 0) ? (uint32_t)(-value_x10) : (uint32_t)value_x10;
+
+	do { //reversed digits, tenths first
+		digits[count++] = '0' + (value % 10);
+		value /= 10;
+	} while ((value > 0) || (count < 2));
+
+	memset(str, ' ', size * sizeof(char));
+	if ((value_x10 < 0) && (pos < size)){
+		str[pos++] = '-';
+	}
+	while ((count > 1) && (pos < size)){
+		str[pos++] = digits[--count];
+	}
+	if (pos + 1 < size){
+		str[pos++] = '.';
+		str[pos] = digits[0];
+	}
+}
+
+/**
+ * @brief Publish a position given in 1e-7 degrees and an MSL altitude in mm.
+ */
+static void nf_ubx_publish_position(int32_t lat_e7, int32_t lon_e7, int32_t hmsl_mm){
+	//round 1e-7 deg to 1e-6 deg away from zero
+	ubx_nav->latitude_udeg = (lat_e7 + ((lat_e7 < 0) ? -5 : 5)) / 10;
+	ubx_nav->longitude_udeg = (lon_e7 + ((lon_e7 < 0) ? -5 : 5)) / 10;
+	ubx_nav->msl_altitude_dm = hmsl_mm / 100;
+	nf_ubx_put_tenths(ubx_nav->msl_altitude_dm, ubx_nav->msl_altitude, GGA_ALTITUDE_BUFFER_SIZE);
+	convertNMEAtoLLA(ubx_nav);
+}
+
+/**
+ * @brief Publish fix status and number of satellites used.
+ */
+static void nf_ubx_publish_fix(uint8_t fix_type, uint8_t flags, uint8_t num_sv){
+	if ((fix_type >= UBX_FIX_2D) && (fix_type <= UBX_FIX_GPS_DR) && (flags & UBX_FIX_OK)){
+		ubx_nav->position_fix_indicator[0] = '1';
+	} else {
+		ubx_nav->position_fix_indicator[0] = '0';
+	}
+	nf_ubx_put_digits(ubx_nav->satellites_used, num_sv, GGA_SV_USD_BUFFER_SIZE);
+}
+
+/**
+ * @brief Publish UTC time as "hhmmss.ss" from the hour/min/sec bytes at offset and a nanosecond field.
+ */
+static void nf_ubx_publish_time(uint8_t offset, int32_t nano){
+	nf_ubx_put_digits(ubx_nav->utc_time, ubx_payload[offset], 2);
+	nf_ubx_put_digits(ubx_nav->utc_time + 2, ubx_payload[offset + 1], 2);
+	nf_ubx_put_digits(ubx_nav->utc_time + 4, ubx_payload[offset + 2], 2);
+	ubx_nav->utc_time[6] = '.';
+	nf_ubx_put_digits(ubx_nav->utc_time + 7, (nano > 0) ? (uint32_t)nano / 10000000UL : 0, 2);
+}
+
+/**
+ * @brief Publish ground speed, converting cm/s to km/hr with one decimal (x 0.36), and the course.
+ * @param gspeed_cm_s Ground speed in cm/s.
+ * @param heading Heading of motion in 1e-5 degrees.
+ */
+static void nf_ubx_publish_speed(uint32_t gspeed_cm_s, int32_t heading){
+	nf_ubx_put_tenths((int32_t)((gspeed_cm_s * 9UL + 12) / 25), ubx_nav->speed, VTG_SPEED_BUFER_SIZE);
+	if ((gspeed_cm_s < UBX_COURSE_MIN_CM_S) || (heading < 0)){
+		ubx_nav->course_cdeg = NF_COURSE_UNKNOWN;
+	} else {
+		ubx_nav->course_cdeg = (uint16_t)((((uint32_t)heading + (UBX_HEADING_PER_CDEG / 2)) / UBX_HEADING_PER_CDEG) % NF_CDEG_PER_TURN);
+	}
+}
+
+#if NF_INPUT_UBX
+/**
+ * @brief NAV-POSLLH handler.
+ */
+static void nf_ubx_nav_posllh(){
+	nf_ubx_publish_position(nf_ubx_i32(NAV_POSLLH_LAT), nf_ubx_i32(NAV_POSLLH_LON), nf_ubx_i32(NAV_POSLLH_HMSL));
+}
+
+/**
+ * @brief NAV-DOP handler; HDOP shown with one decimal like the GGA field.
+ */
+static void nf_ubx_nav_dop(){
+	nf_ubx_put_tenths((nf_ubx_u16(NAV_DOP_HDOP) + 5) / 10, ubx_nav->hdop, GGA_HDOP_BUFFER_SIZE);
+}
+
+/**
+ * @brief NAV-SOL handler.
+ */
+static void nf_ubx_nav_sol(){
+	nf_ubx_publish_fix(ubx_payload[NAV_SOL_GPSFIX], ubx_payload[NAV_SOL_FLAGS], ubx_payload[NAV_SOL_NUMSV]);
+}
+
+/**
+ * @brief NAV-VELNED handler.
+ */
+static void nf_ubx_nav_velned(){
+	nf_ubx_publish_speed((uint32_t)nf_ubx_i32(NAV_VELNED_GSPEED), nf_ubx_i32(NAV_VELNED_HEADING));
+}
+
+/**
+ * @brief NAV-TIMEUTC handler; time stays blank until the receiver has valid UTC.
+ */
+static void nf_ubx_nav_timeutc(){
+	if (ubx_payload[NAV_TIMEUTC_VALID] & NAV_TIMEUTC_VALID_UTC){
+		nf_ubx_publish_time(NAV_TIMEUTC_HOUR, nf_ubx_i32(NAV_TIMEUTC_NANO));
+	}
+}
+
+/**
+ * @brief NAV-PVT handler for receivers that have it; replaces POSLLH, SOL, VELNED and TIMEUTC.
+ */
+static void nf_ubx_nav_pvt(){
+	if (ubx_payload[NAV_PVT_VALID] & NAV_PVT_VALID_TIME){
+		nf_ubx_publish_time(NAV_PVT_HOUR, nf_ubx_i32(NAV_PVT_NANO));
+	}
+	nf_ubx_publish_fix(ubx_payload[NAV_PVT_FIXTYPE], ubx_payload[NAV_PVT_FLAGS], ubx_payload[NAV_PVT_NUMSV]);
+	nf_ubx_publish_position(nf_ubx_i32(NAV_PVT_LAT), nf_ubx_i32(NAV_PVT_LON), nf_ubx_i32(NAV_PVT_HMSL));
+	nf_ubx_publish_speed((uint32_t)(nf_ubx_i32(NAV_PVT_GSPEED) / 10), nf_ubx_i32(NAV_PVT_HEADMOT)); //mm/s to cm/s
+}
+#endif
+
+/**
+ * @brief ACK-ACK / ACK-NAK handler; records the reply if it is for the CFG message we sent.
+ */
+static void nf_ubx_ack(){
+	if ((ubx_payload[ACK_CLASS] == UBX_CLASS_CFG) && (ubx_payload[ACK_ID] == ack_msg_id)){
+		ack_result = (ubx_id == UBX_ACK_ACK) ? NF_UBX_ACKED : NF_UBX_NAKED;
+	}
+}
+
+/**
+ * @brief UBX message dispatch table; frames not listed are dropped as soon as their length is read.
+ */
+static const nf_ubx_entry_t nf_ubx_table[] PROGMEM = {
+	{UBX_KEY(UBX_CLASS_ACK, UBX_ACK_ACK), ACK_LEN, nf_ubx_ack},
+	{UBX_KEY(UBX_CLASS_ACK, UBX_ACK_NAK), ACK_LEN, nf_ubx_ack},
+#if NF_INPUT_UBX
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_POSLLH), NAV_POSLLH_LEN, nf_ubx_nav_posllh},
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_DOP), NAV_DOP_LEN, nf_ubx_nav_dop},
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_SOL), NAV_SOL_LEN, nf_ubx_nav_sol},
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_VELNED), NAV_VELNED_LEN, nf_ubx_nav_velned},
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_TIMEUTC), NAV_TIMEUTC_LEN, nf_ubx_nav_timeutc},
+	{UBX_KEY(UBX_CLASS_NAV, UBX_NAV_PVT), NAV_PVT_LEN, nf_ubx_nav_pvt},
+#endif
+	{0, 0, 0} //terminator
+};
+
+/**
+ * @brief Look up the frame being received in the dispatch table.
+ * @return The entry with its class, ID and payload length, or 0 if the frame is not one we decode.
+ */
+static const nf_ubx_entry_t* nf_ubx_find(){
+	uint16_t key = UBX_KEY(ubx_class, ubx_id);
+
+	for (const nf_ubx_entry_t* entry = nf_ubx_table; pgm_read_ptr(&entry->handler) != 0; entry++){
+		if ((pgm_read_word(&entry->key) == key) && (pgm_read_byte(&entry->length) == ubx_length)){
+			return entry;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Run the handler for a frame that passed its checksum.
+ * NAV handlers fill the back buffer of the navigation solution, which is published once they return.
+ * @return true if a navigation message updated the navigation solution.
+ */
+static boolean_t nf_ubx_dispatch(){
+	void (*handler)(void) = (void (*)(void))pgm_read_ptr(&ubx_entry->handler);
+
+	if (ubx_class != UBX_CLASS_NAV){
+		handler();
+		return false;
+	}
+	ubx_nav = nf_nav_begin();
+	handler();
+	nf_nav_commit();
+	return true;
+}
+
+/**
+ * @brief Add one byte to the running Fletcher checksum.
+ */
+static void nf_ubx_checksum(uint8_t c){
+	ubx_ck_a += c;
+	ubx_ck_b += ubx_ck_a;
+}
+
+//function definitions
+
+/**
+ * @brief Reset the UBX frame decoder to wait for the next sync characters.
+ */
+void nf_ubx_reset(){
+	ubx_state = UBX_WAIT_SYNC1;
+}
+
+/**
+ * @brief Check if the decoder is in the middle of a UBX frame.
+ * @return true if the next received byte belongs to a UBX frame.
+ */
+boolean_t nf_ubx_in_frame(){
+	return ubx_state != UBX_WAIT_SYNC1;
+}
+
+/**
+ * @brief Advance the UBX frame decoder by one received byte.
+ * Only frames of the dispatch table with their expected length are read past the length bytes.
+ * The payload is kept until the Fletcher checksum over class, ID, length and payload has been
+ * checked; only then is it decoded into the navigation solution. Fixed payload offsets are read directly,
+ * no text is scanned.
+ * @param c The received byte.
+ * @return true if this byte completed a valid navigation message that updated the navigation solution.
+ */
+boolean_t nf_ubx_parse_char(uint8_t c){
+	switch (ubx_state){
+		case UBX_WAIT_SYNC1:
+			if (c == UBX_SYNC_CHAR_1){
+				ubx_state = UBX_WAIT_SYNC2;
+			}
+			break;
+
+		case UBX_WAIT_SYNC2:
+			ubx_state = (c == UBX_SYNC_CHAR_2) ? UBX_CLASS : UBX_WAIT_SYNC1;
+			break;
+
+		case UBX_CLASS:
+			ubx_ck_a = 0;
+			ubx_ck_b = 0;
+			nf_ubx_checksum(c);
+			ubx_class = c;
+			ubx_state = UBX_ID;
+			break;
+
+		case UBX_ID:
+			nf_ubx_checksum(c);
+			ubx_id = c;
+			ubx_state = UBX_LENGTH_LO;
+			break;
+
+		case UBX_LENGTH_LO:
+			nf_ubx_checksum(c);
+			ubx_length = c;
+			ubx_state = UBX_LENGTH_HI;
+			break;
+
+		case UBX_LENGTH_HI:
+			nf_ubx_checksum(c);
+			ubx_length |= (uint16_t)c << 8;
+			ubx_offset = 0;
+			//a length we do not decode is most likely a stray 0xB5 0x62 in NMEA text, so do not
+			//swallow up to 64KB of it as payload but look for the next sync characters at once
+			ubx_entry = (ubx_length <= UBX_PAYLOAD_SIZE) ? nf_ubx_find() : 0;
+			if (ubx_entry == 0){
+				nf_reject_count[NF_MSG_UBX]++;
+				ubx_state = UBX_WAIT_SYNC1;
+				break;
+			}
+			ubx_state = UBX_PAYLOAD;
+			break;
+
+		case UBX_PAYLOAD:
+			nf_ubx_checksum(c);
+			ubx_payload[ubx_offset] = c;
+			if (++ubx_offset >= ubx_length){
+				ubx_state = UBX_CK_A;
+			}
+			break;
+
+		case UBX_CK_A:
+			if (c == ubx_ck_a){
+				ubx_state = UBX_CK_B;
+			} else {
+				nf_reject_count[NF_MSG_UBX]++;
+				ubx_state = UBX_WAIT_SYNC1;
+			}
+			break;
+
+		case UBX_CK_B:
+			ubx_state = UBX_WAIT_SYNC1;
+			if (c != ubx_ck_b){
+				nf_reject_count[NF_MSG_UBX]++;
+				break;
+			}
+			nf_accept_count[NF_MSG_UBX]++;
+			return nf_ubx_dispatch();
+
+		default:
+			ubx_state = UBX_WAIT_SYNC1;
+			break;
+	}
+	return false;
+}
+
+/**
+ * @brief Frame a UBX message and queue it on the UART.
+ * uart_putc() waits for room in the transmit buffer, so interrupts must be enabled.
+ * @param msg_class UBX message class.
+ * @param msg_id UBX message ID.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes.
+ */
+void nf_ubx_send(uint8_t msg_class, uint8_t msg_id, const uint8_t* payload, uint16_t length){
+	uint8_t ck_a = 0;
+	uint8_t ck_b = 0;
+	uint8_t header[4];
+
+	header[0] = msg_class;
+	header[1] = msg_id;
+	header[2] = (uint8_t)length;
+	header[3] = (uint8_t)(length >> 8);
+
+	uart_putc(UBX_SYNC_CHAR_1);
+	uart_putc(UBX_SYNC_CHAR_2);
+	for (uint8_t i = 0; i < sizeof(header); i++){
+		ck_a += header[i];
+		ck_b += ck_a;
+		uart_putc(header[i]);
+	}
+	for (uint16_t i = 0; i < length; i++){
+		ck_a += payload[i];
+		ck_b += ck_a;
+		uart_putc(payload[i]);
+	}
+	uart_putc(ck_a);
+	uart_putc(ck_b);
+}
+
+/**
+ * @brief Send a CFG message and wait for the receiver's ACK-ACK or ACK-NAK, resending on timeout.
+ * @param msg_id CFG message ID.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_send_config(uint8_t msg_id, const uint8_t* payload, uint16_t length){
+	ack_msg_id = msg_id;
+	for (uint8_t attempt = 0; attempt < NF_UBX_CONFIG_TRIES; attempt++){
+		ack_result = NF_UBX_NO_REPLY;
+		nf_ubx_send(UBX_CLASS_CFG, msg_id, payload, length);
+		for (uint16_t ms = 0; ms < NF_UBX_ACK_TIMEOUT_MS; ms++){
+			nf_poll_serial(); //the ACK handler sets ack_result
+			if (ack_result != NF_UBX_NO_REPLY){
+				return ack_result;
+			}
+			_delay_ms(1);
+		}
+	}
+	return NF_UBX_NO_REPLY;
+}
+
+/**
+ * @brief Build a CFG-PRT payload for the receiver's UART at the given baud rate.
+ * The receiver always accepts UBX and NMEA input; it sends UBX only in UBX builds, and NMEA
+ * plus the UBX ACK replies otherwise.
+ */
+static void nf_ubx_port_payload(uint8_t* prt, uint32_t baud){
+	memset(prt, 0, CFG_PRT_LEN);
+	prt[CFG_PRT_PORT_ID] = UBX_CFG_PRT_UART1;
+	prt[CFG_PRT_MODE] = (uint8_t)UBX_CFG_PRT_MODE_8N1;
+	prt[CFG_PRT_MODE + 1] = (uint8_t)(UBX_CFG_PRT_MODE_8N1 >> 8);
+	prt[CFG_PRT_BAUD] = (uint8_t)baud;
+	prt[CFG_PRT_BAUD + 1] = (uint8_t)(baud >> 8);
+	prt[CFG_PRT_BAUD + 2] = (uint8_t)(baud >> 16);
+	prt[CFG_PRT_IN_PROTO] = UBX_PROTO_UBX | UBX_PROTO_NMEA;
+#if NF_INPUT_UBX
+	prt[CFG_PRT_OUT_PROTO] = UBX_PROTO_UBX;
+#else
+	prt[CFG_PRT_OUT_PROTO] = UBX_PROTO_UBX | UBX_PROTO_NMEA;
+#endif
+}
+
+/**
+ * @brief Move the receiver's UART to a new baud rate with CFG-PRT.
+ * The receiver switches as soon as it has the message, so its ACK is usually lost; the caller
+ * reinitialises our UART and checks the link with nf_ubx_poll_port().
+ * @param baud New baud rate.
+ */
+void nf_ubx_set_port_baud(uint32_t baud){
+	uint8_t prt[CFG_PRT_LEN];
+	nf_ubx_port_payload(prt, baud);
+	nf_ubx_send(UBX_CLASS_CFG, UBX_CFG_PRT, prt, sizeof(prt));
+}
+
+/**
+ * @brief Poll the receiver's UART configuration; any answer proves the link works at the current baud.
+ * Works even when every periodic output has been switched off by an earlier boot.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_poll_port(){
+	uint8_t port = UBX_CFG_PRT_UART1;
+	return nf_ubx_send_config(UBX_CFG_PRT, &port, sizeof(port));
+}
+
+/**
+ * @brief Output rates applied by nf_ubx_configure_output(), in the order they are sent.
+ * The NEO-6M default also sends GLL and RMC and sends GSV and GSA every solution. Rates count
+ * solutions, so GSA and GSV are set to NF_NAV_RATE_HZ for one satellite table update per second.
+ */
+static const nf_ubx_rate_t nf_ubx_rates[] PROGMEM = {
+#if NF_INPUT_UBX
+	{UBX_CLASS_NAV, UBX_NAV_POSLLH, 1, true},
+	{UBX_CLASS_NAV, UBX_NAV_SOL, 1, true},
+	{UBX_CLASS_NAV, UBX_NAV_VELNED, 1, true},
+	{UBX_CLASS_NAV, UBX_NAV_DOP, 1, true},
+	{UBX_CLASS_NAV, UBX_NAV_TIMEUTC, 1, true},
+	{UBX_CLASS_NAV, UBX_NAV_PVT, 1, false}, //NAKed by u-blox 6, used by newer receivers
+#else
+	{UBX_CLASS_NMEA, UBX_NMEA_GGA, 1, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_VTG, 1, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_GSV, NF_NAV_RATE_HZ, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_GLL, 0, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_GSA, NF_NAV_RATE_HZ, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_RMC, 0, true},
+	{UBX_CLASS_NMEA, UBX_NMEA_ZDA, 0, true},
+#endif
+};
+
+/**
+ * @brief Set the receiver's output to exactly the messages the firmware parses.
+ * Each setting is sent with UBX-CFG-MSG on the otherwise unused UART TX line and must be
+ * acknowledged. UBX builds then drop NMEA from the port output with UBX-CFG-PRT; the baud rate
+ * is left unchanged. uart_putc() waits for room in the transmit buffer, so interrupts must be enabled.
+ * @return true if the receiver acknowledged every required setting.
+ */
+boolean_t nf_ubx_configure_output(){
+	boolean_t configured = true;
+	uint8_t msg_rate[3];
+
+	for (uint8_t i = 0; i < sizeof(nf_ubx_rates) / sizeof(nf_ubx_rates[0]); i++){
+		msg_rate[0] = pgm_read_byte(&nf_ubx_rates[i].msg_class);
+		msg_rate[1] = pgm_read_byte(&nf_ubx_rates[i].msg_id);
+		msg_rate[2] = pgm_read_byte(&nf_ubx_rates[i].rate); //on the port this is received on
+		if ((nf_ubx_send_config(UBX_CFG_MSG, msg_rate, sizeof(msg_rate)) != NF_UBX_ACKED)
+			&& pgm_read_byte(&nf_ubx_rates[i].required)){
+			configured = false;
+		}
+	}
+
+#if NF_INPUT_UBX
+	uint8_t prt[CFG_PRT_LEN];
+	nf_ubx_port_payload(prt, nf_gps_baud);
+	if (nf_ubx_send_config(UBX_CFG_PRT, prt, sizeof(prt)) != NF_UBX_ACKED){
+		configured = false;
+	}
+#endif
+	return configured;
+}
+
+/**
+ * @brief Set the receiver's measurement rate with UBX-CFG-RATE.
+ * One navigation solution is produced per measurement, aligned to GPS time.
+ * @param rate_hz Solutions per second; the NEO-6M is rated for up to 5.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_set_rate(uint8_t rate_hz){
+	uint16_t meas_ms = 1000 / rate_hz;
+	uint8_t rate[CFG_RATE_LEN];
+
+	rate[CFG_RATE_MEAS] = (uint8_t)meas_ms;
+	rate[CFG_RATE_MEAS + 1] = (uint8_t)(meas_ms >> 8);
+	rate[CFG_RATE_NAV] = 1; //one solution per measurement
+	rate[CFG_RATE_NAV + 1] = 0;
+	rate[CFG_RATE_TIME_REF] = UBX_TIME_REF_GPS;
+	rate[CFG_RATE_TIME_REF + 1] = 0;
+	return nf_ubx_send_config(UBX_CFG_RATE, rate, sizeof(rate));
+}
@@ -0,0 +1,117 @@
+/**
+ * @file nf_ubx.h
+ * @brief Header file for the u-blox UBX binary protocol support of the navigation fetch (NF) CSC.
+ *
+ * This file provides declarations for sending UBX frames to the receiver and decoding the UBX
+ * frames it sends back.
+ */
+
+#ifndef NF_UBX_H_
+#define NF_UBX_H_
+
+#include "../ut/ut_types.h"
+
+#define UBX_SYNC_CHAR_1 0xB5 /**< First UBX sync character */
+#define UBX_SYNC_CHAR_2 0x62 /**< Second UBX sync character */
+
+#define UBX_CLASS_NAV 0x01 /**< Navigation results */
+#define UBX_CLASS_ACK 0x05 /**< Replies to CFG messages */
+#define UBX_CLASS_CFG 0x06 /**< Configuration input */
+#define UBX_CLASS_NMEA 0xF0 /**< Standard NMEA sentences, for CFG-MSG */
+
+#define UBX_NAV_POSLLH 0x02 /**< Geodetic position */
+#define UBX_NAV_DOP 0x04 /**< Dilution of precision */
+#define UBX_NAV_SOL 0x06 /**< Fix status and satellites used */
+#define UBX_NAV_PVT 0x07 /**< Position, velocity and time in one message (not on the NEO-6M) */
+#define UBX_NAV_VELNED 0x12 /**< Velocity in north/east/down */
+#define UBX_NAV_TIMEUTC 0x21 /**< UTC time */
+
+#define UBX_ACK_NAK 0x00 /**< Configuration rejected */
+#define UBX_ACK_ACK 0x01 /**< Configuration accepted */
+
+#define UBX_CFG_PRT 0x00 /**< Port configuration */
+#define UBX_CFG_MSG 0x01 /**< Message output rate */
+#define UBX_CFG_RATE 0x08 /**< Measurement and navigation rate */
+
+#define UBX_NMEA_GGA 0x00 /**< NMEA message IDs within UBX_CLASS_NMEA */
+#define UBX_NMEA_GLL 0x01
+#define UBX_NMEA_GSA 0x02
+#define UBX_NMEA_GSV 0x03
+#define UBX_NMEA_RMC 0x04
+#define UBX_NMEA_VTG 0x05
+#define UBX_NMEA_ZDA 0x08
+
+#define NF_UBX_ACKED 0 /**< Receiver answered ACK-ACK */
+#define NF_UBX_NAKED 1 /**< Receiver answered ACK-NAK */
+#define NF_UBX_NO_REPLY 2 /**< No answer before the timeout */
+
+#define NF_UBX_ACK_TIMEOUT_MS 250 /**< Time to wait for an ACK before resending */
+#define NF_UBX_CONFIG_TRIES 3 /**< Sends per configuration message before giving up */
+
+#define NF_UBX_MAX_PAYLOAD 92 /**< Largest payload kept (NAV-PVT) with NF_INPUT_UBX, otherwise that of an ACK; longer frames are dropped at their length bytes */
+
+/**
+ * @brief Reset the UBX frame decoder to wait for the next sync characters.
+ */
+void nf_ubx_reset();
+
+/**
+ * @brief Check if the decoder is in the middle of a UBX frame.
+ * @return true if the next received byte belongs to a UBX frame.
+ */
+boolean_t nf_ubx_in_frame();
+
+/**
+ * @brief Advance the UBX frame decoder by one received byte. Never blocks.
+ * @param c The received byte.
+ * @return true if this byte completed a valid navigation message that updated the navigation solution.
+ */
+boolean_t nf_ubx_parse_char(uint8_t c);
+
+/**
+ * @brief Frame a UBX message with sync characters, length and Fletcher checksum and queue it on the UART.
+ * @param msg_class UBX message class.
+ * @param msg_id UBX message ID.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes.
+ */
+void nf_ubx_send(uint8_t msg_class, uint8_t msg_id, const uint8_t* payload, uint16_t length);
+
+/**
+ * @brief Send a CFG message and wait for the receiver's ACK-ACK or ACK-NAK, resending on timeout.
+ * Received bytes keep flowing through nf_poll_serial() while waiting.
+ * @param msg_id CFG message ID.
+ * @param payload Payload bytes.
+ * @param length Number of payload bytes.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_send_config(uint8_t msg_id, const uint8_t* payload, uint16_t length);
+
+/**
+ * @brief Move the receiver's UART to a new baud rate with CFG-PRT, without waiting for an ACK.
+ * @param baud New baud rate.
+ */
+void nf_ubx_set_port_baud(uint32_t baud);
+
+/**
+ * @brief Poll the receiver's UART configuration to check that the link works at the current baud.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_poll_port();
+
+/**
+ * @brief Set the receiver's output to exactly the messages the firmware parses.
+ * NMEA builds keep GGA and VTG and silence the other default sentences; UBX builds enable the
+ * navigation messages decoded by nf_ubx_parse_char() and drop NMEA from the port.
+ * @return true if the receiver acknowledged every required setting.
+ */
+boolean_t nf_ubx_configure_output();
+
+/**
+ * @brief Set the receiver's navigation rate with UBX-CFG-RATE.
+ * @param rate_hz Solutions per second.
+ * @return NF_UBX_ACKED, NF_UBX_NAKED or NF_UBX_NO_REPLY.
+ */
+uint8_t nf_ubx_set_rate(uint8_t rate_hz);
+
+#endif /* NF_UBX_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file ut_eeq.c
+ * @brief Interrupt driven EEPROM write queue of the utilities CSC, see ut_eeq.h.
+ *
+ * The queue is a ring of blocks; the oldest has its first written bytes in EEPROM already. The
+ * EE_READY interrupt fires whenever the EEPROM is free and EERIE is set, so it is set while
+ * blocks are queued and cleared by the interrupt once the last byte is written. The main loop
+ * clears it too while it waits for the EEPROM, so no new byte starts before it has read.
+ */
+
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include <string.h>
+#include "ut_eeq.h"
+
+/**
+ * @brief A write waiting for the EEPROM.
+ */
+typedef struct {
+	uint16_t address; /**< EEPROM address of the first byte */
+	uint8_t count; /**< Bytes to write */
+	uint8_t data[UT_EEQ_BLOCK_SIZE]; /**< Bytes to write */
+} ut_eeq_block_t;
+
+//local static
+static ut_eeq_block_t queue[UT_EEQ_DEPTH]; /**< Queued writes, oldest at first */
+static uint8_t first; /**< Ring position of the oldest block */
+static uint8_t written; /**< Bytes of the oldest block done */
+static volatile uint8_t queued; /**< Blocks in the queue, read by ut_eeq_pending() without masking */
+
+//local function definitions
+/**
+ * @brief Starts the write of the next byte that differs from EEPROM, dropping the blocks that are done.
+ * Call with interrupts disabled and the EEPROM free.
+ */
+static void ut_eeq_step(){
+	while (queued != 0){
+		ut_eeq_block_t* block = &queue[first];
+
+		if (written == block->count){
+			first = (first + 1) % UT_EEQ_DEPTH;
+			written = 0;
+			queued--;
+			continue;
+		}
+		EEAR = block->address + written;
+		EECR |= (1 << EERE);
+		if (EEDR != block->data[written]){
+			EEDR = block->data[written++];
+			EECR |= (1 << EEMPE); //EEPE within four cycles, erase and write in one
+			EECR |= (1 << EEPE);
+			return;
+		}
+		written++;
+	}
+	EECR &= ~(1 << EERIE);
+}
+
+/**
+ * @brief Keeps the EE_READY interrupt from starting another byte and waits for the one being written.
+ */
+static void ut_eeq_hold(){
+	EECR &= ~(1 << EERIE);
+	eeprom_busy_wait();
+}
+
+// Interrupt Service Routine for EEPROM ready: write the next queued byte
+ISR(EE_READY_vect) {
+	ut_eeq_step();
+}
+
+//function definitions
+void ut_eeq_read(void* dst, uint16_t address, uint8_t count){
+	uint8_t* bytes = dst;
+	uint8_t sreg;
+
+	ut_eeq_hold();
+	sreg = SREG;
+	cli();
+	eeprom_read_block(dst, (const void*)address, count);
+	//oldest first, so a newer write of the same byte wins
+	for (uint8_t i = 0; i < queued; i++){
+		const ut_eeq_block_t* block = &queue[(first + i) % UT_EEQ_DEPTH];
+
+		for (uint8_t j = 0; j < block->count; j++){
+			uint16_t offset = block->address + j - address;
+
+			if (offset < count){
+				bytes[offset] = block->data[j];
+			}
+		}
+	}
+	if (queued != 0){
+		EECR |= (1 << EERIE);
+	}
+	SREG = sreg;
+}
+
+void ut_eeq_write(const void* src, uint16_t address, uint8_t count){
+	const uint8_t* bytes = src;
+
+	while (count != 0){
+		uint8_t size = (count < UT_EEQ_BLOCK_SIZE) ? count : UT_EEQ_BLOCK_SIZE;
+		ut_eeq_block_t* block;
+		uint8_t sreg;
+
+		//full: finish the oldest block here, waiting on the EEPROM like eeprom_update_block()
+		while (queued == UT_EEQ_DEPTH){
+			ut_eeq_hold();
+			sreg = SREG;
+			cli();
+			ut_eeq_step();
+			SREG = sreg;
+		}
+		sreg = SREG;
+		cli();
+		block = &queue[(first + queued) % UT_EEQ_DEPTH];
+		block->address = address;
+		block->count = size;
+		memcpy(block->data, bytes, size);
+		queued++;
+		EECR |= (1 << EERIE);
+		SREG = sreg;
+
+		bytes += size;
+		address += size;
+		count -= size;
+	}
+}
+
+boolean_t ut_eeq_pending(void){
+	return queued != 0;
+}
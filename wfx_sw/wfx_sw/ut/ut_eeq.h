@@ -0,0 +1,47 @@
+/**
+ * @file ut_eeq.h
+ * @brief Header file for the interrupt driven EEPROM write queue of the utilities CSC.
+ *
+ * An EEPROM write takes about 3.4ms per byte, a log entry of ut_log.h about 70ms. Writes are
+ * instead copied to a RAM queue of UT_EEQ_DEPTH blocks and return at once; the EE_READY
+ * interrupt writes the next byte each time the EEPROM is free, skipping bytes that already hold
+ * their value as eeprom_update_block() does. Reads see the queued bytes, so the log finds the
+ * EEPROM as if every write had completed. Blocks are written in the order they were queued, so a
+ * power loss only loses the newest writes, which the log treats like a write cut short.
+ *
+ * Reads and writes are for the main loop: they mask the EE_READY interrupt while they use the
+ * queue, and a read waits with interrupts enabled for the byte being written, at most 3.4ms.
+ * With the queue full, a write first finishes the oldest block the same way.
+ */
+
+#ifndef UT_EEQ_H_
+#define UT_EEQ_H_
+
+#include "ut_types.h"
+
+#define UT_EEQ_DEPTH 4 /**< Blocks the queue holds, two button actions of up to two log entries each */
+#define UT_EEQ_BLOCK_SIZE 20 /**< Bytes per block, one UT_LOG_ENTRY_SIZE entry; longer writes take several */
+
+/**
+ * @brief Reads EEPROM, queued writes included.
+ * @param dst Destination.
+ * @param address EEPROM address.
+ * @param count Bytes to read.
+ */
+void ut_eeq_read(void* dst, uint16_t address, uint8_t count);
+
+/**
+ * @brief Queues a write to EEPROM and returns without waiting for it, unless the queue is full.
+ * @param src Source, copied.
+ * @param address EEPROM address.
+ * @param count Bytes to write.
+ */
+void ut_eeq_write(const void* src, uint16_t address, uint8_t count);
+
+/**
+ * @brief Whether writes are still queued.
+ * @return true until the EE_READY interrupt has written the last queued byte.
+ */
+boolean_t ut_eeq_pending(void);
+
+#endif /* UT_EEQ_H_ */
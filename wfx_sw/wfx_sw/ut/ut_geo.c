@@ -0,0 +1,754 @@
+/**
+ * @file ut_geo.c
+ * @brief Fixed-point geodesy of the utilities CSC, see ut_geo.h.
+ *
+ * Angles inside this file are in half microdegrees, so the half angles of the haversine formula
+ * keep every bit of a microdegree difference; a quarter turn is UT_GEO_QUARTER. The sine of
+ * such an angle comes from two 86 entry PROGMEM tables spaced 2^21 half microdegrees (about 1
+ * degree) apart and the angle addition formula, with the offset from the table entry handled by
+ * a short Taylor series. Products are formed from three 16x16 bit hardware multiplies.
+ *
+ * Nearby points skip the trigonometry of the haversine: on the plane tangent at their mean
+ * latitude the distance is the hypotenuse of the north and east legs. On the ellipsoid the legs
+ * take the radii of curvature, and longer distances use Lambert's formula on reduced latitudes.
+ *
+ * The internal functions take the cosines of the latitudes (and the reduced latitudes) as
+ * arguments, so the distances between ut_geo_point_t points reuse the values computed by
+ * ut_geo_point_set() and only the functions taking bare microdegrees compute them per call.
+ */
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#endif
+#include "ut_geo.h"
+
+//defines
+#define UT_GEO_QUARTER 180000000UL /**< 90 degrees in half microdegrees */
+#define UT_GEO_HALF_TURN_UDEG 180000000L /**< 180 degrees in microdegrees */
+#define UT_GEO_TABLE_SHIFT 21 /**< Table entries are 2^21 half microdegrees apart */
+#define UT_GEO_OFFSET_MASK ((1UL << UT_GEO_TABLE_SHIFT) - 1)
+#define UT_GEO_RAD_PER_OFFSET 19650660UL /**< Radians per half microdegree in Q51 */
+#define UT_GEO_SIXTH 178956971UL /**< 1/6 in Q30 */
+#define UT_GEO_TWENTY_FOURTH 44739243UL /**< 1/24 in Q30 */
+#define UT_GEO_HALF_PI 1686629713UL /**< pi/2 in Q30 */
+#define UT_GEO_NORMALISED (1UL << 29) /**< Small haversine terms are shifted up to at least this before squaring */
+#define UT_GEO_HALF_FLATTENING 1800027UL /**< f/2 of WGS-84 in Q30 */
+#define UT_GEO_REDUCED_FIRST 788170678UL /**< n = f/(2 - f) in microdegrees, times 2^13 */
+#define UT_GEO_REDUCED_SECOND 661756UL /**< n^2/2 in microdegrees, times 2^13 */
+#define UT_GEO_REDUCED_SHIFT 13
+#define UT_GEO_TAN_EIGHTH_TURN 444758426UL /**< tan(pi/8) in Q30 */
+#define UT_GEO_CDEG_PER_RAD 375493621UL /**< Hundredths of a degree per radian, times 2^16 */
+#define UT_GEO_CDEG_SHIFT 16
+#define UT_GEO_CDEG_QUARTER 9000U /**< 90 degrees in hundredths */
+#define UT_GEO_CDEG_HALF_TURN 18000U /**< 180 degrees in hundredths */
+#define UT_GEO_CDEG_TURN 36000U /**< 360 degrees in hundredths */
+
+/**
+ * @brief sin(k * 2^21 half microdegrees) in Q30.
+ */
+static const uint32_t ut_geo_sin_table[] PROGMEM = {
+	0UL, 19649564UL, 39292546UL, 58922369UL, 78532457UL, 98116243UL,
+	117667168UL, 137178683UL, 156644255UL, 176057363UL, 195411506UL, 214700201UL,
+	233916989UL, 253055433UL, 272109124UL, 291071679UL, 309936748UL, 328698013UL,
+	347349191UL, 365884033UL, 384296333UL, 402579925UL, 420728684UL, 438736532UL,
+	456597438UL, 474305420UL, 491854546UL, 509238941UL, 526452781UL, 543490300UL,
+	560345793UL, 577013615UL, 593488183UL, 609763979UL, 625835552UL, 641697519UL,
+	657344569UL, 672771460UL, 687973026UL, 702944175UL, 717679894UL, 732175246UL,
+	746425377UL, 760425515UL, 774170970UL, 787657139UL, 800879505UL, 813833640UL,
+	826515205UL, 838919952UL, 851043728UL, 862882471UL, 874432216UL, 885689096UL,
+	896649340UL, 907309277UL, 917665337UL, 927714052UL, 937452055UL, 946876087UL,
+	955982989UL, 964769713UL, 973233315UL, 981370961UL, 989179925UL, 996657592UL,
+	1003801457UL, 1010609128UL, 1017078324UL, 1023206880UL, 1028992742UL, 1034433973UL,
+	1039528750UL, 1044275367UL, 1048672235UL, 1052717880UL, 1056410947UL, 1059750201UL,
+	1062734521UL, 1065362910UL, 1067634486UL, 1069548488UL, 1071104277UL, 1072301330UL,
+	1073139247UL, 1073617747UL
+};
+
+/**
+ * @brief cos(k * 2^21 half microdegrees) in Q30.
+ */
+static const uint32_t ut_geo_cos_table[] PROGMEM = {
+	1073741824UL, 1073562015UL, 1073022647UL, 1072123901UL, 1070866078UL, 1069249600UL,
+	1067275008UL, 1064942963UL, 1062254245UL, 1059209757UL, 1055810517UL, 1052057664UL,
+	1047952454UL, 1043496264UL, 1038690584UL, 1033537025UL, 1028037313UL, 1022193289UL,
+	1016006912UL, 1009480252UL, 1002615496UL, 995414943UL, 987881005UL, 980016204UL,
+	971823176UL, 963304663UL, 954463519UL, 945302706UL, 935825290UL, 926034448UL,
+	915933456UL, 905525700UL, 894814663UL, 883803935UL, 872497202UL, 860898251UL,
+	849010967UL, 836839332UL, 824387421UL, 811659406UL, 798659549UL, 785392204UL,
+	771861815UL, 758072913UL, 744030116UL, 729738128UL, 715201735UL, 700425807UL,
+	685415291UL, 670175215UL, 654710683UL, 639026874UL, 623129043UL, 607022512UL,
+	590712676UL, 574204999UL, 557505008UL, 540618297UL, 523550521UL, 506307398UL,
+	488894701UL, 471318263UL, 453583971UL, 435697764UL, 417665633UL, 399493617UL,
+	381187801UL, 362754319UL, 344199342UL, 325529085UL, 306749802UL, 287867782UL,
+	268889349UL, 249820859UL, 230668699UL, 211439283UL, 192139051UL, 172774469UL,
+	153352020UL, 133878211UL, 114359563UL, 94802613UL, 75213913UL, 55600021UL,
+	35967508UL, 16322948UL
+};
+
+/**
+ * @brief Coefficients of P(s), highest first, with asin(t) = t + t * s * P(s) and s = t^2, in Q30.
+ * Least squares fit over 0 <= t <= 0.5; the asin error is below 1e-10.
+ */
+static const uint32_t ut_geo_asin_poly[] PROGMEM = {
+	41940721UL, 14204572UL, 34538293UL, 47746562UL, 80539389UL, 178956825UL
+};
+
+/**
+ * @brief Coefficients of Q(s), highest first, with atan(t) = t - t * s * Q(s) and s = t^2, in Q30.
+ * Q(s) = 1/3 - s/5 + s^2/7 - s^3/9 is evaluated as 1/3 - s(1/5 - s(1/7 - s/9)), which keeps every
+ * step positive for t up to tan(pi/8); the dropped terms are below 7e-6 there.
+ */
+static const uint32_t ut_geo_atan_poly[] PROGMEM = {
+	119304647UL, 153391689UL, 214748365UL, 357913941UL
+};
+
+/**
+ * @brief Meridian radius of curvature over the equatorial radius, M/a, in powers of sin^2(lat), highest first, in Q30.
+ * M/a = (1 - e^2)(1 + 3/2 e^2 s + 15/8 e^4 s^2 + 35/16 e^6 s^3); the dropped terms are below 5e-9.
+ */
+static const uint32_t ut_geo_meridian_poly[] PROGMEM = {
+	700UL, 89620UL, 10709875UL, 1066553788UL
+};
+
+/**
+ * @brief Prime vertical radius of curvature over the equatorial radius, N/a, as ut_geo_meridian_poly.
+ * N/a = 1 + 1/2 e^2 s + 3/8 e^4 s^2 + 5/16 e^6 s^3; the dropped terms are below 1e-9.
+ */
+static const uint32_t ut_geo_parallel_poly[] PROGMEM = {
+	101UL, 18045UL, 3594018UL, 1073741824UL
+};
+
+
+//local function definitions
+
+/**
+ * @brief Product of two unsigned Q30 numbers.
+ * The low halves' product and the low bits of the cross products are dropped, so the result is
+ * up to 6 below the exact one. The high halves' product must stay below 2^30, which holds for
+ * any operands up to 2.0 and for one operand up to pi/2 with the other below 2^27.
+ */
+static uint32_t ut_geo_mul(uint32_t a, uint32_t b){
+	uint16_t a_high = a >> 16;
+	uint16_t b_high = b >> 16;
+
+	return (((uint32_t)a_high * b_high) << 2)
+		+ (((uint32_t)a_high * (uint16_t)b) >> 14)
+		+ (((uint32_t)(uint16_t)a * b_high) >> 14);
+}
+
+/**
+ * @brief Convert an offset from a table entry to radians.
+ * Short distances are measured with the offset alone, so all four partial products are kept
+ * and the result is at most 1 below the exact one.
+ * @param offset Half microdegrees, below 2^21.
+ * @return The offset in radians, Q30.
+ */
+static uint32_t ut_geo_offset_radians(uint32_t offset){
+	uint16_t offset_high = offset >> 16;
+	uint16_t offset_low = offset;
+
+	return (((uint32_t)offset_high * (UT_GEO_RAD_PER_OFFSET >> 16)) << 11)
+		+ (((uint32_t)offset_high * (uint16_t)UT_GEO_RAD_PER_OFFSET
+			+ (uint32_t)offset_low * (UT_GEO_RAD_PER_OFFSET >> 16)
+			+ (((uint32_t)offset_low * (uint16_t)UT_GEO_RAD_PER_OFFSET) >> 16)) >> 5);
+}
+
+/**
+ * @brief Sine of a first quadrant angle.
+ * sin(a + b) = sin(a)cos(b) + cos(a)sin(b) with a from the tables and b below about 1 degree,
+ * where sin(b) = b - b^3/6 and cos(b) = 1 - b^2/2 + b^4/24 are exact to 2e-11.
+ * @param angle Angle in half microdegrees, 0 to UT_GEO_QUARTER.
+ * @return The sine in Q30.
+ */
+static uint32_t ut_geo_sin_half_udeg(uint32_t angle){
+	uint8_t index = angle >> UT_GEO_TABLE_SHIFT;
+	uint32_t offset = ut_geo_offset_radians(angle & UT_GEO_OFFSET_MASK);
+	uint32_t offset2 = ut_geo_mul(offset, offset);
+	uint32_t sin_offset = offset - ut_geo_mul(ut_geo_mul(offset2, offset), UT_GEO_SIXTH);
+	uint32_t cos_offset = UT_GEO_Q30_ONE - (offset2 >> 1) + ut_geo_mul(ut_geo_mul(offset2, offset2), UT_GEO_TWENTY_FOURTH);
+
+	return ut_geo_mul(pgm_read_dword(&ut_geo_sin_table[index]), cos_offset)
+		+ ut_geo_mul(pgm_read_dword(&ut_geo_cos_table[index]), sin_offset);
+}
+
+/**
+ * @brief Cosine of a latitude.
+ * @param lat_udeg Latitude in microdegrees; values past a pole count as the pole.
+ * @return The cosine in Q30.
+ */
+static uint32_t ut_geo_cos_lat(int32_t lat_udeg){
+	uint32_t lat = (lat_udeg < 0) ? -(uint32_t)lat_udeg : (uint32_t)lat_udeg;
+
+	lat *= 2; //half microdegrees
+	return (lat >= UT_GEO_QUARTER) ? 0 : ut_geo_sin_half_udeg(UT_GEO_QUARTER - lat);
+}
+
+/**
+ * @brief Square root of a Q30 number, digit by digit.
+ * The 32 bits of the radicand plus 24 zero bits give a 28 bit root; the remainder stays below
+ * 2^31 for any radicand.
+ * @param value Radicand in Q30, below 4.0.
+ * @return The square root in Q27.
+ */
+static uint32_t ut_geo_sqrt_q27(uint32_t value){
+	uint32_t root = 0;
+	uint32_t remainder = 0;
+	uint32_t trial;
+
+	for (uint8_t i = 0; i < 28; i++){
+		remainder = (remainder << 2) | (value >> 30);
+		value <<= 2;
+		root <<= 1;
+		trial = (root << 1) | 1;
+		if (remainder >= trial){
+			remainder -= trial;
+			root |= 1;
+		}
+	}
+	return root;
+}
+
+/**
+ * @brief Evaluate a polynomial with Horner's rule.
+ * @param coefficients PROGMEM coefficients in Q30, highest power first.
+ * @param count Number of coefficients.
+ * @param x Argument in Q30, up to 1.0.
+ * @return The value in Q30.
+ */
+static uint32_t ut_geo_poly(const uint32_t* coefficients, uint8_t count, uint32_t x){
+	uint32_t value = pgm_read_dword(&coefficients[0]);
+
+	for (uint8_t i = 1; i < count; i++){
+		value = ut_geo_mul(value, x) + pgm_read_dword(&coefficients[i]);
+	}
+	return value;
+}
+
+/**
+ * @brief 1 - x for a Q30 square of a sine or cosine, which may round to just above 1.0.
+ */
+static uint32_t ut_geo_complement(uint32_t x){
+	return (x < UT_GEO_Q30_ONE) ? UT_GEO_Q30_ONE - x : 0;
+}
+
+/**
+ * @brief Quotient of two Q30 numbers, bit by bit.
+ * @param numerator Dividend in Q30.
+ * @param denominator Divisor in Q30, below 2^31.
+ * @return The quotient in Q30, rounded down; quotients of 2.0 and more give just below 2.0.
+ */
+static uint32_t ut_geo_div(uint32_t numerator, uint32_t denominator){
+	uint32_t quotient = 0;
+
+	if ((numerator >> 1) >= denominator){
+		return (UT_GEO_Q30_ONE << 1) - 1;
+	}
+	for (uint8_t i = 0; i < 31; i++){
+		quotient <<= 1;
+		if (numerator >= denominator){
+			numerator -= denominator;
+			quotient |= 1;
+		}
+		numerator <<= 1;
+	}
+	return quotient;
+}
+
+/**
+ * @brief asin(t) for 0 <= t <= 0.5 from the scaled value t * 2^shift.
+ * @param scaled t * 2^shift in Q30, below 2.0.
+ * @param square t^2 in Q30, unscaled.
+ * @return asin(t) * 2^shift in Q30.
+ */
+static uint32_t ut_geo_asin_small(uint32_t scaled, uint32_t square){
+	uint32_t poly = ut_geo_poly(ut_geo_asin_poly, sizeof(ut_geo_asin_poly) / sizeof(ut_geo_asin_poly[0]), square);
+
+	return scaled + ut_geo_mul(scaled, ut_geo_mul(square, poly));
+}
+
+/**
+ * @brief atan(t) for 0 <= t <= 1, in hundredths of a degree.
+ * Past tan(pi/8) atan(t) = pi/4 - atan((1 - t)/(1 + t)), which keeps the series short.
+ * @param t Tangent in Q30.
+ * @return The angle in hundredths of a degree, 0 to 4500.
+ */
+static uint16_t ut_geo_atan_cdeg(uint32_t t){
+	boolean_t folded = (t > UT_GEO_TAN_EIGHTH_TURN);
+	uint32_t square;
+	uint32_t poly;
+	uint32_t angle;
+
+	if (folded){
+		t = ut_geo_div(UT_GEO_Q30_ONE - t, UT_GEO_Q30_ONE + t);
+	}
+	square = ut_geo_mul(t, t);
+	poly = pgm_read_dword(&ut_geo_atan_poly[0]);
+	for (uint8_t i = 1; i < sizeof(ut_geo_atan_poly) / sizeof(ut_geo_atan_poly[0]); i++){
+		poly = pgm_read_dword(&ut_geo_atan_poly[i]) - ut_geo_mul(square, poly);
+	}
+	angle = t - ut_geo_mul(t, ut_geo_mul(square, poly));
+	angle = (ut_geo_mul(angle, UT_GEO_CDEG_PER_RAD) + (1UL << (UT_GEO_CDEG_SHIFT - 1))) >> UT_GEO_CDEG_SHIFT;
+	return folded ? (UT_GEO_CDEG_QUARTER / 2) - (uint16_t)angle : (uint16_t)angle;
+}
+
+/**
+ * @brief Direction of a vector from its north and east components, clockwise from north.
+ * @param north Size of the north component, any scale.
+ * @param south The north component points south.
+ * @param east Size of the east component, same scale.
+ * @param west The east component points west.
+ * @return The direction in hundredths of a degree, 0 to 35999; 0 for a zero vector.
+ */
+static uint16_t ut_geo_direction_cdeg(uint32_t north, boolean_t south, uint32_t east, boolean_t west){
+	uint16_t angle;
+
+	if (!north && !east){
+		return 0;
+	}
+	while ((north | east) >= UT_GEO_Q30_ONE){ //keep the sum in the division below 2^31
+		north >>= 1;
+		east >>= 1;
+	}
+	if (east <= north){
+		angle = ut_geo_atan_cdeg(ut_geo_div(east, north));
+	} else {
+		angle = UT_GEO_CDEG_QUARTER - ut_geo_atan_cdeg(ut_geo_div(north, east));
+	}
+	if (south){
+		angle = UT_GEO_CDEG_HALF_TURN - angle;
+	}
+	if (west && angle){
+		angle = UT_GEO_CDEG_TURN - angle;
+	}
+	return angle;
+}
+
+/**
+ * @brief Scale an angle to a distance.
+ * @param angle Angle times 2^shift in radians, Q30.
+ * @param shift Scale of the angle; -1 doubles it.
+ * @param radius_dm Radius in decimetres, below 2^27.
+ * @return The distance in decimetres, rounded.
+ */
+static uint32_t ut_geo_scale_dm(uint32_t angle, int8_t shift, uint32_t radius_dm){
+	uint32_t distance = ut_geo_mul(angle, radius_dm);
+
+	if (shift <= 0){
+		return distance << -shift;
+	}
+	return (distance + (1UL << (shift - 1))) >> shift;
+}
+
+/**
+ * @brief Latitude and longitude differences between two points, taking the short way round.
+ * @param dlat Set to the latitude difference in microdegrees, at most 180 degrees.
+ * @param dlon Set to the longitude difference in microdegrees, at most 180 degrees.
+ */
+static void ut_geo_separation(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t* dlat, uint32_t* dlon){
+	*dlat = (lat2_udeg > lat1_udeg) ? (uint32_t)lat2_udeg - (uint32_t)lat1_udeg : (uint32_t)lat1_udeg - (uint32_t)lat2_udeg;
+	*dlon = (lon2_udeg > lon1_udeg) ? (uint32_t)lon2_udeg - (uint32_t)lon1_udeg : (uint32_t)lon1_udeg - (uint32_t)lon2_udeg;
+	if (*dlon >= 2 * UT_GEO_HALF_TURN_UDEG){
+		*dlon -= 2 * UT_GEO_HALF_TURN_UDEG;
+	}
+	if (*dlon > UT_GEO_HALF_TURN_UDEG){ //the short way round
+		*dlon = 2 * UT_GEO_HALF_TURN_UDEG - *dlon;
+	}
+	if (*dlat > UT_GEO_HALF_TURN_UDEG){ //only for latitudes past a pole
+		*dlat = UT_GEO_HALF_TURN_UDEG;
+	}
+}
+
+/**
+ * @brief Haversine of the central angle between two points, shifted up when small.
+ * With s = sin(dlat/2) and y = sin(dlon/2) sqrt(cos(lat1)cos(lat2)) the haversine is s^2 + y^2.
+ * Short distances make s and y tiny, so both are shifted up before squaring; the root and asin
+ * carry the shift and distances of a few metres keep their precision.
+ * @param cos_lat1 Cosine of lat1_udeg in Q30.
+ * @param cos_lat2 Cosine of lat2_udeg in Q30.
+ * @param shift Set to the shift applied to s and y.
+ * @param lat_term Set to s^2 times 4^shift in Q30.
+ * @return The haversine times 4^shift in Q30; below 2.0.
+ */
+static uint32_t ut_geo_haversine(int32_t lat1_udeg, int32_t lon1_udeg, uint32_t cos_lat1, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t cos_lat2,
+	uint8_t* shift, uint32_t* lat_term){
+	uint32_t dlat;
+	uint32_t dlon;
+	uint32_t s_lat;
+	uint32_t s_lon;
+	uint32_t y1;
+	uint32_t y2;
+
+	ut_geo_separation(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, &dlat, &dlon);
+	//a difference in microdegrees is its half angle in half microdegrees
+	s_lat = ut_geo_sin_half_udeg(dlat);
+	s_lon = ut_geo_sin_half_udeg(dlon);
+	*shift = 0;
+	while (((s_lat | s_lon) < UT_GEO_NORMALISED) && (*shift < 30)){ //before the cosines, to keep their product's bits
+		s_lat <<= 1;
+		s_lon <<= 1;
+		(*shift)++;
+	}
+	y1 = ut_geo_mul(s_lon, cos_lat1);
+	y2 = ut_geo_mul(s_lon, cos_lat2);
+	while (((s_lat | y1 | y2) < UT_GEO_NORMALISED) && (*shift < 30)){ //east-west near a pole
+		s_lat <<= 1;
+		y1 <<= 1;
+		y2 <<= 1;
+		(*shift)++;
+	}
+	*lat_term = ut_geo_mul(s_lat, s_lat);
+	return *lat_term + ut_geo_mul(y1, y2);
+}
+
+/**
+ * @brief Half the central angle, asin(sqrt(haversine)), for up to 90 degrees.
+ * asin(t) for t > 0.5 is pi/2 - 2 asin(sqrt((1 - t)/2)), which keeps the polynomial on 0 to 0.5.
+ * @param haversine The haversine times 4^shift in Q30, at most 0.5 unshifted.
+ * @param shift As returned by ut_geo_haversine().
+ * @param sine Set to sqrt(haversine), the sine of the half angle times 2^shift in Q30.
+ * @return The half angle times 2^shift in radians, Q30.
+ */
+static uint32_t ut_geo_half_angle(uint32_t haversine, uint8_t shift, uint32_t* sine){
+	uint32_t root;
+
+	*sine = ut_geo_sqrt_q27(haversine) << 3;
+	if ((*sine >> shift) > UT_GEO_Q30_ONE / 2){ //shift is 0 or 1 here
+		root = ut_geo_sqrt_q27((UT_GEO_Q30_ONE - (*sine >> shift)) >> 1) << 3;
+		return (UT_GEO_HALF_PI - 2 * ut_geo_asin_small(root, ut_geo_mul(root, root))) << shift;
+	}
+	return ut_geo_asin_small(*sine, (shift < 16) ? haversine >> (2 * shift) : 0);
+}
+
+/**
+ * @brief Angle between two nearby points on a plane tangent at their mean latitude.
+ * The north and east legs are dlat and dlon cos(mean latitude) in radians, each scaled by the
+ * ratio of its radius of curvature to the radius the result is multiplied with.
+ * @param dlat Latitude difference in microdegrees, below 2^20.
+ * @param dlon Longitude difference in microdegrees, below 2^20.
+ * @param cos_mid Cosine of the mean latitude in Q30.
+ * @param meridian North-south radius of curvature over the radius, Q30.
+ * @param parallel East-west radius of curvature over the radius, Q30.
+ * @param shift Set to the shift applied to the legs.
+ * @return The angle times 2^shift in radians, Q30.
+ */
+static uint32_t ut_geo_flat_angle(uint32_t dlat, uint32_t dlon, uint32_t cos_mid, uint32_t meridian, uint32_t parallel, uint8_t* shift){
+	uint32_t north = ut_geo_offset_radians(dlat * 2);
+	uint32_t east = ut_geo_offset_radians(dlon * 2);
+
+	*shift = 0;
+	while (((north | east) < UT_GEO_NORMALISED) && (*shift < 30)){
+		north <<= 1;
+		east <<= 1;
+		(*shift)++;
+	}
+	north = ut_geo_mul(north, meridian);
+	east = ut_geo_mul(ut_geo_mul(east, cos_mid), parallel);
+	while (((north | east) < UT_GEO_NORMALISED) && (*shift < 30)){ //east-west near a pole
+		north <<= 1;
+		east <<= 1;
+		(*shift)++;
+	}
+	return ut_geo_sqrt_q27(ut_geo_mul(north, north) + ut_geo_mul(east, east)) << 3;
+}
+
+/**
+ * @brief Cosine of the mean latitude from the cosines of the two latitudes.
+ * cos(lat1) + cos(lat2) = 2 cos(mean) cos(dlat/2), and 1/cos(dlat/2) = 1 + (dlat/2)^2/2 within
+ * 1e-11 inside UT_GEO_FLAT_LIMIT_UDEG.
+ * @param dlat Latitude difference in microdegrees, below 2^21.
+ * @return The cosine in Q30.
+ */
+static uint32_t ut_geo_mid_cos(uint32_t cos_lat1, uint32_t cos_lat2, uint32_t dlat){
+	uint32_t half = ut_geo_offset_radians(dlat); //dlat/2 in radians
+	uint32_t mean = (cos_lat1 + cos_lat2) >> 1;
+
+	return mean + ut_geo_mul(mean, ut_geo_mul(half, half) >> 1);
+}
+
+/**
+ * @brief Distance between two nearby points on the WGS-84 ellipsoid.
+ * @param dlat Latitude difference in microdegrees, within UT_GEO_FLAT_LIMIT_UDEG.
+ * @param dlon Longitude difference in microdegrees, within UT_GEO_FLAT_LIMIT_UDEG.
+ * @param cos_mid Cosine of the mean latitude in Q30.
+ * @param radius_dm Equatorial radius plus altitude in decimetres.
+ * @return The distance in decimetres.
+ */
+static uint32_t ut_geo_ellipsoid_flat_dm(uint32_t dlat, uint32_t dlon, uint32_t cos_mid, uint32_t radius_dm){
+	uint32_t sin2_mid = ut_geo_complement(ut_geo_mul(cos_mid, cos_mid));
+	uint8_t shift;
+	uint32_t angle = ut_geo_flat_angle(dlat, dlon, cos_mid,
+		ut_geo_poly(ut_geo_meridian_poly, sizeof(ut_geo_meridian_poly) / sizeof(ut_geo_meridian_poly[0]), sin2_mid),
+		ut_geo_poly(ut_geo_parallel_poly, sizeof(ut_geo_parallel_poly) / sizeof(ut_geo_parallel_poly[0]), sin2_mid), &shift);
+
+	return ut_geo_scale_dm(angle, shift, radius_dm);
+}
+
+/**
+ * @brief Great-circle distance from the haversine.
+ * Near the antipode the haversine approaches 1 and asin loses its precision, so past 90 degrees
+ * the distance is half the circumference less the distance to the antipode of the second point,
+ * whose latitude has the same cosine.
+ */
+static uint32_t ut_geo_great_circle_dm(int32_t lat1_udeg, int32_t lon1_udeg, uint32_t cos_lat1, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t cos_lat2,
+	uint32_t radius_dm){
+	uint8_t shift;
+	uint32_t lat_term;
+	uint32_t sine;
+	uint32_t haversine = ut_geo_haversine(lat1_udeg, lon1_udeg, cos_lat1, lat2_udeg, lon2_udeg, cos_lat2, &shift, &lat_term);
+
+	if (!shift && (haversine > UT_GEO_Q30_ONE / 2)){
+		haversine = ut_geo_haversine(lat1_udeg, lon1_udeg, cos_lat1, -lat2_udeg, lon2_udeg + UT_GEO_HALF_TURN_UDEG, cos_lat2, &shift, &lat_term);
+		return ut_geo_scale_dm(UT_GEO_HALF_PI - (ut_geo_half_angle(haversine, shift, &sine) >> shift), -1, radius_dm);
+	}
+	return ut_geo_scale_dm(ut_geo_half_angle(haversine, shift, &sine), shift - 1, radius_dm);
+}
+
+/**
+ * @brief Scale a sine term of the reduced latitude series to microdegrees.
+ * @param sine Sine in Q30.
+ * @param factor Coefficient in microdegrees, times 2^UT_GEO_REDUCED_SHIFT.
+ * @return The term in microdegrees, rounded.
+ */
+static int32_t ut_geo_reduced_term(int32_t sine, uint32_t factor){
+	uint32_t term = ut_geo_mul((sine < 0) ? -(uint32_t)sine : (uint32_t)sine, factor);
+
+	term = (term + (1UL << (UT_GEO_REDUCED_SHIFT - 1))) >> UT_GEO_REDUCED_SHIFT;
+	return (sine < 0) ? -(int32_t)term : (int32_t)term;
+}
+
+/**
+ * @brief Reduced latitude, atan((1 - f) tan(lat)), from its series in n = f/(2 - f).
+ * b = lat - n sin(2 lat) + n^2/2 sin(4 lat); the dropped terms are below 0.1 microdegree.
+ * @param lat_udeg Geodetic latitude in microdegrees.
+ * @return The reduced latitude in microdegrees.
+ */
+static int32_t ut_geo_reduced_lat(int32_t lat_udeg){
+	return lat_udeg - ut_geo_reduced_term(ut_geo_sin(2 * lat_udeg), UT_GEO_REDUCED_FIRST)
+		+ ut_geo_reduced_term(ut_geo_sin(4 * lat_udeg), UT_GEO_REDUCED_SECOND);
+}
+
+/**
+ * @brief Distance on the WGS-84 ellipsoid with Lambert's formula.
+ * On the sphere of reduced latitudes b1 and b2, with P and Q their half sum and half difference
+ * and w the half central angle with haversine S, the distance is
+ * 2a(w - f/2 ((w - sin w cos w) sin^2 P cos^2 Q / cos^2 w + (w + sin w cos w) cos^2 P sin^2 Q / S)).
+ * Past 90 degrees w is taken from the antipode as in ut_geo_great_circle_dm(); the antipode's
+ * haversine is cos^2 w and its latitude term sin^2 P, so their ratio keeps its precision there.
+ * @param reduced1 Reduced latitude of the first point in microdegrees.
+ * @param cos_reduced1 Its cosine in Q30.
+ * @param reduced2 Reduced latitude of the second point.
+ * @param cos_reduced2 Its cosine in Q30.
+ */
+static uint32_t ut_geo_lambert_dm(int32_t reduced1, int32_t lon1_udeg, uint32_t cos_reduced1, int32_t reduced2, int32_t lon2_udeg, uint32_t cos_reduced2,
+	uint32_t radius_dm){
+	int32_t sin_p;
+	uint8_t shift;
+	uint8_t antipode_shift;
+	uint32_t lat_term;
+	uint32_t antipode_lat_term;
+	uint32_t haversine = ut_geo_haversine(reduced1, lon1_udeg, cos_reduced1, reduced2, lon2_udeg, cos_reduced2, &shift, &lat_term);
+	uint32_t antipode;
+	uint32_t half;
+	uint32_t sine;
+	uint32_t cosine;
+	uint32_t sine_cosine;
+	uint32_t sin2_p;
+	uint32_t x_weight;
+	uint32_t correction;
+
+	if (!shift && (haversine > UT_GEO_Q30_ONE / 2)){
+		antipode = ut_geo_haversine(reduced1, lon1_udeg, cos_reduced1, -reduced2, lon2_udeg + UT_GEO_HALF_TURN_UDEG, cos_reduced2,
+			&antipode_shift, &antipode_lat_term);
+		half = UT_GEO_HALF_PI - (ut_geo_half_angle(antipode, antipode_shift, &cosine) >> antipode_shift);
+		cosine >>= antipode_shift; //cos w is the sine of the half angle to the antipode
+		sine = ut_geo_sqrt_q27(haversine) << 3;
+		sin2_p = (antipode_shift < 16) ? antipode_lat_term >> (2 * antipode_shift) : 0;
+		x_weight = ut_geo_div(antipode_lat_term, antipode);
+	} else {
+		half = ut_geo_half_angle(haversine, shift, &sine);
+		x_weight = ut_geo_complement((shift < 16) ? haversine >> (2 * shift) : 0); //cos^2 w, at least 0.5
+		cosine = ut_geo_sqrt_q27(x_weight) << 3;
+		sin_p = ut_geo_sin((reduced1 / 2) + (reduced2 / 2));
+		sin_p = (sin_p < 0) ? -sin_p : sin_p;
+		sin2_p = ut_geo_mul((uint32_t)sin_p, (uint32_t)sin_p);
+		x_weight = ut_geo_div(sin2_p, x_weight);
+	}
+	sine_cosine = ut_geo_mul(sine, cosine);
+	x_weight = ut_geo_mul(x_weight, ut_geo_complement((shift < 16) ? lat_term >> (2 * shift) : 0)); //times cos^2 Q
+	correction = ut_geo_mul(ut_geo_mul(UT_GEO_HALF_FLATTENING, (half > sine_cosine) ? half - sine_cosine : 0), x_weight)
+		+ ut_geo_mul(ut_geo_mul(UT_GEO_HALF_FLATTENING, half + sine_cosine),
+			ut_geo_mul(ut_geo_complement(sin2_p), ut_geo_div(lat_term, haversine)));
+	return ut_geo_scale_dm(half - correction, shift - 1, radius_dm);
+}
+
+
+//function definitions
+
+int32_t ut_geo_sin(int32_t angle_udeg){
+	int32_t angle = angle_udeg % (2 * UT_GEO_HALF_TURN_UDEG);
+	boolean_t negative = false;
+	uint32_t sine;
+
+	if (angle < 0){ //sin(-x) = -sin(x)
+		angle = -angle;
+		negative = true;
+	}
+	if (angle > UT_GEO_HALF_TURN_UDEG){ //sin(x) = -sin(x - 180)
+		angle -= UT_GEO_HALF_TURN_UDEG;
+		negative = !negative;
+	}
+	if (angle > UT_GEO_HALF_TURN_UDEG / 2){ //sin(x) = sin(180 - x)
+		angle = UT_GEO_HALF_TURN_UDEG - angle;
+	}
+	sine = ut_geo_sin_half_udeg((uint32_t)angle * 2);
+	return negative ? -(int32_t)sine : (int32_t)sine;
+}
+
+int32_t ut_geo_cos(int32_t angle_udeg){
+	int32_t angle = angle_udeg % (2 * UT_GEO_HALF_TURN_UDEG);
+
+	if (angle < 0){ //cos(-x) = cos(x)
+		angle = -angle;
+	}
+	return ut_geo_sin(UT_GEO_HALF_TURN_UDEG / 2 - angle); //cos(x) = sin(90 - x)
+}
+
+uint32_t ut_geo_distance_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t radius_dm){
+	return ut_geo_great_circle_dm(lat1_udeg, lon1_udeg, ut_geo_cos_lat(lat1_udeg), lat2_udeg, lon2_udeg, ut_geo_cos_lat(lat2_udeg), radius_dm);
+}
+
+uint32_t ut_geo_sphere_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t radius_dm){
+	uint8_t shift;
+	uint32_t dlat;
+	uint32_t dlon;
+	uint32_t angle;
+
+	ut_geo_separation(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, &dlat, &dlon);
+	if ((dlat > UT_GEO_FLAT_LIMIT_UDEG) || (dlon > UT_GEO_FLAT_LIMIT_UDEG)){
+		return ut_geo_distance_dm(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, radius_dm);
+	}
+	angle = ut_geo_flat_angle(dlat, dlon, ut_geo_cos_lat((lat1_udeg / 2) + (lat2_udeg / 2)), UT_GEO_Q30_ONE, UT_GEO_Q30_ONE, &shift);
+	return ut_geo_scale_dm(angle, shift, radius_dm);
+}
+
+/**
+ * @brief Distance on the WGS-84 ellipsoid.
+ *
+ * Nearby points use the flat approximation with the meridian and prime vertical radii of
+ * curvature at their mean latitude, the rest Lambert's formula. The altitude is added to the
+ * equatorial radius, which scales both radii of curvature alike.
+ */
+uint32_t ut_geo_wgs84_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, int32_t altitude_dm){
+	uint32_t radius_dm = (uint32_t)((int32_t)UT_GEO_WGS84_RADIUS_DM + altitude_dm);
+	uint32_t dlat;
+	uint32_t dlon;
+	int32_t reduced1;
+	int32_t reduced2;
+
+	ut_geo_separation(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, &dlat, &dlon);
+	if ((dlat > UT_GEO_FLAT_LIMIT_UDEG) || (dlon > UT_GEO_FLAT_LIMIT_UDEG)){
+		reduced1 = ut_geo_reduced_lat(lat1_udeg);
+		reduced2 = ut_geo_reduced_lat(lat2_udeg);
+		return ut_geo_lambert_dm(reduced1, lon1_udeg, ut_geo_cos_lat(reduced1), reduced2, lon2_udeg, ut_geo_cos_lat(reduced2), radius_dm);
+	}
+	return ut_geo_ellipsoid_flat_dm(dlat, dlon, ut_geo_cos_lat((lat1_udeg / 2) + (lat2_udeg / 2)), radius_dm);
+}
+
+uint32_t ut_geo_range_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, int32_t altitude_dm){
+#if UT_GEO_WGS84
+	return ut_geo_wgs84_dm(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, altitude_dm);
+#else
+	return ut_geo_sphere_dm(lat1_udeg, lon1_udeg, lat2_udeg, lon2_udeg, (uint32_t)((int32_t)UT_GEO_EARTH_RADIUS_DM + altitude_dm));
+#endif
+}
+
+void ut_geo_point_set(ut_geo_point_t* point, int32_t lat_udeg, int32_t lon_udeg){
+	point->lat_udeg = lat_udeg;
+	point->lon_udeg = lon_udeg;
+	point->cos_lat = ut_geo_cos_lat(lat_udeg);
+#if UT_GEO_WGS84
+	point->reduced_udeg = ut_geo_reduced_lat(lat_udeg);
+	point->cos_reduced = ut_geo_cos_lat(point->reduced_udeg);
+#endif
+}
+
+/**
+ * @brief Distance between two points with the model chosen by UT_GEO_WGS84, from their cached values.
+ *
+ * The same paths as ut_geo_sphere_dm() and ut_geo_wgs84_dm(), except that the flat path takes the
+ * cosine of the mean latitude from the two cached cosines instead of the tables.
+ */
+uint32_t ut_geo_point_range_dm(const ut_geo_point_t* from, const ut_geo_point_t* to, int32_t altitude_dm){
+	uint32_t dlat;
+	uint32_t dlon;
+	uint32_t cos_mid;
+#if UT_GEO_WGS84
+	uint32_t radius_dm = (uint32_t)((int32_t)UT_GEO_WGS84_RADIUS_DM + altitude_dm);
+#else
+	uint32_t radius_dm = (uint32_t)((int32_t)UT_GEO_EARTH_RADIUS_DM + altitude_dm);
+	uint8_t shift;
+	uint32_t angle;
+#endif
+
+	ut_geo_separation(from->lat_udeg, from->lon_udeg, to->lat_udeg, to->lon_udeg, &dlat, &dlon);
+	if ((dlat > UT_GEO_FLAT_LIMIT_UDEG) || (dlon > UT_GEO_FLAT_LIMIT_UDEG)){
+#if UT_GEO_WGS84
+		return ut_geo_lambert_dm(from->reduced_udeg, from->lon_udeg, from->cos_reduced, to->reduced_udeg, to->lon_udeg, to->cos_reduced, radius_dm);
+#else
+		return ut_geo_great_circle_dm(from->lat_udeg, from->lon_udeg, from->cos_lat, to->lat_udeg, to->lon_udeg, to->cos_lat, radius_dm);
+#endif
+	}
+	cos_mid = ut_geo_mid_cos(from->cos_lat, to->cos_lat, dlat);
+#if UT_GEO_WGS84
+	return ut_geo_ellipsoid_flat_dm(dlat, dlon, cos_mid, radius_dm);
+#else
+	angle = ut_geo_flat_angle(dlat, dlon, cos_mid, UT_GEO_Q30_ONE, UT_GEO_Q30_ONE, &shift);
+	return ut_geo_scale_dm(angle, shift, radius_dm);
+#endif
+}
+
+/**
+ * @brief Initial great-circle bearing from one point to another.
+ *
+ * Nearby points take the direction of the north and east legs of the flat path. Farther ones use
+ * atan2(sin(dlon) cos(lat2), cos(lat1) sin(lat2) - sin(lat1) cos(lat2) cos(dlon)), with the second
+ * component rewritten as sin(dlat) + sin(lat1) cos(lat2) (1 - cos(dlon)) so that it does not
+ * cancel; both are halved to keep their sum in range.
+ */
+uint16_t ut_geo_bearing_cdeg(const ut_geo_point_t* from, const ut_geo_point_t* to){
+	int32_t dlat_udeg = to->lat_udeg - from->lat_udeg;
+	int32_t dlon_udeg = to->lon_udeg - from->lon_udeg;
+	boolean_t west = (dlon_udeg < 0);
+	uint32_t dlat = (dlat_udeg < 0) ? -(uint32_t)dlat_udeg : (uint32_t)dlat_udeg;
+	uint32_t dlon = west ? -(uint32_t)dlon_udeg : (uint32_t)dlon_udeg;
+	uint32_t north;
+	uint32_t east;
+	uint32_t s_lon;
+	int32_t sin_lat1;
+	int32_t term;
+	int32_t x;
+
+	if (dlon > UT_GEO_HALF_TURN_UDEG){ //the short way round
+		dlon = 2 * UT_GEO_HALF_TURN_UDEG - dlon;
+		west = !west;
+	}
+	if ((dlat <= UT_GEO_FLAT_LIMIT_UDEG) && (dlon <= UT_GEO_FLAT_LIMIT_UDEG)){
+		north = dlat; //the direction needs the legs' ratio only, so they stay in microdegrees
+		east = dlon;
+		while (((north | east) < UT_GEO_NORMALISED) && (north | east)){
+			north <<= 1;
+			east <<= 1;
+		}
+		east = ut_geo_mul(east, ut_geo_mid_cos(from->cos_lat, to->cos_lat, dlat));
+		return ut_geo_direction_cdeg(north, dlat_udeg < 0, east, west);
+	}
+	east = ut_geo_mul((uint32_t)ut_geo_sin((int32_t)dlon), to->cos_lat) >> 1;
+	s_lon = ut_geo_sin_half_udeg(dlon); //sin(dlon/2); 1 - cos(dlon) = 2 sin^2(dlon/2)
+	sin_lat1 = ut_geo_sin(from->lat_udeg);
+	term = (int32_t)ut_geo_mul(ut_geo_mul((sin_lat1 < 0) ? -(uint32_t)sin_lat1 : (uint32_t)sin_lat1, to->cos_lat), ut_geo_mul(s_lon, s_lon));
+	x = (ut_geo_sin(dlat_udeg) >> 1) + ((sin_lat1 < 0) ? -term : term);
+	return ut_geo_direction_cdeg((x < 0) ? -(uint32_t)x : (uint32_t)x, x < 0, east, west);
+}
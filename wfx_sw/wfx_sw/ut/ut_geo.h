@@ -0,0 +1,146 @@
+/**
+ * @file ut_geo.h
+ * @brief Header file for the fixed-point geodesy of the utilities CSC.
+ *
+ * This file provides declarations for sine, cosine and distances on integer microdegrees.
+ * Results are Q30 fractions (1.0 is UT_GEO_Q30_ONE) computed with 16x16 bit multiplies and
+ * PROGMEM tables, so no soft-float or libm code is needed on the AVR. The module builds unchanged
+ * with a native compiler for host tools.
+ *
+ * Costs below are given in 16x16 bit multiplies and shift-subtract steps (square roots and
+ * divisions), counted from the code; they take most of the time. No cycle counts have been
+ * taken on the ATmega328p yet, tools/ut_geo_bench/ut_geo_bench_avr.c is the harness for them.
+ */
+
+#ifndef UT_GEO_H_
+#define UT_GEO_H_
+
+#include "ut_types.h"
+
+#ifndef UT_GEO_WGS84
+#define UT_GEO_WGS84 0 /**< 1: ut_geo_range_dm() measures on the WGS-84 ellipsoid, 0: on the RADIUS_OF_EARTH sphere */
+#endif
+
+#define UT_GEO_Q30_ONE 1073741824UL /**< 1.0 in Q30 */
+#define UT_GEO_EARTH_RADIUS_DM 63710000UL /**< RADIUS_OF_EARTH in decimetres */
+#define UT_GEO_WGS84_RADIUS_DM 63781370UL /**< WGS-84 equatorial radius in decimetres */
+#define UT_GEO_FLAT_LIMIT_UDEG 200000UL /**< Points closer than this in latitude and in longitude are measured on a flat approximation */
+
+/**
+ * @brief A point with the values every distance to it needs, filled by ut_geo_point_set().
+ */
+typedef struct {
+	int32_t lat_udeg;       /**< Latitude in microdegrees, negative south */
+	int32_t lon_udeg;       /**< Longitude in microdegrees, negative west */
+	uint32_t cos_lat;       /**< Cosine of the latitude in Q30 */
+#if UT_GEO_WGS84
+	int32_t reduced_udeg;   /**< Reduced latitude in microdegrees */
+	uint32_t cos_reduced;   /**< Cosine of the reduced latitude in Q30 */
+#endif
+} ut_geo_point_t;
+
+/**
+ * @brief Sine of an angle.
+ * @param angle_udeg Angle in microdegrees, any value.
+ * @return The sine in Q30, within 2e-8 of the exact value.
+ */
+int32_t ut_geo_sin(int32_t angle_udeg);
+
+/**
+ * @brief Cosine of an angle.
+ * @param angle_udeg Angle in microdegrees, any value.
+ * @return The cosine in Q30, within 2e-8 of the exact value.
+ */
+int32_t ut_geo_cos(int32_t angle_udeg);
+
+/**
+ * @brief Great-circle distance between two points with the haversine formula.
+ * Against a double precision haversine on the same sphere the error stays below 0.2m plus 2e-7
+ * of the distance, under 1m anywhere on the globe, see tools/ut_geo_bench. Costs 136 multiplies
+ * and 28 steps, up to twice that past 90 degrees.
+ * @param lat1_udeg Latitude of the first point in microdegrees, negative south.
+ * @param lon1_udeg Longitude of the first point in microdegrees, negative west.
+ * @param lat2_udeg Latitude of the second point.
+ * @param lon2_udeg Longitude of the second point.
+ * @param radius_dm Radius of the sphere in decimetres, below 2^27 (13000km).
+ * @return The distance in decimetres.
+ */
+uint32_t ut_geo_distance_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t radius_dm);
+
+/**
+ * @brief Distance between two points on a sphere, picking the method by their separation.
+ * Points within UT_GEO_FLAT_LIMIT_UDEG in latitude and longitude are measured on the plane
+ * tangent at their mean latitude with 51 multiplies and 28 steps, within 0.1m of the double
+ * precision great circle; the rest go to ut_geo_distance_dm().
+ * @param lat1_udeg Latitude of the first point in microdegrees, negative south.
+ * @param lon1_udeg Longitude of the first point in microdegrees, negative west.
+ * @param lat2_udeg Latitude of the second point.
+ * @param lon2_udeg Longitude of the second point.
+ * @param radius_dm Radius of the sphere in decimetres, below 2^27 (13000km).
+ * @return The distance in decimetres.
+ */
+uint32_t ut_geo_sphere_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, uint32_t radius_dm);
+
+/**
+ * @brief Distance between two points on the WGS-84 ellipsoid.
+ * Points within UT_GEO_FLAT_LIMIT_UDEG are measured on the tangent plane with the radii of
+ * curvature of their mean latitude, with 72 multiplies and 28 steps, within 0.1m of Vincenty's
+ * formula. The rest use Lambert's formula, with 300 multiplies and 118 steps, within 0.3m plus
+ * 1.5e-6 of the distance up to 90 degrees of arc (10000km); past that its error grows to 200m at
+ * 150 degrees and 6km near the antipode. The sphere is off by up to 38km.
+ * @param lat1_udeg Geodetic latitude of the first point in microdegrees, negative south.
+ * @param lon1_udeg Longitude of the first point in microdegrees, negative west.
+ * @param lat2_udeg Geodetic latitude of the second point.
+ * @param lon2_udeg Longitude of the second point.
+ * @param altitude_dm Common height above the ellipsoid in decimetres.
+ * @return The distance in decimetres.
+ */
+uint32_t ut_geo_wgs84_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, int32_t altitude_dm);
+
+/**
+ * @brief Distance between two points with the model chosen by UT_GEO_WGS84.
+ * @param lat1_udeg Latitude of the first point in microdegrees, negative south.
+ * @param lon1_udeg Longitude of the first point in microdegrees, negative west.
+ * @param lat2_udeg Latitude of the second point.
+ * @param lon2_udeg Longitude of the second point.
+ * @param altitude_dm Common altitude of the points in decimetres.
+ * @return The distance in decimetres.
+ */
+uint32_t ut_geo_range_dm(int32_t lat1_udeg, int32_t lon1_udeg, int32_t lat2_udeg, int32_t lon2_udeg, int32_t altitude_dm);
+
+/**
+ * @brief Fill a point and the values ut_geo_point_range_dm() takes from it.
+ * Costs 25 multiplies, 137 with UT_GEO_WGS84.
+ * @param point Point to fill.
+ * @param lat_udeg Latitude in microdegrees, negative south.
+ * @param lon_udeg Longitude in microdegrees, negative west.
+ */
+void ut_geo_point_set(ut_geo_point_t* point, int32_t lat_udeg, int32_t lon_udeg);
+
+/**
+ * @brief Distance between two points filled by ut_geo_point_set(), with the model chosen by UT_GEO_WGS84.
+ * Same paths and bounds as ut_geo_range_dm(), without the cosines and reduced latitudes of the
+ * points: 36 multiplies on the sphere's flat path and 86 on the haversine, 57 on the ellipsoid's
+ * flat path and 138 with Lambert's formula.
+ * @param from First point.
+ * @param to Second point.
+ * @param altitude_dm Common altitude of the points in decimetres.
+ * @return The distance in decimetres.
+ */
+uint32_t ut_geo_point_range_dm(const ut_geo_point_t* from, const ut_geo_point_t* to, int32_t altitude_dm);
+
+/**
+ * @brief Initial great-circle bearing from one point to another, clockwise from true north.
+ * Within 0.05 degree of the double precision bearing on the sphere, 34 multiplies and 62 steps
+ * for points within UT_GEO_FLAT_LIMIT_UDEG and 133 and 62 beyond. Nearby points get the bearing
+ * at their mean latitude, which turns it by up to dlon sin(lat)/2, 0.1 degree at most. Within
+ * 0.02 degree (2km) of a pole, points beyond the limit in longitude are only metres apart and
+ * their bearing is within 0.11 degree. The ellipsoid turns bearings by up to 0.2 degrees; see
+ * tools/ut_geo_bench for the checks.
+ * @param from Starting point, filled by ut_geo_point_set().
+ * @param to Destination, filled by ut_geo_point_set().
+ * @return The bearing in hundredths of a degree, 0 to 35999; 0 when the points coincide.
+ */
+uint16_t ut_geo_bearing_cdeg(const ut_geo_point_t* from, const ut_geo_point_t* to);
+
+#endif /* UT_GEO_H_ */
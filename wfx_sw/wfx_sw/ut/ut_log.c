@@ -0,0 +1,260 @@
+/**
+ * @file ut_log.c
+ * @brief Journaled EEPROM storage of the memory locations of the utilities CSC, see ut_log.h.
+ *
+ * The RAM index holds the ring position of the newest SAVE entry of every memory location. An
+ * entry is live while the index points at it; the head steps over live entries and writes the
+ * first other one. With fewer locations than entries there is always one to write, and every
+ * older entry a CLEAR or RESET hides lies somewhere the head reaches before it comes back to
+ * the CLEAR or RESET, so hidden entries are overwritten before the entry hiding them.
+ */
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <util/crc16.h>
+#include "ut_eeq.h"
+#endif
+#include <stddef.h>
+#include "ut_log.h"
+
+//defines
+#define UT_LOG_SEQ_OFFSET 0 /**< First byte of the sequence number in an entry */
+#define UT_LOG_TAG_OFFSET 2 /**< Byte holding the kind and memory index of an entry */
+#define UT_LOG_FIELDS_OFFSET 3 /**< First byte of the ut_wpt.h record fields in an entry */
+#define UT_LOG_CRC_OFFSET (UT_LOG_ENTRY_SIZE - 2) /**< First byte of the CRC of the rest of an entry */
+#define UT_LOG_NEWER(a, b) ((int16_t)((a) - (b)) > 0) /**< Sequence number a was written after b */
+#define UT_LOG_MAX_AGE ((uint16_t)UT_LOG_SLOTS * UT_LOG_ENTRIES) /**< Appends after which a live entry is moved, about one move per turn of the head when every location is in use */
+#define UT_LOG_KIND_SHIFT 6
+#define UT_LOG_INDEX_MASK 0x3F
+#define UT_LOG_TAG(kind, index) ((uint8_t)(((kind) << UT_LOG_KIND_SHIFT) | (index)))
+#define UT_LOG_FILL 0xFF /**< Field bytes of a CLEAR or RESET entry, as erased EEPROM */
+
+#if defined(E2END) && ((UT_LOG_EEPROM_SIZE) > (E2END + 1))
+#error "UT_LOG_EEPROM_SIZE is larger than the EEPROM"
+#endif
+#if (UT_LOG_SLOTS >= UT_LOG_ENTRIES) || (UT_LOG_SLOTS > UT_LOG_INDEX_MASK + 1)
+#error "UT_LOG_SLOTS must be below UT_LOG_ENTRIES and fit the tag"
+#endif
+
+//local static
+static uint8_t slot_entry[UT_LOG_SLOTS]; /**< Ring position of the newest SAVE entry of each memory location, or UT_LOG_NONE */
+static uint16_t slot_seq[UT_LOG_SLOTS]; /**< Sequence number of the entry in slot_entry, so ut_log_level() finds the oldest without reading EEPROM */
+static uint8_t head; /**< Ring position the next entry is written at, unless it is live */
+static uint16_t next_seq; /**< Sequence number of the next entry */
+
+//local function definitions
+/**
+ * @brief CRC-16 of the bytes of an entry before its CRC, as _crc_ccitt_update() of avr-libc from 0xFFFF.
+ */
+static uint16_t ut_log_crc16(const uint8_t* entry){
+	uint16_t crc = 0xFFFF;
+
+	for (uint8_t i = 0; i < UT_LOG_CRC_OFFSET; i++){
+#ifdef __AVR__
+		crc = _crc_ccitt_update(crc, entry[i]);
+#else
+		uint8_t data = entry[i] ^ (uint8_t)crc;
+
+		data ^= (uint8_t)(data << 4);
+		crc = ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4) ^ ((uint16_t)data << 3));
+#endif
+	}
+	return crc;
+}
+
+/**
+ * @brief Reads the entry at a ring position.
+ * @return true if its CRC matches.
+ */
+static boolean_t ut_log_read_entry(uint8_t pos, uint8_t* entry){
+	ut_log_eeprom_read(entry, UT_LOG_START + (uint16_t)pos * UT_LOG_ENTRY_SIZE, UT_LOG_ENTRY_SIZE);
+	return ut_log_crc16(entry) == (entry[UT_LOG_CRC_OFFSET] | ((uint16_t)entry[UT_LOG_CRC_OFFSET + 1] << 8));
+}
+
+/**
+ * @brief Sequence number of an entry.
+ */
+static uint16_t ut_log_seq(const uint8_t* entry){
+	return entry[UT_LOG_SEQ_OFFSET] | ((uint16_t)entry[UT_LOG_SEQ_OFFSET + 1] << 8);
+}
+
+/**
+ * @brief Whether the RAM index points at a ring position.
+ */
+static boolean_t ut_log_is_live(uint8_t pos){
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		if (slot_entry[index] == pos){
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Appends an entry at the first ring position from the head that is not live.
+ * @param tag Kind and memory index.
+ * @param fields UT_WPT_CRC_OFFSET bytes of a ut_wpt.h record, or NULL for UT_LOG_FILL.
+ * @return The ring position written; its sequence number is next_seq - 1.
+ */
+static uint8_t ut_log_append(uint8_t tag, const uint8_t* fields){
+	uint8_t entry[UT_LOG_ENTRY_SIZE];
+	uint8_t pos;
+	uint16_t crc;
+
+	while (ut_log_is_live(head)){
+		head = (head + 1) % UT_LOG_ENTRIES;
+	}
+	pos = head;
+	if (fields != NULL){
+		for (uint8_t i = 0; i < UT_WPT_CRC_OFFSET; i++){
+			entry[UT_LOG_FIELDS_OFFSET + i] = fields[i];
+		}
+	} else {
+		for (uint8_t i = 0; i < UT_WPT_CRC_OFFSET; i++){
+			entry[UT_LOG_FIELDS_OFFSET + i] = UT_LOG_FILL;
+		}
+	}
+	entry[UT_LOG_SEQ_OFFSET] = (uint8_t)next_seq;
+	entry[UT_LOG_SEQ_OFFSET + 1] = (uint8_t)(next_seq >> 8);
+	entry[UT_LOG_TAG_OFFSET] = tag;
+	crc = ut_log_crc16(entry);
+	entry[UT_LOG_CRC_OFFSET] = (uint8_t)crc;
+	entry[UT_LOG_CRC_OFFSET + 1] = (uint8_t)(crc >> 8);
+	ut_log_eeprom_write(entry, UT_LOG_START + (uint16_t)pos * UT_LOG_ENTRY_SIZE, UT_LOG_ENTRY_SIZE);
+	next_seq++;
+	head = (head + 1) % UT_LOG_ENTRIES;
+	return pos;
+}
+
+/**
+ * @brief Moves the oldest live entry to the head once it is UT_LOG_MAX_AGE appends old.
+ * Its cell then joins the rotation; without this a location saved once would hold its cell forever
+ * while the others wear. It also keeps every entry within a few thousand sequence numbers of the
+ * newest, so UT_LOG_NEWER() orders them across the wrap of the 16 bit numbers. The age comes from
+ * the sequence numbers in EEPROM, copied to slot_seq by ut_log_init(), so a reset of the device
+ * does not skip a move. Only the entry moved is read.
+ */
+static void ut_log_level(){
+	uint8_t entry[UT_LOG_ENTRY_SIZE];
+	uint8_t oldest = UT_LOG_NONE;
+
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		if ((slot_entry[index] != UT_LOG_NONE) && ((oldest == UT_LOG_NONE) || UT_LOG_NEWER(slot_seq[oldest], slot_seq[index]))){
+			oldest = index;
+		}
+	}
+	if ((oldest != UT_LOG_NONE) && ((uint16_t)(next_seq - slot_seq[oldest]) > UT_LOG_MAX_AGE)){
+		ut_log_read_entry(slot_entry[oldest], entry);
+		slot_entry[oldest] = ut_log_append(UT_LOG_TAG(UT_LOG_KIND_SAVE, oldest), entry + UT_LOG_FIELDS_OFFSET);
+		slot_seq[oldest] = next_seq - 1;
+	}
+}
+
+//function definitions
+#ifdef __AVR__
+void ut_log_eeprom_read(void* dst, uint16_t address, uint8_t count){
+	ut_eeq_read(dst, address, count);
+}
+
+void ut_log_eeprom_write(const void* src, uint16_t address, uint8_t count){
+	ut_eeq_write(src, address, count);
+}
+#endif
+
+void ut_log_init(void){
+	uint8_t entry[UT_LOG_ENTRY_SIZE];
+	uint8_t newest = UT_LOG_NONE;
+	uint16_t newest_seq = 0;
+	boolean_t reset = false;
+	uint16_t reset_seq = 0;
+
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		slot_entry[index] = UT_LOG_NONE;
+	}
+
+	//newest entry and newest RESET
+	for (uint8_t pos = 0; pos < UT_LOG_ENTRIES; pos++){
+		if (ut_log_read_entry(pos, entry)){
+			uint16_t seq = ut_log_seq(entry);
+
+			if ((newest == UT_LOG_NONE) || UT_LOG_NEWER(seq, newest_seq)){
+				newest = pos;
+				newest_seq = seq;
+			}
+			if (((entry[UT_LOG_TAG_OFFSET] >> UT_LOG_KIND_SHIFT) == UT_LOG_KIND_RESET) && (!reset || UT_LOG_NEWER(seq, reset_seq))){
+				reset = true;
+				reset_seq = seq;
+			}
+		}
+	}
+
+	//newest SAVE or CLEAR of each location after it; the index is the only place to keep them, so a CLEAR goes there first
+	for (uint8_t pos = 0; pos < UT_LOG_ENTRIES; pos++){
+		if (ut_log_read_entry(pos, entry) && (!reset || UT_LOG_NEWER(ut_log_seq(entry), reset_seq))){
+			uint8_t kind = entry[UT_LOG_TAG_OFFSET] >> UT_LOG_KIND_SHIFT;
+			uint8_t index = entry[UT_LOG_TAG_OFFSET] & UT_LOG_INDEX_MASK;
+			uint16_t seq = ut_log_seq(entry);
+
+			if (((kind == UT_LOG_KIND_SAVE) || (kind == UT_LOG_KIND_CLEAR)) && (index < UT_LOG_SLOTS)){
+				if ((slot_entry[index] == UT_LOG_NONE) || UT_LOG_NEWER(seq, slot_seq[index])){
+					slot_entry[index] = pos;
+					slot_seq[index] = seq;
+				}
+			}
+		}
+	}
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		if ((slot_entry[index] != UT_LOG_NONE) && ut_log_read_entry(slot_entry[index], entry)
+				&& ((entry[UT_LOG_TAG_OFFSET] >> UT_LOG_KIND_SHIFT) == UT_LOG_KIND_CLEAR)){
+			slot_entry[index] = UT_LOG_NONE;
+		}
+	}
+
+	head = (newest == UT_LOG_NONE) ? 0 : (uint8_t)((newest + 1) % UT_LOG_ENTRIES);
+	next_seq = newest_seq + 1;
+}
+
+boolean_t ut_log_read(uint8_t index, ut_wpt_t* wpt){
+	uint8_t entry[UT_LOG_ENTRY_SIZE];
+
+	if ((slot_entry[index] == UT_LOG_NONE) || !ut_log_read_entry(slot_entry[index], entry)){
+		return false;
+	}
+	ut_wpt_decode(entry + UT_LOG_FIELDS_OFFSET, wpt);
+	return true;
+}
+
+void ut_log_save(uint8_t index, const ut_wpt_t* wpt){
+	uint8_t fields[UT_WPT_CRC_OFFSET];
+
+	ut_wpt_encode(wpt, fields);
+	//the previous entry stays live until the new one is written
+	slot_entry[index] = ut_log_append(UT_LOG_TAG(UT_LOG_KIND_SAVE, index), fields);
+	slot_seq[index] = next_seq - 1;
+	ut_log_level();
+}
+
+void ut_log_clear(uint8_t index){
+	if (slot_entry[index] == UT_LOG_NONE){
+		return;
+	}
+	ut_log_append(UT_LOG_TAG(UT_LOG_KIND_CLEAR, index), NULL);
+	slot_entry[index] = UT_LOG_NONE;
+	ut_log_level();
+}
+
+void ut_log_reset(void){
+	boolean_t in_use = false;
+
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		in_use |= (slot_entry[index] != UT_LOG_NONE);
+	}
+	if (!in_use){
+		return;
+	}
+	ut_log_append(UT_LOG_TAG(UT_LOG_KIND_RESET, 0), NULL);
+	for (uint8_t index = 0; index < UT_LOG_SLOTS; index++){
+		slot_entry[index] = UT_LOG_NONE;
+	}
+	ut_log_level();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file ut_log.h
+ * @brief Header file for the journaled EEPROM storage of the memory locations of the utilities CSC.
+ *
+ * The EEPROM is a ring of UT_LOG_ENTRIES entries and every change appends one: a waypoint saved
+ * to a memory location, a CLEAR of one location or a RESET of all of them. Entries are written
+ * at the head of the ring, which moves one entry per append and steps over the entries still
+ * holding a saved location, so no live entry is ever overwritten and a write cut short by a
+ * power loss only loses itself. Every cell of the ring is written in turn; the oldest live entry
+ * is moved to the head once it is UT_LOG_SLOTS turns of the head old, so locations saved long
+ * ago do not keep their cells out of the rotation.
+ *
+ * Entry layout, UT_LOG_ENTRY_SIZE bytes at UT_LOG_START + n * UT_LOG_ENTRY_SIZE:
+ *   bytes 0..1    sequence number, 16 bit little endian, one more than the entry before
+ *   byte 2        tag: UT_LOG_KIND_* in the top 2 bits, memory index in the low 6
+ *   bytes 3..17   bytes 0..14 of the ut_wpt.h record of the location; 0xFF in CLEAR and RESET
+ *   bytes 18..19  CRC-16 of bytes 0..17, CCITT polynomial as _crc_ccitt_update(), little endian
+ * Entries with a bad CRC, erased EEPROM and writes cut short included, are ignored; the CRC-16
+ * lets through one torn entry in 65536 where a CRC-8 would let through one in 256.
+ * ut_log_init() rebuilds the RAM index from the newest entry of each location, in two reads of
+ * the ring; a RESET hides every older entry. Sequence numbers wrap and are compared by their
+ * difference, which stays small as no entry survives long without being moved.
+ *
+ * The module builds unchanged with a native compiler; host tools supply ut_log_eeprom_read()
+ * and ut_log_eeprom_write(), see tools/ut_log_bench.
+ */
+
+#ifndef UT_LOG_H_
+#define UT_LOG_H_
+
+#include "ut_types.h"
+#include "ut_wpt.h"
+
+#define UT_LOG_START 0x0000 /**< EEPROM address of the first entry */
+#define UT_LOG_EEPROM_SIZE 1024 /**< Bytes of EEPROM on the ATmega328p */
+#define UT_LOG_ENTRY_SIZE 20 /**< Bytes per entry */
+#define UT_LOG_ENTRIES ((UT_LOG_EEPROM_SIZE - UT_LOG_START) / UT_LOG_ENTRY_SIZE) /**< Entries in the ring, 51 */
+#define UT_LOG_SLOTS 40 /**< Memory locations, fewer than UT_LOG_ENTRIES so the head always finds a free entry */
+#define UT_LOG_NONE 0xFF /**< Entry of a memory location not in use */
+
+#define UT_LOG_KIND_SAVE 0 /**< Entry holds a saved waypoint */
+#define UT_LOG_KIND_CLEAR 1 /**< Entry clears one memory location */
+#define UT_LOG_KIND_RESET 2 /**< Entry clears every memory location */
+
+/**
+ * @brief Reads EEPROM for the log; ut_eeq_read() on the AVR, which sees the writes still queued.
+ * @param dst Destination.
+ * @param address EEPROM address.
+ * @param count Bytes to read.
+ */
+void ut_log_eeprom_read(void* dst, uint16_t address, uint8_t count);
+
+/**
+ * @brief Writes EEPROM for the log; ut_eeq_write() on the AVR, which queues the write and skips the bytes that already match.
+ * @param src Source.
+ * @param address EEPROM address.
+ * @param count Bytes to write.
+ */
+void ut_log_eeprom_write(const void* src, uint16_t address, uint8_t count);
+
+/**
+ * @brief Rebuilds the RAM index from the entries in EEPROM and finds the head.
+ * Reads every entry once, about UT_LOG_ENTRIES * UT_LOG_ENTRY_SIZE bytes.
+ */
+void ut_log_init(void);
+
+/**
+ * @brief Reads the waypoint saved in a memory location, one entry read through the RAM index.
+ * @param index Memory index, below UT_LOG_SLOTS.
+ * @param wpt Set to the waypoint when the location is in use.
+ * @return true if the location is in use.
+ */
+boolean_t ut_log_read(uint8_t index, ut_wpt_t* wpt);
+
+/**
+ * @brief Saves a waypoint to a memory location, appending one entry, two when an old entry is moved.
+ * @param index Memory index, below UT_LOG_SLOTS.
+ * @param wpt Waypoint to save.
+ */
+void ut_log_save(uint8_t index, const ut_wpt_t* wpt);
+
+/**
+ * @brief Clears a memory location, appending one entry if it was in use, and another when an old entry is moved.
+ * @param index Memory index, below UT_LOG_SLOTS.
+ */
+void ut_log_clear(uint8_t index);
+
+/**
+ * @brief Clears every memory location, appending a single entry if any was in use.
+ */
+void ut_log_reset(void);
+
+#endif /* UT_LOG_H_ */
@@ -0,0 +1,543 @@
+/**
+ * @file ut_store.c
+ * @brief Waypoint store of the utilities CSC, see ut_store.h.
+ *
+ * A search turns its radius into a latitude and longitude box, split in two at the antimeridian.
+ * The keys inside a box all lie between the keys of its south-west and north-east corners, so
+ * each part is one run of keys, found through the index and read in order. When a waypoint of
+ * the run is outside the box the scan jumps to BIGMIN, the smallest key above it that is inside
+ * again (Tropf and Herzog, 1981), so the sectors between are not read. Waypoints in the box are
+ * ranged, the rest only cost their coordinates. The box is sized for the WGS-84 ellipsoid as
+ * well as the sphere, so it holds every waypoint within the radius whichever model
+ * ut_geo_point_range_dm() is built with.
+ */
+
+#include "ut_store.h"
+
+//defines
+#define UT_STORE_KEY_BITS 16 /**< Bits per axis in a key */
+#define UT_STORE_LAT_BITS 0xAAAAAAAAUL /**< Key bits holding the latitude step */
+#define UT_STORE_LON_BITS 0x55555555UL /**< Key bits holding the longitude step */
+#define UT_STORE_STEP_MAX 0xFFFFU /**< Largest latitude or longitude step */
+#define UT_STORE_QUARTER_TURN_UDEG 90000000L /**< 90 degrees in microdegrees */
+#define UT_STORE_HALF_TURN_UDEG 180000000L /**< 180 degrees in microdegrees */
+#define UT_STORE_TURN_UDEG 360000000L /**< 360 degrees in microdegrees */
+#define UT_STORE_CHUNK 4 /**< Records whose coordinates are read per call */
+#define UT_STORE_COS_SHIFT 20 /**< Q30 cosine to the Q10 the longitude span is divided by */
+#define UT_STORE_COS_ONE (1UL << (30 - UT_STORE_COS_SHIFT)) /**< 1.0 in Q10 */
+#define UT_STORE_NO_SECTOR 0xFFFFFFFFUL /**< last_sector before the first read */
+#define UT_STORE_NO_KEY 0xFFFFFFFFUL /**< Key returned by a failed read, which ends any scan */
+#define UT_STORE_NEAREST_START_DM 50000UL /**< Radius of the first search for the nearest waypoints, 5km */
+#define UT_STORE_NEAREST_GROWTH 8 /**< Factor the radius grows by while too few waypoints are found */
+
+/**
+ * @brief State of one search.
+ */
+typedef struct {
+	const ut_geo_point_t* from; /**< Query position */
+	int32_t altitude_dm;        /**< Altitude of the query position */
+	uint32_t radius_dm;         /**< Largest distance kept */
+	int32_t lat_min;            /**< Box south edge in microdegrees */
+	int32_t lat_max;            /**< Box north edge in microdegrees */
+	uint32_t lon_span;          /**< Box half width in microdegrees, UT_STORE_TURN_UDEG for all longitudes */
+	uint32_t key_min;           /**< Key of the south-west corner of the part being read */
+	uint32_t key_max;           /**< Key of its north-east corner */
+	ut_store_hit_t* hits;       /**< Nearest waypoints found, nearest first */
+	uint8_t max_hits;           /**< Entries available in hits */
+	uint8_t count;              /**< Entries used in hits */
+} ut_store_search_t;
+
+//local function definitions
+/**
+ * @brief Reads part of a sector and counts the sector if the previous read was elsewhere.
+ */
+static boolean_t ut_store_read(ut_store_t* store, void* dst, uint32_t sector, uint16_t offset, uint16_t count){
+	if (sector != store->last_sector){
+		store->last_sector = sector;
+		store->sector_reads++;
+	}
+	return store->read(dst, sector, offset, count);
+}
+
+/**
+ * @brief Reads the key of a record.
+ * @param sector Data sector, counted from the first one.
+ * @return The key, or UT_STORE_NO_KEY if the read fails.
+ */
+static uint32_t ut_store_read_key(ut_store_t* store, uint16_t sector, uint8_t slot){
+	uint32_t key;
+
+	if (!ut_store_read(store, &key, 1UL + store->index_sectors + sector, slot * UT_STORE_COORD_SIZE, sizeof(key))){
+		return UT_STORE_NO_KEY;
+	}
+	return key;
+}
+
+/**
+ * @brief Interleaves a latitude and a longitude step, latitude in the odd bits.
+ */
+static uint32_t ut_store_interleave(uint16_t lat_step, uint16_t lon_step){
+	uint32_t key = 0;
+
+	for (uint8_t bit = UT_STORE_KEY_BITS; bit-- > 0; ){
+		key = (key << 2) | ((uint32_t)((lat_step >> bit) & 1) << 1) | ((lon_step >> bit) & 1);
+	}
+	return key;
+}
+
+static uint16_t ut_store_lat_step(int32_t lat_udeg){
+	return (uint16_t)((uint32_t)(lat_udeg + UT_STORE_QUARTER_TURN_UDEG) / UT_STORE_LAT_STEP_UDEG);
+}
+
+static uint16_t ut_store_lon_step(int32_t lon_udeg){
+	if (lon_udeg >= UT_STORE_HALF_TURN_UDEG){
+		lon_udeg -= UT_STORE_TURN_UDEG;
+	}
+	return (uint16_t)((uint32_t)(lon_udeg + UT_STORE_HALF_TURN_UDEG) / UT_STORE_LON_STEP_UDEG);
+}
+
+/**
+ * @brief Tells whether a key is inside the box of key_min and key_max.
+ * Masking a key to the bits of one axis keeps the order of that axis' steps.
+ */
+static boolean_t ut_store_in_box(const ut_store_search_t* search, uint32_t key){
+	return ((key & UT_STORE_LAT_BITS) >= (search->key_min & UT_STORE_LAT_BITS)) && ((key & UT_STORE_LAT_BITS) <= (search->key_max & UT_STORE_LAT_BITS)) &&
+		((key & UT_STORE_LON_BITS) >= (search->key_min & UT_STORE_LON_BITS)) && ((key & UT_STORE_LON_BITS) <= (search->key_max & UT_STORE_LON_BITS));
+}
+
+/**
+ * @brief BIGMIN: the smallest key above a key outside the box that is inside it.
+ * Walks the bits from the top, narrowing the box to the half the answer must lie in.
+ * @param key A key between key_min and key_max, outside the box.
+ */
+static uint32_t ut_store_bigmin(const ut_store_search_t* search, uint32_t key){
+	uint32_t low = search->key_min;
+	uint32_t high = search->key_max;
+	uint32_t bigmin = search->key_max;
+
+	for (uint8_t bit = 2 * UT_STORE_KEY_BITS; bit-- > 0; ){
+		uint32_t mask = 1UL << bit;
+		uint32_t below = ((bit & 1) ? UT_STORE_LAT_BITS : UT_STORE_LON_BITS) & (mask - 1); //lower bits of the same axis
+		uint8_t state = ((key & mask) ? 4 : 0) | ((low & mask) ? 2 : 0) | ((high & mask) ? 1 : 0);
+
+		switch (state){
+			case 1: //key 0, box splits here: the answer is in the lower half or the upper one's start
+				bigmin = (low | mask) & ~below;
+				high = (high & ~mask) | below;
+				break;
+			case 3: //key 0, box entirely above
+				return low;
+			case 4: //key 1, box entirely below
+				return bigmin;
+			case 5: //key 1, box splits here: only the upper half is left
+				low = (low | mask) & ~below;
+				break;
+			default: //key, low and high agree
+				break;
+		}
+	}
+	return bigmin;
+}
+
+/**
+ * @brief Finds the data sector a run of keys starts in: the last one whose first key is below it.
+ * The RAM index picks the index sector and a binary search on it the data sector.
+ */
+static uint16_t ut_store_find_sector(ut_store_t* store, uint32_t first_key){
+	uint8_t index_sector = 0;
+	uint16_t low = 0;
+	uint16_t high;
+	uint32_t key;
+
+	while ((index_sector + 1 < store->index_sectors) && (store->index_keys[index_sector + 1] < first_key)){
+		index_sector++;
+	}
+	high = store->data_sectors - 1 - (index_sector * UT_STORE_KEYS_PER_INDEX_SECTOR);
+	if (high >= UT_STORE_KEYS_PER_INDEX_SECTOR){
+		high = UT_STORE_KEYS_PER_INDEX_SECTOR - 1;
+	}
+	while (low < high){
+		uint16_t middle = (low + high + 1) / 2;
+
+		if (!ut_store_read(store, &key, 1UL + index_sector, middle * sizeof(key), sizeof(key))){
+			break;
+		}
+		if (key < first_key){
+			low = middle;
+		} else {
+			high = middle - 1;
+		}
+	}
+	return (index_sector * UT_STORE_KEYS_PER_INDEX_SECTOR) + low;
+}
+
+/**
+ * @brief Waypoints in a data sector, fewer in the last one.
+ */
+static uint8_t ut_store_sector_records(const ut_store_t* store, uint16_t sector){
+	uint32_t left = store->count - ((uint32_t)sector * UT_STORE_RECORDS_PER_SECTOR);
+
+	return left < UT_STORE_RECORDS_PER_SECTOR ? (uint8_t)left : UT_STORE_RECORDS_PER_SECTOR;
+}
+
+/**
+ * @brief Moves to the first record with a key at or above key, from a record in a sector.
+ * Binary searches the sector, or the sector the index points to if key is past its last record.
+ * @param sector Data sector, updated.
+ * @param slot First record the answer can be, updated; the sector's record count if none is.
+ */
+static void ut_store_seek(ut_store_t* store, uint16_t* sector, uint8_t* slot, uint32_t key){
+	uint8_t high = ut_store_sector_records(store, *sector);
+
+	if ((*slot >= high) || (ut_store_read_key(store, *sector, high - 1) < key)){
+		*sector = ut_store_find_sector(store, key);
+		*slot = 0;
+		high = ut_store_sector_records(store, *sector);
+	}
+	while (*slot < high){
+		uint8_t middle = (*slot + high) / 2;
+
+		if (ut_store_read_key(store, *sector, middle) < key){
+			*slot = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+}
+
+/**
+ * @brief Sizes the box for the search radius.
+ * The box spans 0.91 microdegrees of latitude per decimetre, above the 0.9043 of the shortest
+ * meridian radius of curvature of the ellipsoid, and the longitude span is that divided by the
+ * cosine of the box edge nearest a pole, rounded down to Q10. A box reaching a pole or wider
+ * than half the globe covers all longitudes.
+ */
+static void ut_store_fit(ut_store_search_t* search){
+	uint32_t reach = search->radius_dm < UT_STORE_GLOBE_DM ? search->radius_dm : UT_STORE_GLOBE_DM;
+	uint32_t dlat = reach - (reach / 10) + (reach / 100) + 1; //rounded up, also for short radii
+
+	if (dlat > UT_STORE_HALF_TURN_UDEG){
+		dlat = UT_STORE_HALF_TURN_UDEG;
+	}
+	search->lat_min = search->from->lat_udeg - (int32_t)dlat;
+	search->lat_max = search->from->lat_udeg + (int32_t)dlat;
+	search->lon_span = UT_STORE_TURN_UDEG;
+	if ((search->lat_min > -UT_STORE_QUARTER_TURN_UDEG) && (search->lat_max < UT_STORE_QUARTER_TURN_UDEG)){
+		int32_t edge = -search->lat_min > search->lat_max ? -search->lat_min : search->lat_max;
+		uint32_t cosine = (uint32_t)ut_geo_cos(edge) >> UT_STORE_COS_SHIFT;
+
+		if ((cosine > 0) && ((dlat / cosine) < (UT_STORE_HALF_TURN_UDEG / UT_STORE_COS_ONE))){
+			search->lon_span = ((dlat / cosine) + 1) * UT_STORE_COS_ONE;
+		}
+	}
+	if (search->lon_span >= UT_STORE_HALF_TURN_UDEG){
+		search->lon_span = UT_STORE_TURN_UDEG;
+	}
+	if (search->lat_min < -UT_STORE_QUARTER_TURN_UDEG){
+		search->lat_min = -UT_STORE_QUARTER_TURN_UDEG;
+	}
+	if (search->lat_max > UT_STORE_QUARTER_TURN_UDEG){
+		search->lat_max = UT_STORE_QUARTER_TURN_UDEG;
+	}
+}
+
+/**
+ * @brief Clips one axis of key_min and key_max to the steps low and high, masked to that axis.
+ * An empty box sets key_max below every key but 0, which ends the run.
+ */
+static void ut_store_clip_axis(ut_store_search_t* search, uint32_t axis, uint32_t low, uint32_t high){
+	if ((search->key_min & axis) < low){
+		search->key_min = (search->key_min & ~axis) | low;
+	}
+	if ((search->key_max & axis) > high){
+		search->key_max = (search->key_max & ~axis) | high;
+	}
+	if ((search->key_min & axis) > (search->key_max & axis)){
+		search->key_min = UT_STORE_NO_KEY;
+		search->key_max = 0;
+	}
+}
+
+/**
+ * @brief Clips the keys of the part being read to the box, which may have shrunk since the part began.
+ * The longitude is only clipped when the box does not cross the antimeridian; the latitude always.
+ */
+static void ut_store_clip(ut_store_search_t* search){
+	ut_store_clip_axis(search, UT_STORE_LAT_BITS, ut_store_interleave(ut_store_lat_step(search->lat_min), 0),
+		ut_store_interleave(ut_store_lat_step(search->lat_max), 0));
+	if (search->lon_span < UT_STORE_TURN_UDEG){
+		int32_t west = search->from->lon_udeg - (int32_t)search->lon_span;
+		int32_t east = search->from->lon_udeg + (int32_t)search->lon_span;
+
+		if ((west >= -UT_STORE_HALF_TURN_UDEG) && (east < UT_STORE_HALF_TURN_UDEG)){
+			ut_store_clip_axis(search, UT_STORE_LON_BITS, ut_store_interleave(0, ut_store_lon_step(west)),
+				ut_store_interleave(0, ut_store_lon_step(east)));
+		}
+	}
+}
+
+/**
+ * @brief Ranges a waypoint inside the box and keeps it if it is one of the nearest within the radius.
+ * Once hits is full, the radius shrinks to the distance of the last hit and the box with it, so
+ * a run stops as soon as its keys are past the box of that distance.
+ */
+static void ut_store_consider(ut_store_search_t* search, uint32_t index, int32_t lat_udeg, int32_t lon_udeg){
+	ut_geo_point_t point;
+	uint32_t distance;
+	uint8_t i;
+
+	if ((lat_udeg < search->lat_min) || (lat_udeg > search->lat_max)){
+		return;
+	}
+	if (search->lon_span < UT_STORE_TURN_UDEG){
+		int32_t dlon = lon_udeg - search->from->lon_udeg;
+
+		if (dlon >= UT_STORE_HALF_TURN_UDEG){
+			dlon -= UT_STORE_TURN_UDEG;
+		} else if (dlon < -UT_STORE_HALF_TURN_UDEG){
+			dlon += UT_STORE_TURN_UDEG;
+		}
+		if ((uint32_t)(dlon < 0 ? -dlon : dlon) > search->lon_span){
+			return;
+		}
+	}
+	//the same pair of calls ut_update_dist() ranges the memory locations with
+	ut_geo_point_set(&point, lat_udeg, lon_udeg);
+	distance = ut_geo_point_range_dm(search->from, &point, search->altitude_dm);
+	if ((distance > search->radius_dm) ||
+		((search->count == search->max_hits) && (distance >= search->hits[search->count - 1].distance_dm))){
+		return;
+	}
+	if (search->count < search->max_hits){
+		search->count++;
+	}
+	for (i = search->count - 1; (i > 0) && (search->hits[i - 1].distance_dm > distance); i--){
+		search->hits[i] = search->hits[i - 1];
+	}
+	search->hits[i].index = index;
+	search->hits[i].distance_dm = distance;
+	if ((search->count == search->max_hits) && (search->hits[search->count - 1].distance_dm < search->radius_dm)){
+		search->radius_dm = search->hits[search->count - 1].distance_dm;
+		ut_store_fit(search);
+		ut_store_clip(search);
+	}
+}
+
+/**
+ * @brief Reads waypoints in key order until one is past key_max or limit have been read.
+ * A waypoint outside the box makes the scan seek BIGMIN.
+ */
+static void ut_store_scan(ut_store_t* store, ut_store_search_t* search, uint16_t sector, uint8_t slot, uint16_t limit){
+	int32_t coords[UT_STORE_CHUNK][UT_STORE_COORD_SIZE / sizeof(int32_t)]; //key, latitude, longitude
+	uint8_t records = ut_store_sector_records(store, sector);
+
+	while ((sector < store->data_sectors) && limit){
+		uint8_t chunk;
+		uint8_t i;
+
+		if (slot >= records){
+			sector++;
+			slot = 0;
+			records = ut_store_sector_records(store, sector);
+			continue;
+		}
+		chunk = (records - slot) < UT_STORE_CHUNK ? (records - slot) : UT_STORE_CHUNK;
+		chunk = chunk < limit ? chunk : (uint8_t)limit;
+		if (!ut_store_read(store, coords, 1UL + store->index_sectors + sector, slot * UT_STORE_COORD_SIZE, chunk * UT_STORE_COORD_SIZE)){
+			return;
+		}
+		for (i = 0; i < chunk; i++){
+			uint32_t key = (uint32_t)coords[i][0];
+
+			if (key > search->key_max){
+				return;
+			}
+			if (!ut_store_in_box(search, key)){
+				break;
+			}
+			ut_store_consider(search, ((uint32_t)sector * UT_STORE_RECORDS_PER_SECTOR) + slot + i, coords[i][1], coords[i][2]);
+		}
+		limit -= i;
+		if (i < chunk){
+			slot += i + 1;
+			ut_store_seek(store, &sector, &slot, ut_store_bigmin(search, (uint32_t)coords[i][0]));
+			records = ut_store_sector_records(store, sector);
+		} else {
+			slot += chunk;
+		}
+	}
+}
+
+/**
+ * @brief Reads the waypoints of one part of the box, between two longitude steps.
+ */
+static void ut_store_scan_box(ut_store_t* store, ut_store_search_t* search, uint16_t lon0, uint16_t lon1){
+	uint16_t sector;
+	uint8_t slot = 0;
+
+	search->key_min = ut_store_interleave(ut_store_lat_step(search->lat_min), lon0);
+	search->key_max = ut_store_interleave(ut_store_lat_step(search->lat_max), lon1);
+	ut_store_clip(search); //an earlier part may have shrunk the box
+	if (search->key_min > search->key_max){
+		return;
+	}
+	sector = ut_store_find_sector(store, search->key_min);
+	ut_store_seek(store, &sector, &slot, search->key_min);
+	ut_store_scan(store, search, sector, slot, 0xFFFF);
+}
+
+//function definitions
+/**
+ * @brief Morton key of a position: its 16 bit latitude and longitude steps, bit interleaved.
+ *
+ * @param lat_udeg Latitude in microdegrees, negative south.
+ * @param lon_udeg Longitude in microdegrees, negative west, -180 to below 180 degrees.
+ * @return The key; latitude bits are the odd ones.
+ */
+uint32_t ut_store_key(int32_t lat_udeg, int32_t lon_udeg){
+	return ut_store_interleave(ut_store_lat_step(lat_udeg), ut_store_lon_step(lon_udeg));
+}
+
+/**
+ * @brief Opens a store, reading its header and the first entry of every index sector.
+ *
+ * @param store Store to fill.
+ * @param read Sector reader.
+ * @return true if the header is valid and the index fits in RAM.
+ */
+boolean_t ut_store_open(ut_store_t* store, ut_store_read_t read){
+	uint32_t header[2]; //magic, count
+
+	store->read = read;
+	store->last_sector = UT_STORE_NO_SECTOR;
+	store->sector_reads = 0;
+	store->count = 0;
+	store->data_sectors = 0;
+	store->index_sectors = 0;
+	if (!ut_store_read(store, header, 0, 0, sizeof(header)) || (header[0] != UT_STORE_MAGIC) || (header[1] > UT_STORE_MAX_RECORDS)){
+		return false;
+	}
+	store->count = header[1];
+	store->data_sectors = (uint16_t)((store->count + UT_STORE_RECORDS_PER_SECTOR - 1) / UT_STORE_RECORDS_PER_SECTOR);
+	store->index_sectors = (uint8_t)((store->data_sectors + UT_STORE_KEYS_PER_INDEX_SECTOR - 1) / UT_STORE_KEYS_PER_INDEX_SECTOR);
+	for (uint8_t i = 0; i < store->index_sectors; i++){
+		if (!ut_store_read(store, &store->index_keys[i], 1UL + i, 0, sizeof(uint32_t))){
+			store->count = 0;
+			store->data_sectors = 0;
+			store->index_sectors = 0;
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Finds the waypoints within a distance, nearest first.
+ *
+ * @param store Open store.
+ * @param from Query position, filled by ut_geo_point_set().
+ * @param altitude_dm Altitude of the query position in decimetres.
+ * @param radius_dm Largest distance in decimetres.
+ * @param hits Set to the nearest waypoints found.
+ * @param max_hits Entries available in hits.
+ * @return Number of hits, at most max_hits.
+ */
+uint8_t ut_store_radius(ut_store_t* store, const ut_geo_point_t* from, int32_t altitude_dm, uint32_t radius_dm, ut_store_hit_t* hits, uint8_t max_hits){
+	ut_store_search_t search;
+
+	if ((store->count == 0) || (max_hits == 0)){
+		return 0;
+	}
+	search.from = from;
+	search.altitude_dm = altitude_dm;
+	search.radius_dm = radius_dm;
+	search.hits = hits;
+	search.max_hits = max_hits;
+	search.count = 0;
+	ut_store_fit(&search);
+
+	if (search.lon_span == UT_STORE_TURN_UDEG){
+		ut_store_scan_box(store, &search, 0, UT_STORE_STEP_MAX);
+	} else {
+		int32_t west = from->lon_udeg - (int32_t)search.lon_span;
+		int32_t east = from->lon_udeg + (int32_t)search.lon_span;
+
+		if (west < -UT_STORE_HALF_TURN_UDEG){ //split at the antimeridian
+			ut_store_scan_box(store, &search, ut_store_lon_step(west + UT_STORE_TURN_UDEG), UT_STORE_STEP_MAX);
+			west = -UT_STORE_HALF_TURN_UDEG;
+		} else if (east >= UT_STORE_HALF_TURN_UDEG){
+			ut_store_scan_box(store, &search, 0, ut_store_lon_step(east - UT_STORE_TURN_UDEG));
+			east = UT_STORE_HALF_TURN_UDEG - 1;
+		}
+		ut_store_scan_box(store, &search, ut_store_lon_step(west), ut_store_lon_step(east));
+	}
+	return search.count;
+}
+
+/**
+ * @brief Finds the waypoints nearest a position.
+ *
+ * The waypoints stored at the key of the position are usually near it, so the count-th nearest
+ * of them bounds the radius. Searches then start at UT_STORE_NEAREST_START_DM and grow by
+ * UT_STORE_NEAREST_GROWTH up to that bound; the first that finds count waypoints has found the
+ * nearest, as every waypoint within its radius was ranged. The box shrinks as closer waypoints
+ * are found, so even in a sparse area the last search reads little more than the box of the
+ * count-th nearest distance.
+ *
+ * @param store Open store.
+ * @param from Query position, filled by ut_geo_point_set().
+ * @param altitude_dm Altitude of the query position in decimetres.
+ * @param hits Set to the nearest waypoints, nearest first.
+ * @param count Waypoints wanted, entries available in hits.
+ * @return Number of hits, less than count only when the store holds fewer waypoints.
+ */
+uint8_t ut_store_nearest(ut_store_t* store, const ut_geo_point_t* from, int32_t altitude_dm, ut_store_hit_t* hits, uint8_t count){
+	ut_store_search_t search;
+	uint32_t start;
+	uint32_t bound;
+	uint32_t radius;
+
+	if ((store->count == 0) || (count == 0)){
+		return 0;
+	}
+	search.from = from;
+	search.altitude_dm = altitude_dm;
+	search.radius_dm = 0xFFFFFFFFUL;
+	search.lat_min = -UT_STORE_QUARTER_TURN_UDEG;
+	search.lat_max = UT_STORE_QUARTER_TURN_UDEG;
+	search.lon_span = UT_STORE_TURN_UDEG;
+	search.hits = hits;
+	search.max_hits = count;
+	search.count = 0;
+	search.key_min = 0;
+	search.key_max = UT_STORE_NO_KEY;
+	start = (uint32_t)ut_store_find_sector(store, ut_store_key(from->lat_udeg, from->lon_udeg)) * UT_STORE_RECORDS_PER_SECTOR;
+	if (start + count > store->count){
+		start = store->count > count ? store->count - count : 0;
+	}
+	ut_store_scan(store, &search, start / UT_STORE_RECORDS_PER_SECTOR, start % UT_STORE_RECORDS_PER_SECTOR,
+		count > UT_STORE_RECORDS_PER_SECTOR ? count : UT_STORE_RECORDS_PER_SECTOR);
+	bound = (search.count == count) ? hits[count - 1].distance_dm : UT_STORE_GLOBE_DM;
+	for (radius = UT_STORE_NEAREST_START_DM; radius < bound; radius *= UT_STORE_NEAREST_GROWTH){
+		if (ut_store_radius(store, from, altitude_dm, radius, hits, count) == count){
+			return count;
+		}
+	}
+	return ut_store_radius(store, from, altitude_dm, bound, hits, count);
+}
+
+/**
+ * @brief Reads the name of a waypoint.
+ *
+ * @param store Open store.
+ * @param index Position of the waypoint in the store.
+ * @param name Set to UT_STORE_NAME_SIZE characters, not terminated.
+ * @return true on success.
+ */
+boolean_t ut_store_name(ut_store_t* store, uint32_t index, char* name){
+	if (index >= store->count){
+		return false;
+	}
+	return ut_store_read(store, name, 1UL + store->index_sectors + (index / UT_STORE_RECORDS_PER_SECTOR),
+		UT_STORE_NAME_OFFSET + ((index % UT_STORE_RECORDS_PER_SECTOR) * UT_STORE_NAME_SIZE), UT_STORE_NAME_SIZE);
+}
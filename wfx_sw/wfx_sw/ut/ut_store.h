@@ -0,0 +1,122 @@
+/**
+ * @file ut_store.h
+ * @brief Header file for the waypoint store of the utilities CSC.
+ *
+ * A store holds thousands of named waypoints in 512 byte sectors of external storage, sorted by
+ * the Morton key of their position, so waypoints close together on the ground are mostly close
+ * together in the store. Only the header and the first key of every index sector are kept in
+ * RAM; a query reads the index sector and the data sectors under the few Morton cells that cover
+ * the search area, through a callback that reads part of a sector. Candidates are ranged with
+ * ut_geo_point_set() and ut_geo_point_range_dm(), as ut_update_dist() ranges the memory locations.
+ *
+ * Layout, little endian as on the AVR and the host:
+ *   sector 0                header: UT_STORE_MAGIC and the record count, both uint32_t
+ *   sectors 1..I            index: the first key of every data sector, UT_STORE_KEYS_PER_INDEX_SECTOR per sector
+ *   sectors I+1..           data: UT_STORE_RECORDS_PER_SECTOR records per sector, key, latitude and
+ *                           longitude of all of them first, then their names, so a query reads
+ *                           the coordinates of a run of records in one call
+ *
+ * tools/ut_store_bench builds store files and checks the queries against a full scan.
+ */
+
+#ifndef UT_STORE_H_
+#define UT_STORE_H_
+
+#include "ut_types.h"
+#include "ut_geo.h"
+
+#define UT_STORE_MAGIC 0x53584657UL /**< "WFXS" in the first bytes of sector 0 */
+#define UT_STORE_SECTOR_SIZE 512 /**< Bytes per sector, as on an SD card */
+#define UT_STORE_RECORDS_PER_SECTOR 16 /**< Waypoints per data sector */
+#define UT_STORE_COORD_SIZE 12 /**< Bytes of key, latitude and longitude per waypoint */
+#define UT_STORE_NAME_SIZE 20 /**< Characters per name, space padded, not terminated */
+#define UT_STORE_NAME_OFFSET (UT_STORE_RECORDS_PER_SECTOR * UT_STORE_COORD_SIZE) /**< Offset of the names in a data sector */
+#define UT_STORE_KEYS_PER_INDEX_SECTOR (UT_STORE_SECTOR_SIZE / 4) /**< Data sectors listed per index sector */
+#define UT_STORE_MAX_INDEX_SECTORS 16 /**< Index sectors held in RAM, 32768 waypoints */
+#define UT_STORE_MAX_RECORDS ((uint32_t)UT_STORE_MAX_INDEX_SECTORS * UT_STORE_KEYS_PER_INDEX_SECTOR * UT_STORE_RECORDS_PER_SECTOR)
+#define UT_STORE_LAT_STEP_UDEG 2747UL /**< Microdegrees of latitude per step of the key's 16 bit latitude */
+#define UT_STORE_LON_STEP_UDEG 5494UL /**< Microdegrees of longitude per step of the key's 16 bit longitude */
+#define UT_STORE_GLOBE_DM 201000000UL /**< Radius that covers the whole globe, beyond half the meridian at any altitude */
+
+/**
+ * @brief Reads part of a sector, like disk_readp() of Petit FatFs.
+ * @param dst Destination.
+ * @param sector Sector number from the start of the store.
+ * @param offset First byte in the sector.
+ * @param count Bytes to read, not past the end of the sector.
+ * @return true on success.
+ */
+typedef boolean_t (*ut_store_read_t)(void* dst, uint32_t sector, uint16_t offset, uint16_t count);
+
+/**
+ * @brief An open store.
+ */
+typedef struct {
+	ut_store_read_t read;   /**< Sector reader */
+	uint32_t count;         /**< Waypoints in the store */
+	uint16_t data_sectors;  /**< Sectors holding waypoints */
+	uint8_t index_sectors;  /**< Sectors holding the index */
+	uint32_t index_keys[UT_STORE_MAX_INDEX_SECTORS]; /**< First key listed by each index sector */
+	uint32_t last_sector;   /**< Sector of the last read */
+	uint32_t sector_reads;  /**< Reads that moved to another sector, for benchmarks */
+} ut_store_t;
+
+/**
+ * @brief A waypoint found by a query.
+ */
+typedef struct {
+	uint32_t index;       /**< Position of the waypoint in the store, for ut_store_name() */
+	uint32_t distance_dm; /**< Distance from the query position in decimetres */
+} ut_store_hit_t;
+
+/**
+ * @brief Morton key of a position: its 16 bit latitude and longitude steps, bit interleaved.
+ * @param lat_udeg Latitude in microdegrees, negative south.
+ * @param lon_udeg Longitude in microdegrees, negative west, -180 to below 180 degrees.
+ * @return The key; latitude bits are the odd ones.
+ */
+uint32_t ut_store_key(int32_t lat_udeg, int32_t lon_udeg);
+
+/**
+ * @brief Opens a store, reading its header and the first entry of every index sector.
+ * @param store Store to fill.
+ * @param read Sector reader.
+ * @return true if the header is valid and the index fits in RAM.
+ */
+boolean_t ut_store_open(ut_store_t* store, ut_store_read_t read);
+
+/**
+ * @brief Finds the waypoints within a distance, nearest first.
+ * @param store Open store.
+ * @param from Query position, filled by ut_geo_point_set().
+ * @param altitude_dm Altitude of the query position in decimetres.
+ * @param radius_dm Largest distance in decimetres.
+ * @param hits Set to the nearest waypoints found.
+ * @param max_hits Entries available in hits.
+ * @return Number of hits, at most max_hits.
+ */
+uint8_t ut_store_radius(ut_store_t* store, const ut_geo_point_t* from, int32_t altitude_dm, uint32_t radius_dm, ut_store_hit_t* hits, uint8_t max_hits);
+
+/**
+ * @brief Finds the waypoints nearest a position.
+ * Ranges the waypoints stored next to the position's key first, then searches within the
+ * distance of the count-th nearest of them.
+ * @param store Open store.
+ * @param from Query position, filled by ut_geo_point_set().
+ * @param altitude_dm Altitude of the query position in decimetres.
+ * @param hits Set to the nearest waypoints, nearest first.
+ * @param count Waypoints wanted, entries available in hits.
+ * @return Number of hits, less than count only when the store holds fewer waypoints.
+ */
+uint8_t ut_store_nearest(ut_store_t* store, const ut_geo_point_t* from, int32_t altitude_dm, ut_store_hit_t* hits, uint8_t count);
+
+/**
+ * @brief Reads the name of a waypoint.
+ * @param store Open store.
+ * @param index Position of the waypoint in the store.
+ * @param name Set to UT_STORE_NAME_SIZE characters, not terminated.
+ * @return true on success.
+ */
+boolean_t ut_store_name(ut_store_t* store, uint32_t index, char* name);
+
+#endif /* UT_STORE_H_ */
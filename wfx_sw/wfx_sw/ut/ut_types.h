@@ -11,6 +11,7 @@
 #ifndef UT_TYPES_H_
 #define UT_TYPES_H_
 
+#ifdef __AVR__
 /**
  * @brief 8-bit unsigned integer type.
  */
@@ -26,6 +27,19 @@ typedef signed char    int8_t;
  */
 typedef unsigned int   uint16_t;
 
+/**
+ * @brief 32-bit unsigned integer type.
+ */
+typedef unsigned long  uint32_t;
+
+/**
+ * @brief 32-bit signed integer type.
+ */
+typedef signed long    int32_t;
+#else
+#include <stdint.h> /* host builds of portable modules such as nf_parse.c */
+#endif
+
 /**
  * @brief Boolean type (true/false).
  */
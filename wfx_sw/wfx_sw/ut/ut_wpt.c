@@ -0,0 +1,133 @@
+/**
+ * @file ut_wpt.c
+ * @brief Packed waypoint records of the utilities CSC, see ut_wpt.h.
+ *
+ * Names use a 64 character set: space, A to Z, 0 to 9 and 27 punctuation marks, so a character
+ * takes 6 bits and the 9 characters of a name fit in 7 bytes. Packing looks a character up in
+ * the PROGMEM table, unpacking indexes it.
+ */
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+#else
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#endif
+#include "ut_wpt.h"
+
+//defines
+#define UT_WPT_CHAR_BITS 6 /**< Bits per name character */
+#define UT_WPT_CHAR_MASK ((1 << UT_WPT_CHAR_BITS) - 1)
+#define UT_WPT_CHARSET_SIZE 64 /**< Characters in the name character set */
+#define UT_WPT_UNKNOWN_CODE 49 /**< Code of '?', stored for characters outside the set */
+#define UT_WPT_CRC_INIT 0xFF /**< Starting value of the record CRC */
+
+//local static
+static const char ut_wpt_charset[UT_WPT_CHARSET_SIZE] PROGMEM =
+	" ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-.,'/&()#+:!?@*_=<>\"%$;[]^~"; /**< Name character of each 6 bit code */
+
+//local function definitions
+/**
+ * @brief 6 bit code of a name character.
+ */
+static uint8_t ut_wpt_char_code(char c){
+	if ((c >= 'a') && (c <= 'z')){
+		c -= 'a' - 'A';
+	}
+	for (uint8_t code = 0; code < UT_WPT_CHARSET_SIZE; code++){
+		if ((char)pgm_read_byte(&ut_wpt_charset[code]) == c){
+			return code;
+		}
+	}
+	return UT_WPT_UNKNOWN_CODE;
+}
+
+/**
+ * @brief Writes a 32 bit value little endian.
+ */
+static void ut_wpt_put32(uint8_t* dest, int32_t value){
+	uint32_t bits = (uint32_t)value;
+
+	for (uint8_t i = 0; i < 4; i++){
+		dest[i] = (uint8_t)bits;
+		bits >>= 8;
+	}
+}
+
+/**
+ * @brief Reads a 32 bit value little endian.
+ */
+static int32_t ut_wpt_get32(const uint8_t* src){
+	uint32_t bits = 0;
+
+	for (uint8_t i = 4; i > 0; i--){
+		bits = (bits << 8) | src[i - 1];
+	}
+	return (int32_t)bits;
+}
+
+//function definitions
+uint8_t ut_wpt_crc8(const uint8_t* data, uint8_t count){
+	uint8_t crc = UT_WPT_CRC_INIT;
+
+	while (count--){
+#ifdef __AVR__
+		crc = _crc_ibutton_update(crc, *data++);
+#else
+		crc ^= *data++;
+		for (uint8_t bit = 0; bit < 8; bit++){
+			crc = (crc & 1) ? (crc >> 1) ^ 0x8C : (crc >> 1);
+		}
+#endif
+	}
+	return crc;
+}
+
+void ut_wpt_encode(const ut_wpt_t* wpt, uint8_t* fields){
+	uint16_t bits = 0; //pending bits in the low end
+	uint8_t pending = 0;
+	uint8_t* dest = fields + UT_WPT_NAME_OFFSET;
+
+	ut_wpt_put32(fields, wpt->lat_udeg);
+	ut_wpt_put32(fields + 4, wpt->lon_udeg);
+	for (uint8_t i = 0; i < UT_WPT_NAME_CHARS; i++){
+		bits = (bits << UT_WPT_CHAR_BITS) | ut_wpt_char_code(wpt->name[i]);
+		pending += UT_WPT_CHAR_BITS;
+		if (pending >= 8){
+			pending -= 8;
+			*dest++ = (uint8_t)(bits >> pending);
+		}
+	}
+	*dest = (uint8_t)(bits << (8 - pending)); //the spare bits stay zero
+}
+
+void ut_wpt_decode(const uint8_t* fields, ut_wpt_t* wpt){
+	uint16_t bits = 0;
+	uint8_t pending = 0;
+	const uint8_t* src = fields + UT_WPT_NAME_OFFSET;
+
+	wpt->lat_udeg = ut_wpt_get32(fields);
+	wpt->lon_udeg = ut_wpt_get32(fields + 4);
+	for (uint8_t i = 0; i < UT_WPT_NAME_CHARS; i++){
+		if (pending < UT_WPT_CHAR_BITS){
+			bits = (bits << 8) | *src++;
+			pending += 8;
+		}
+		pending -= UT_WPT_CHAR_BITS;
+		wpt->name[i] = (char)pgm_read_byte(&ut_wpt_charset[(bits >> pending) & UT_WPT_CHAR_MASK]);
+	}
+}
+
+void ut_wpt_pack(const ut_wpt_t* wpt, uint8_t* record){
+	ut_wpt_encode(wpt, record);
+	record[UT_WPT_CRC_OFFSET] = ut_wpt_crc8(record, UT_WPT_CRC_OFFSET);
+}
+
+boolean_t ut_wpt_unpack(const uint8_t* record, ut_wpt_t* wpt){
+	if (ut_wpt_crc8(record, UT_WPT_CRC_OFFSET) != record[UT_WPT_CRC_OFFSET]){
+		return false;
+	}
+	ut_wpt_decode(record, wpt);
+	return true;
+}
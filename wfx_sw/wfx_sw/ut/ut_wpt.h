@@ -0,0 +1,75 @@
+/**
+ * @file ut_wpt.h
+ * @brief Header file for the packed waypoint records of the utilities CSC.
+ *
+ * A memory location packs into one UT_WPT_RECORD_SIZE byte record; the entries of the EEPROM
+ * log in ut_log.h carry bytes 0..14 of it with their own sequence number and CRC:
+ *   bytes 0..3    latitude in microdegrees, int32_t little endian
+ *   bytes 4..7    longitude in microdegrees, int32_t little endian
+ *   bytes 8..14   UT_WPT_NAME_CHARS characters of 6 bits each, first character in the top bits
+ *                 of byte 8, the 2 bits left over at the bottom of byte 14 are zero
+ *   byte 15       CRC-8 of bytes 0..14, Dallas/Maxim polynomial as _crc_ibutton_update(), from 0xFF
+ * A record whose CRC does not match is an empty location; starting from 0xFF, records of all
+ * zeros, like the cleared floats of the old layout, and of erased 0xFF bytes do not match.
+ * The module builds unchanged with a native compiler, so host tools write the same records.
+ */
+
+#ifndef UT_WPT_H_
+#define UT_WPT_H_
+
+#include "ut_types.h"
+
+#define UT_WPT_RECORD_SIZE 16 /**< Bytes per packed record */
+#define UT_WPT_NAME_CHARS 9 /**< Characters per name, space padded, not terminated */
+#define UT_WPT_NAME_OFFSET 8 /**< First byte of the packed name in a record */
+#define UT_WPT_CRC_OFFSET 15 /**< Byte holding the CRC of the rest of a record */
+
+/**
+ * @brief An unpacked waypoint.
+ */
+typedef struct {
+	int32_t lat_udeg;              /**< Latitude in microdegrees, negative south */
+	int32_t lon_udeg;              /**< Longitude in microdegrees, negative west */
+	char name[UT_WPT_NAME_CHARS];  /**< Upper case name, space padded, not terminated */
+} ut_wpt_t;
+
+/**
+ * @brief CRC-8 of a run of bytes, as _crc_ibutton_update() of avr-libc from 0xFF.
+ * @param data Bytes to check.
+ * @param count Number of bytes.
+ * @return The CRC.
+ */
+uint8_t ut_wpt_crc8(const uint8_t* data, uint8_t count);
+
+/**
+ * @brief Writes the latitude, longitude and name of a waypoint as bytes 0..14 of a record, without the CRC.
+ * Lower case letters are stored in upper case and characters outside the 64 character set as '?'.
+ * @param wpt Waypoint to encode.
+ * @param fields Set to UT_WPT_CRC_OFFSET bytes.
+ */
+void ut_wpt_encode(const ut_wpt_t* wpt, uint8_t* fields);
+
+/**
+ * @brief Reads a waypoint from bytes 0..14 of a record, without checking a CRC.
+ * @param fields UT_WPT_CRC_OFFSET bytes written by ut_wpt_encode().
+ * @param wpt Set to the waypoint.
+ */
+void ut_wpt_decode(const uint8_t* fields, ut_wpt_t* wpt);
+
+/**
+ * @brief Packs a waypoint into a record.
+ * Lower case letters are stored in upper case and characters outside the 64 character set as '?'.
+ * @param wpt Waypoint to pack.
+ * @param record Set to UT_WPT_RECORD_SIZE bytes.
+ */
+void ut_wpt_pack(const ut_wpt_t* wpt, uint8_t* record);
+
+/**
+ * @brief Unpacks a record.
+ * @param record UT_WPT_RECORD_SIZE bytes.
+ * @param wpt Set to the waypoint when the record is valid.
+ * @return true if the CRC matches.
+ */
+boolean_t ut_wpt_unpack(const uint8_t* record, ut_wpt_t* wpt);
+
+#endif /* UT_WPT_H_ */
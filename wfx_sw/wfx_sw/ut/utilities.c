@@ -3,21 +3,39 @@
 #endif
 #include <avr/io.h>
 #include <avr/eeprom.h>
-#include <math.h>
+#include <avr/interrupt.h>
 #include <stdlib.h>
 #include <string.h>
 #include <util/delay.h>
 #include "utilities.h"
+#include "ut_geo.h"
+#include "ut_log.h"
+#include "ut_eeq.h"
+#include "../nf/nf_parse.h"
+
+//defines
+#define NAME_CACHE_SIZE 4 /**< Names kept by ut_mem_name(), for the rows of the nearest page and the selected location */
+#define MEM_UNUSED_UDEG ((int32_t)0x80000000UL) /**< Latitude of a memory location not in use, below any position */
+
+/**
+ * @brief A memory location as kept in RAM; the values ut_geo.h ranges with are filled in when it is ranged.
+ */
+typedef struct {
+	int32_t lat_udeg; /**< Latitude in microdegrees, or MEM_UNUSED_UDEG */
+	int32_t lon_udeg; /**< Longitude in microdegrees */
+} mem_point_t;
 
 //global variables
-boolean_t ut_mode; /**< Current mode */
+uint8_t ut_mode; /**< Current mode */
 uint8_t ut_operation; /**< Current operation */
 uint8_t ut_memory_0idx; /**< Index for memory */
-float ut_lat_mem_floats[MAX_MEM_INDEX]; /**< Array to store latitude */
-float ut_long_mem_floats[MAX_MEM_INDEX]; /**< Array to store longitude */
 char ut_lat_mem_str[LLA_LAT_BUFFER_SIZE]; /**< String to store latitude */
 char ut_long_mem_str[LLA_LONG_BUFFER_SIZE]; /**< String to store longitude */
 char ut_distance_str[DISTANCE_SIG_FIG]; /**< String to store distance */
+uint32_t ut_mem_distance_dm[MAX_MEM_INDEX]; /**< Distance to each memory location */
+uint8_t ut_nearest[MAX_MEM_INDEX]; /**< Memory locations in use, nearest first */
+uint16_t ut_bearing_cdeg = UT_BEARING_UNKNOWN; /**< Bearing to the selected memory location */
+uint8_t ut_nearest_count; /**< Valid entries in ut_nearest */
 
 
 //local static variables
@@ -26,10 +44,15 @@ static uint16_t btn_on_time[NUM_BUTTONS]; /**< Array to store button logic high
 static uint8_t btn_off_time[NUM_BUTTONS]; /**< Array to store button states after debouncing */
 static boolean_t prev_state[NUM_BUTTONS]; /**< Previous state of buttons */
 static boolean_t btn_state[NUM_BUTTONS]; /**< Current state of buttons */
-
-//EPROM
-float EEMEM ut_lat_EPROM_floats[MAX_MEM_INDEX]; /**< Array to store latitude memory floats. */
-float EEMEM ut_long_EPROM_floats[MAX_MEM_INDEX]; /**< Array to store longitude memory floats. */
+static mem_point_t mem_points[MAX_MEM_INDEX]; /**< Memory locations, the RAM copy of the EEPROM log */
+static ut_geo_point_t user_point; /**< User's position for ut_update_dist() */
+static int32_t user_altitude_dm; /**< User's altitude for ut_update_dist() */
+static volatile boolean_t action_pending; /**< Action button pressed, not yet carried out by ut_run_action() */
+static uint8_t action_op; /**< Operation selected when the action button was pressed */
+static uint8_t action_index; /**< Memory index selected when the action button was pressed */
+static char name_cache[NAME_CACHE_SIZE][UT_WPT_NAME_CHARS]; /**< Names last read from EEPROM by ut_mem_name() */
+static uint8_t name_cache_index[NAME_CACHE_SIZE] = {UT_LOG_NONE, UT_LOG_NONE, UT_LOG_NONE, UT_LOG_NONE}; /**< Memory index of each name in name_cache, or UT_LOG_NONE */
+static uint8_t name_cache_next; /**< Entry of name_cache replaced by the next read */
 
 //local functions
 /**
@@ -43,88 +66,41 @@ float EEMEM ut_long_EPROM_floats[MAX_MEM_INDEX]; /**< Array to store longitude m
  */
 boolean_t is_button_pressed(volatile uint8_t *port, uint8_t pin);
 
-void ut_write_to_non_vol(uint8_t index);
+void ut_write_to_non_vol(uint8_t index, const char* name);
 
 void ut_load_from_non_vol(uint8_t index);
 
-/**
- * @brief Converts latitude from float to string.
- * 
- * This function converts a floating-point latitude value to a string.
- * 
- * @param lat_float The latitude value as a float.
- * @param lat_string Pointer to the string to store the converted latitude.
- */
-void ut_convert_lat_float_to_string(float lat_float, char* lat_string){
-	//passed by value; will not change float from where function is called
-	if (lat_float < 0){
-		lat_string[0] = '-';
-		lat_float *= -1; //make positive for integer math 
-	} else{
-		lat_string[0] = '+';
-	}
-
-	// Extract integer and decimal parts
-	uint16_t integer_part = (uint16_t)(lat_float);
-	float fractional_part = lat_float - integer_part;
-	uint32_t decimal_part = (uint32_t)(fractional_part * 100000);
+void ut_forget_name(uint8_t index);
 
+boolean_t ut_mem_in_use(uint8_t index);
 
-	// Convert integer part to string
-	lat_string[1] = '0' + ((integer_part / 10) % 10); // Tens
-	lat_string[2] = '0' + (integer_part % 10); // Ones
-
-	// Decimal point
-	lat_string[3] = '.';
-
-	// Convert decimal part to string
-	lat_string[4] = '0' + ((decimal_part / 10000) % 10); // Ten-thousands
-	lat_string[5] = '0' + ((decimal_part / 1000)% 10); // Thousands
-	lat_string[6] = '0' + ((decimal_part / 100) % 10); // Hundreds
-	lat_string[7] = '0' + ((decimal_part / 10) % 10); // Tens
-	lat_string[8] = '0' + (decimal_part % 10); // Ones
-}
+void ut_cache_name(uint8_t index, const char* name);
 
 /**
- * @brief Converts longitude from float to string.
- * 
- * This function converts a floating-point longitude value to a string.
- * 
- * @param long_float The longitude value as a float.
- * @param long_string Pointer to the string to store the converted longitude.
+ * @brief Refreshes ut_lat_mem_str and ut_long_mem_str for the selected memory location; 0,0 when not in use.
  */
-void ut_convert_long_float_to_string(float long_float, char* long_string){
-	//passed by value; will not change float from where function is called
-	if (long_float < 0){
-		long_string[0] = '-';
-		long_float *= -1; //make positive for integer math
-	} else{
-		long_string[0] = '+';
-	}
+void ut_convert_mem_to_strings(){
+	int32_t lat_udeg = 0;
+	int32_t lon_udeg = 0;
 
-	// Extract integer and decimal parts
-	uint16_t integer_part = (uint16_t)(long_float);
-	float fractional_part = long_float - integer_part;
-	uint32_t decimal_part = (uint32_t)(fractional_part * 100000);
-
-
-	// Convert integer part to string
-	long_string[1] = '0' + ((integer_part / 100) % 10); // Hundreds
-	long_string[2] = '0' + ((integer_part / 10) % 10); // Tens
-	long_string[3] = '0' + (integer_part % 10); // Ones
+	if (ut_mem_in_use(ut_memory_0idx)){
+		lat_udeg = mem_points[ut_memory_0idx].lat_udeg;
+		lon_udeg = mem_points[ut_memory_0idx].lon_udeg;
+	}
+	//same integer formatter as the position, no float on the way
+	nf_format_udeg(lat_udeg, ut_lat_mem_str, 2);
+	nf_format_udeg(lon_udeg, ut_long_mem_str, 3);
+}
 
-	// Decimal point
-	long_string[4] = '.';
 
-	// Convert decimal part to string
-	long_string[5] = '0' + ((decimal_part / 10000) % 10); // Ten-thousands
-	long_string[6] = '0' + ((decimal_part / 1000)% 10); // Thousands
-	long_string[7] = '0' + ((decimal_part / 100) % 10); // Hundreds
-	long_string[8] = '0' + ((decimal_part / 10) % 10); // Tens
-	long_string[9] = '0' + (decimal_part % 10); // Ones
+/**
+ * @brief Whether the last action is still being carried out; the display marks the operation until it is.
+ * @return true from the action button press until ut_run_action() has run and the EEPROM has every queued byte.
+ */
+boolean_t ut_action_busy(){
+	return action_pending || ut_eeq_pending();
 }
 
-
 /**
  * @brief Initializes the pins for buttons, loads from SD card, and initializes stored locations on startup.
  * 
@@ -132,17 +108,19 @@ void ut_convert_long_float_to_string(float long_float, char* long_string){
  */
 void ut_init()
 {
-	//read from SD card
+	//rebuild the index of the EEPROM log, then read every location through it
+	ut_log_init();
 	for (int i = 0; i < MAX_MEM_INDEX; i++){
 		ut_load_from_non_vol(i);
+		ut_mem_distance_dm[i] = UT_DISTANCE_UNKNOWN;
 	}
+	ut_nearest_count = 0;
 
 	//initialize globals
 	ut_mode = NAV_MODE;
 	ut_operation = SAVE_OP;
 	ut_memory_0idx = 0;
-	ut_convert_lat_float_to_string(ut_lat_mem_floats[ut_memory_0idx], ut_lat_mem_str);
-	ut_convert_long_float_to_string(ut_long_mem_floats[ut_memory_0idx], ut_long_mem_str);
+	ut_convert_mem_to_strings();
 	memset(ut_distance_str, ' ', DISTANCE_SIG_FIG * sizeof(char));
 	
 	//init local static
@@ -210,66 +188,87 @@ void ut_poll_btns(){
 	// Check for virtual short and take action accordingly
 	if (!(btn_state[MODE_SELECT_BTN]) && (prev_state[MODE_SELECT_BTN])) {
 		// Mode select button pressed
-		ut_mode ^= 1;  //toggle mode
-	} else if ((ut_mode != STAT_MODE) && !(btn_state[MEM_SELECT_BTN]) && (prev_state[MEM_SELECT_BTN])) {
+		ut_mode = (ut_mode + 1) % NUM_MODES;  //cycle mode
+	} else if (((ut_mode == NAV_MODE) || (ut_mode == COMPASS_MODE)) && !(btn_state[MEM_SELECT_BTN]) && (prev_state[MEM_SELECT_BTN])) {
 		// Memory select button pressed
 		ut_memory_0idx = (ut_memory_0idx + 1)%MAX_MEM_INDEX; //cycle memory index selected
 		//update strings to reflect selected mem location
-		ut_convert_lat_float_to_string(ut_lat_mem_floats[ut_memory_0idx], ut_lat_mem_str);  
-		ut_convert_long_float_to_string(ut_long_mem_floats[ut_memory_0idx], ut_long_mem_str);
+		ut_convert_mem_to_strings();
 
-	} else if ((ut_mode != STAT_MODE) && !(btn_state[OP_SELECT_BTN]) && (prev_state[OP_SELECT_BTN])) {
+	} else if ((ut_mode == NAV_MODE) && !(btn_state[OP_SELECT_BTN]) && (prev_state[OP_SELECT_BTN])) {
 		// Operation select button pressed
 		ut_operation = (ut_operation + 1)%NUM_OPERATIONS; //cycle operation selected
 
-	} else if ((ut_mode != STAT_MODE) && !(btn_state[ACTION_BTN]) && (prev_state[ACTION_BTN])) {
-		// Action button pressed
-		//#TODO Implement action for action button press
-		switch (ut_operation){
-			case SAVE_OP:
-				//Load into global array
-				ut_lat_mem_floats[ut_memory_0idx] = latitudeLLA_float;
-				ut_long_mem_floats[ut_memory_0idx] = longitudeLLA_float;
-
-				//update string
-				ut_convert_lat_float_to_string(ut_lat_mem_floats[ut_memory_0idx], ut_lat_mem_str);
-				ut_convert_long_float_to_string(ut_long_mem_floats[ut_memory_0idx], ut_long_mem_str);
-
-				//write to SD card
-				ut_write_to_non_vol(ut_memory_0idx);
-
-			break;
-			case CLEAR_OP:
-				 //Load into global array
-				 ut_lat_mem_floats[ut_memory_0idx] = 0.0f;
-				 ut_long_mem_floats[ut_memory_0idx] = 0.0f;
-
-				 //update string
-				 ut_convert_lat_float_to_string(ut_lat_mem_floats[ut_memory_0idx], ut_lat_mem_str);
-				 ut_convert_long_float_to_string(ut_long_mem_floats[ut_memory_0idx], ut_long_mem_str);
-
-				 //write to SD card
-				 ut_write_to_non_vol(ut_memory_0idx);
- 
-			break;
-			case RESET_OP:
-				for (int i  = 0; i < MAX_MEM_INDEX; i++){
-					//Load into global array
-					ut_lat_mem_floats[i] = 0.0f;
-					ut_long_mem_floats[i] = 0.0f;
-
-					//update string
-					ut_convert_lat_float_to_string(ut_lat_mem_floats[i], ut_lat_mem_str);
-					ut_convert_long_float_to_string(ut_long_mem_floats[i], ut_long_mem_str);
-
-					//write to SD card
-					ut_write_to_non_vol(i);
-				}
-			break;
-			default: //not reachable; error will show on screen (see main)
-			break;
+	} else if ((ut_mode == NAV_MODE) && !(btn_state[ACTION_BTN]) && (prev_state[ACTION_BTN]) && !action_pending) {
+		// Action button pressed; ut_run_action() carries it out from the main loop, away from the UART RX interrupt
+		action_op = ut_operation;
+		action_index = ut_memory_0idx;
+		action_pending = true;
+	}
+}
+
+/**
+ * @brief Carries out the last action button press in the main loop.
+ *
+ * The memory locations and their strings change under cli(), as ut_poll_btns() reads them; the EEPROM log is then appended to
+ * through the write queue of ut_eeq.h, which returns before the bytes are written.
+ */
+void ut_run_action(){
+	uint8_t sreg;
+
+	if (!action_pending){
+		return;
+	}
+	switch (action_op){
+		case SAVE_OP: {
+			//the parser is not polled before the solution is copied
+			const nav_solution_t* nav = nf_nav_solution();
+			char name[UT_WPT_NAME_CHARS] = {'U', 'T', 'C'}; //named after the time of the save, e.g. "UTC161229"
+
+			memcpy(name + 3, nav->utc_time, UT_WPT_NAME_CHARS - 3);
+			//Load into global array and update string
+			sreg = SREG;
+			cli();
+			mem_points[action_index].lat_udeg = nav->latitude_udeg;
+			mem_points[action_index].lon_udeg = nav->longitude_udeg;
+			ut_convert_mem_to_strings();
+			SREG = sreg;
+
+			//write to EEPROM
+			ut_write_to_non_vol(action_index, name);
 		}
+		break;
+		case CLEAR_OP:
+			//Load into global array and update string
+			sreg = SREG;
+			cli();
+			mem_points[action_index].lat_udeg = MEM_UNUSED_UDEG;
+			ut_convert_mem_to_strings();
+			SREG = sreg;
+
+			//write to EEPROM
+			ut_write_to_non_vol(action_index, NULL);
+		break;
+		case RESET_OP:
+			//Load into global array and update string
+			sreg = SREG;
+			cli();
+			for (int i  = 0; i < MAX_MEM_INDEX; i++){
+				mem_points[i].lat_udeg = MEM_UNUSED_UDEG;
+			}
+			ut_convert_mem_to_strings();
+			SREG = sreg;
+
+			//write to EEPROM; one entry clears them all
+			ut_log_reset();
+			for (int i = 0; i < MAX_MEM_INDEX; i++){
+				ut_forget_name(i);
+			}
+		break;
+		default: //not reachable; error will show on screen (see main)
+		break;
 	}
+	action_pending = false;
 }
 
 //local function definition
@@ -286,98 +285,220 @@ boolean_t is_button_pressed(volatile uint8_t *port, uint8_t pin) {
 }
 
 /**
- * @brief A function that converts a degree value to an equivalent radian value
+ * @brief Converts a distance to kilometres with as many decimals as fit, e.g. "12.345".
  */
-float deg2rad(float deg) {
-	return deg * (M_PI / 180);
-}
-
-// Function to convert a float distance value to a string
-void float_to_string(float value, char *str, int max_size) {
-	uint16_t whole_part = (int)value;
-	float fractional_part = value - whole_part;
+void ut_distance_to_string(uint32_t distance_dm, char *str, int max_size) {
+	uint16_t fraction = distance_dm % DM_PER_KM; //decimetres past the whole kilometre
+	uint16_t place = DM_PER_KM / 10;
 	uint8_t i;
 
-	// Convert the whole part to string
-	itoa(whole_part, str, 10); // Assuming you have itoa function available
+	// Convert the whole part to string; at most 20038km, so it and its terminator fit
+	utoa((uint16_t)(distance_dm / DM_PER_KM), str, 10);
 
-	// Find the position of the decimal point
-	for (i = 0; str[i] != '\0'; i++) {
-		if ((str[i] == '\0') || (i >= max_size)) {
-			break;
-		}
+	// Find the end of the whole part
+	for (i = 0; (i < max_size) && (str[i] != '\0'); i++) {
 	}
-	
+
 	if (i < max_size){
 		// Add decimal point
 		str[i++] = '.';
-		
-		if (i < max_size){
-			//grab as many decimals as we can
-			for (i = i; i < max_size; i++){
-				fractional_part *= 10;
-				str[i] = '0'+ (uint8_t)fractional_part;
-				fractional_part -= (str[i] - '0');
-			}
+
+		//grab as many decimals as we can
+		for (; i < max_size; i++){
+			str[i] = place ? '0' + ((fraction / place) % 10) : '0';
+			place /= 10;
 		}
 	}
 }
 
 /**
- * @brief Performs distance calculation between user's current position and the position stored at the selected memory index
- *		  Uses Haversine formula; ouptuts in Km (updates the value of the ut_distance global variable)
+ * @brief Takes the user's position for the following distance updates.
+ *		  Its cosine is computed here once, so each ut_update_dist() only computes that of the memory location.
+ * @param nav Current navigation solution.
+ */
+void ut_set_position(const nav_solution_t* nav){
+	ut_geo_point_set(&user_point, nav->latitude_udeg, nav->longitude_udeg);
+	user_altitude_dm = nav->msl_altitude_dm; //assume common altitude
+}
+
+/**
+ * @brief Updates the distance between the user's position and one memory location
+ *		  Uses ut_geo_point_range_dm(), which picks the method by separation; outputs in decimetres.
+ *		  The cosines of the location are not kept between updates, to spare 4 bytes of RAM per location (12 with UT_GEO_WGS84).
+ * @param index Memory index.
+ */
+void ut_update_dist(uint8_t index){
+	ut_geo_point_t point;
+
+	//points only change in ut_run_action(), also in the main loop
+	if (!ut_mem_in_use(index)){
+		ut_mem_distance_dm[index] = UT_DISTANCE_UNKNOWN;
+		return;
+	}
+	ut_geo_point_set(&point, mem_points[index].lat_udeg, mem_points[index].lon_udeg);
+	ut_mem_distance_dm[index] = ut_geo_point_range_dm(&user_point, &point, user_altitude_dm);
+}
+
+/**
+ * @brief Updates the distance to the selected memory location and ut_distance_str from it.
+ *		  The index is read once, as the button ISR may change the selection.
  */
-void ut_update_dist(){
-	float dlat = deg2rad(ut_lat_mem_floats[ut_memory_0idx] - latitudeLLA_float);
-	float dlon = deg2rad(ut_long_mem_floats[ut_memory_0idx] - longitudeLLA_float);
-	float a = sin(dlat / 2) * sin(dlat / 2) +
-	cos(deg2rad(latitudeLLA_float)) * cos(deg2rad(ut_lat_mem_floats[ut_memory_0idx])) * sin(dlon / 2) * sin(dlon / 2);
-	float c = 2 * atan2(sqrt(a), sqrt(1 - a));
-	float distance = (RADIUS_OF_EARTH + (altitudeLLA_float/1000) ) * c; //assume common altitude which has to be converted from m to KM
-	//convert to string and copy to ut_distance_str;
-	float_to_string(distance, ut_distance_str, DISTANCE_SIG_FIG);
+void ut_update_selected(){
+	uint8_t index = ut_memory_0idx;
+
+	ut_update_dist(index);
+	//convert to string and copy to ut_distance_str; blank for a location not in use
+	if (ut_mem_distance_dm[index] != UT_DISTANCE_UNKNOWN){
+		ut_distance_to_string(ut_mem_distance_dm[index], ut_distance_str, DISTANCE_SIG_FIG);
+	} else {
+		memset(ut_distance_str, ' ', DISTANCE_SIG_FIG * sizeof(char));
+	}
 }
 
-// Function to load a float value from EEPROM
-float ut_load_float_from_eeprom(uint16_t address) {
-	float value;
-	eeprom_read_block((void*)&value, (const void*)address, sizeof(float));
-	return value;
+/**
+ * @brief Sorts the memory locations in use by their distance as of the last ut_update_dist().
+ *		  Insertion sort; with MAX_MEM_INDEX entries it takes less time than a single distance.
+ */
+void ut_rank_nearest(){
+	uint8_t count = 0;
+
+	for (uint8_t index = 0; index < MAX_MEM_INDEX; index++){
+		uint8_t i;
+
+		if (ut_mem_distance_dm[index] == UT_DISTANCE_UNKNOWN){ //not in use at its last update
+			continue;
+		}
+		for (i = count++; (i > 0) && (ut_mem_distance_dm[ut_nearest[i - 1]] > ut_mem_distance_dm[index]); i--){
+			ut_nearest[i] = ut_nearest[i - 1];
+		}
+		ut_nearest[i] = index;
+	}
+	ut_nearest_count = count;
 }
 
-// Function to write a float value to EEPROM
-void ut_write_float_to_eeprom(uint16_t address, float value) {
-	eeprom_write_block((const void*)&value, (void*)address, sizeof(float));
+/**
+ * @brief Updates ut_bearing_cdeg from the position given to ut_set_position() to the selected memory location
+ *		  The point is copied under cli(), as the button ISR may change the selection.
+ */
+void ut_update_bearing(){
+	mem_point_t mem;
+	ut_geo_point_t mem_point;
+	uint8_t sreg = SREG;
+
+	cli();
+	mem = mem_points[ut_memory_0idx];
+	SREG = sreg;
+	if (mem.lat_udeg == MEM_UNUSED_UDEG){
+		ut_bearing_cdeg = UT_BEARING_UNKNOWN;
+		return;
+	}
+	ut_geo_point_set(&mem_point, mem.lat_udeg, mem.lon_udeg);
+	ut_bearing_cdeg = ut_geo_bearing_cdeg(&user_point, &mem_point);
 }
 
+/**
+ * @brief Reads the name of a memory location for the display.
+ *		  The log is only appended to by ut_run_action(), also in the main loop, so the entry is read as found.
+ *		  Names are kept in name_cache until the location is written, and EEPROM is not read while writes
+ *		  are queued, as the read would wait for them; the name is left blank until the next update then.
+ * @param index Memory index.
+ * @param name Set to UT_WPT_NAME_CHARS characters: the saved name, or "MEM" and the index when not in use.
+ */
+void ut_mem_name(uint8_t index, char* name){
+	ut_wpt_t wpt;
+
+	if (!ut_mem_in_use(index)){
+		memcpy(name, "MEM      ", UT_WPT_NAME_CHARS);
+		name[3] = '0' + (index / 10);
+		name[4] = '0' + (index % 10);
+		return;
+	}
+	for (uint8_t i = 0; i < NAME_CACHE_SIZE; i++){
+		if (name_cache_index[i] == index){
+			memcpy(name, name_cache[i], UT_WPT_NAME_CHARS);
+			return;
+		}
+	}
+	if (ut_eeq_pending() || !ut_log_read(index, &wpt)){
+		memset(name, ' ', UT_WPT_NAME_CHARS);
+		return;
+	}
+	memcpy(name, wpt.name, UT_WPT_NAME_CHARS);
+	ut_cache_name(index, wpt.name);
+}
 
 /**
- * @brief Loads position from non-volatile memory (EEPROM).
+ * @brief Loads a memory location from non-volatile memory (EEPROM).
  * 
- * This function loads the longitude and latitude from non-volatile memory.
+ * This function reads the location's newest log entry through the index rebuilt by ut_log_init() and refreshes its copy in mem_points.
  * 
  * @param index The index of the memory location.
- * @param longitude Pointer to store the longitude value.
- * @param latitude Pointer to store the latitude value.
  */
 void ut_load_from_non_vol(uint8_t index){
-	eeprom_busy_wait();
-	ut_long_mem_floats[index] = eeprom_read_float(ut_long_EPROM_floats+index);
-	eeprom_busy_wait();
-	ut_lat_mem_floats[index] = eeprom_read_float(ut_lat_EPROM_floats+index);
+	ut_wpt_t wpt;
+
+	if (ut_log_read(index, &wpt)){
+		mem_points[index].lat_udeg = wpt.lat_udeg;
+		mem_points[index].lon_udeg = wpt.lon_udeg;
+	} else {
+		mem_points[index].lat_udeg = MEM_UNUSED_UDEG;
+	}
 }
 
 /**
- * @brief Writes to non-volatile memory (EEPROM).
+ * @brief Writes a memory location to non-volatile memory (EEPROM).
  * 
- * This function writes data to non-volatile memory based on the provided index.
+ * This function appends a SAVE entry with the location and its name to the EEPROM log, or a CLEAR entry when it is not in use.
  * 
  * @param index The index of the memory location.
+ * @param name UT_WPT_NAME_CHARS characters; not read when the location is not in use.
+ */
+void ut_write_to_non_vol(uint8_t index, const char* name){
+	ut_forget_name(index);
+	if (ut_mem_in_use(index)){
+		ut_wpt_t wpt;
+
+		wpt.lat_udeg = mem_points[index].lat_udeg;
+		wpt.lon_udeg = mem_points[index].lon_udeg;
+		memcpy(wpt.name, name, UT_WPT_NAME_CHARS);
+		ut_log_save(index, &wpt);
+		ut_cache_name(index, name); //shown while the entry is still queued
+	} else {
+		ut_log_clear(index);
+	}
+}
+
+/**
+ * @brief Drops the cached name of a memory location, so ut_mem_name() reads it again once written.
+ *
+ * @param index The index of the memory location.
  */
-void ut_write_to_non_vol(uint8_t index){
-	eeprom_busy_wait();
-	eeprom_update_float(ut_long_EPROM_floats+index, ut_long_mem_floats[index]);
-	eeprom_busy_wait();
-	eeprom_update_float(ut_lat_EPROM_floats+index, ut_lat_mem_floats[index]);
+void ut_forget_name(uint8_t index){
+	for (uint8_t i = 0; i < NAME_CACHE_SIZE; i++){
+		if (name_cache_index[i] == index){
+			name_cache_index[i] = UT_LOG_NONE;
+		}
+	}
+}
 
+/**
+ * @brief Keeps the name of a memory location for ut_mem_name(), in place of the oldest name kept.
+ *
+ * @param index The index of the memory location.
+ * @param name UT_WPT_NAME_CHARS characters.
+ */
+void ut_cache_name(uint8_t index, const char* name){
+	memcpy(name_cache[name_cache_next], name, UT_WPT_NAME_CHARS);
+	name_cache_index[name_cache_next] = index;
+	name_cache_next = (name_cache_next + 1) % NAME_CACHE_SIZE;
+}
+
+/**
+ * @brief Whether a memory location holds a saved position.
+ *
+ * @param index The index of the memory location.
+ * @return true unless it was cleared or never saved.
+ */
+boolean_t ut_mem_in_use(uint8_t index){
+	return mem_points[index].lat_udeg != MEM_UNUSED_UDEG;
 }
@@ -12,19 +12,24 @@
 #define UTILITIES_H
 
 #include "ut_types.h"
+#include "ut_log.h"
 #include "../nf/nf_types.h"
 
 #define NOP asm("nop"); /**< No operation macro. */
 
 #define STAT_MODE 1 /**< Mode indicating status. */
 #define NAV_MODE 0  /**< Mode indicating navigation. */
+#define SAT_MODE 2  /**< Mode indicating satellite signal strength. */
+#define NEAR_MODE 3 /**< Mode listing the nearest saved positions. */
+#define COMPASS_MODE 4 /**< Mode pointing at the selected memory location. */
+#define NUM_MODES 5 /**< Number of modes cycled by the mode select button. */
 
 #define NUM_OPERATIONS 3 /**< Number of available operations. */
 #define SAVE_OP 0  /**< Save operation index. */
 #define CLEAR_OP 1 /**< Clear operation index. */
 #define RESET_OP 2 /**< Reset operation index. */
 
-#define MAX_MEM_INDEX 10 /**< Maximum memory index. */
+#define MAX_MEM_INDEX UT_LOG_SLOTS /**< Maximum memory index; the locations kept in the EEPROM log of ut_log.h. */
 #define SAVE_STR  " SAVE" /**< Save operation string. */
 #define CLEAR_STR "CLEAR" /**< Clear operation string. */
 #define RESET_STR "RESET" /**< Reset operation string. */
@@ -40,23 +45,25 @@
 
 #define	RADIUS_OF_EARTH	6371.0f //**<Radius of the Earth see: https://solarsystem.nasa.gov/planets/earth/in-depth.amp */
 #define DISTANCE_SIG_FIG 6 //**<Number of characters available for distance calculation */
+#define DM_PER_KM 10000UL //**<Decimetres per kilometre */
+#define UT_BEARING_UNKNOWN 0xFFFFU //**<ut_bearing_cdeg while the selected memory location is not in use */
+#define UT_DISTANCE_UNKNOWN 0xFFFFFFFFUL //**<ut_mem_distance_dm of a memory location not in use at its last update */
 
-#define EEPROM_START_ADDR 0x0000 //**<Starting address for EEPROM data
-#define NUM_FLOATS_MAX_MEM_INDEX 10 //**<Number of float values in each array
-#define FLOAT_SIZE_BYTES sizeof(float) //**<Size of a float value in bytes
 
 // macros
 #define  CS_ENABLE()	PORT_SPI &= ~(1 << CS)
 #define  CS_DISABLE()   PORT_SPI |= (1<< CS)
 
-extern boolean_t ut_mode; /**< Current mode indicator. */
+extern uint8_t ut_mode; /**< Current mode indicator. */
 extern uint8_t ut_operation; /**< Current operation index. */
 extern uint8_t ut_memory_0idx; /**< Current memory index. */
-extern float ut_lat_mem_floats[MAX_MEM_INDEX]; /**< Array to store latitude memory floats. */
-extern float ut_long_mem_floats[MAX_MEM_INDEX]; /**< Array to store longitude memory floats. */
 extern char ut_lat_mem_str[LLA_LAT_BUFFER_SIZE]; /**< Array to store latitude memory strings. */
 extern char ut_long_mem_str[LLA_LONG_BUFFER_SIZE]; /**< Array to store longitude memory strings. */
 extern char ut_distance_str[DISTANCE_SIG_FIG];	/**< Array of characters to store distance between user and selected memory location (in km). */
+extern uint32_t ut_mem_distance_dm[MAX_MEM_INDEX]; /**< Distance from the user to each memory location in decimetres, as of the last ut_update_dist(), or UT_DISTANCE_UNKNOWN. */
+extern uint8_t ut_nearest[MAX_MEM_INDEX]; /**< Indices of the memory locations in use, nearest first, as of the last ut_rank_nearest(). */
+extern uint8_t ut_nearest_count; /**< Number of valid entries in ut_nearest. */
+extern uint16_t ut_bearing_cdeg; /**< Bearing from the user to the selected memory location in hundredths of a degree, or UT_BEARING_UNKNOWN. */
 
 /**
  * @brief Initializes the pins for buttons, loads from SD card, and initializes stored locations on startup.
@@ -71,9 +78,60 @@ void ut_init();
 void ut_poll_btns();
 
 /**
- * @brief Performs distance calculation between user's current position and the position stored at the selected memory index
+ * @brief Carries out the last action button press: SAVE, CLEAR or RESET of the memory locations.
+ * Called from the main loop; ut_poll_btns() only records the press, so the EEPROM log is never written from an interrupt.
  */
-void ut_update_dist();
+void ut_run_action();
+
+/**
+ * @brief Whether the last action is still being carried out, its EEPROM writes included.
+ * @return true until the action has run and the EEPROM write queue is empty.
+ */
+boolean_t ut_action_busy();
+
+/**
+ * @brief Takes the user's position for the following distance updates.
+ * @param nav Current navigation solution.
+ */
+void ut_set_position(const nav_solution_t* nav);
+
+/**
+ * @brief Updates the distance between the user's position and one memory location.
+ * Memory locations that were cleared or never saved are skipped.
+ * @param index Memory index.
+ */
+void ut_update_dist(uint8_t index);
+
+/**
+ * @brief Updates the distance to the selected memory location and ut_distance_str from it.
+ */
+void ut_update_selected();
+
+/**
+ * @brief Sorts the memory locations in use by their distance as of the last ut_update_dist().
+ */
+void ut_rank_nearest();
+
+/**
+ * @brief Updates ut_bearing_cdeg from the position given to ut_set_position() to the selected memory location.
+ */
+void ut_update_bearing();
+
+/**
+ * @brief Converts a distance to kilometres with as many decimals as fit, e.g. "12.345".
+ * @param distance_dm Distance in decimetres.
+ * @param str Destination; not terminated when every character is used.
+ * @param max_size Characters available in str.
+ */
+void ut_distance_to_string(uint32_t distance_dm, char *str, int max_size);
+
+/**
+ * @brief Reads the name of a memory location for the display, from EEPROM unless one of the last few read or saved.
+ * @param index Memory index.
+ * @param name Set to UT_WPT_NAME_CHARS characters: the saved name, or "MEM" and the index when not in use;
+ *		  blank when the name would have to be read while EEPROM writes are queued.
+ */
+void ut_mem_name(uint8_t index, char* name);
 
 void SPI_init();
 void SD_powerUpSeq();